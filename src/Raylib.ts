@@ -5,9 +5,33 @@ import type {
   RenderTexture2D,
   Model,
   ModelAnimation,
+  SkinningBenchmark,
+  PoseCacheStats,
+  AnimationCompression,
+  AnimationLayer,
+  ModelCacheMode,
+  ModelLoadRequest,
+  ModelLodInfo,
+  MeshOptimizeStats,
+  ModelBinaryCacheStats,
+  TextureLoadProgress,
+  TextureMemoryStats,
+  TextureLoadRequest,
+  UnloadQueueKind,
+  UnloadQueueStats,
+  BonePaletteSpace,
   BoundingBox,
   Shader,
+  Ray,
   RayCollision,
+  ModelRayCollision,
+  ShapeCollision,
+  ModelInstance,
+  SceneRayCollision,
+  Camera3D,
+  CullingStats,
+  Mesh,
+  CollisionBenchmark,
   Matrix,
   Font,
   TextMeasurement,
@@ -16,7 +40,7 @@ import type {
 import { BlendMode, TextAlignment } from "./types";
 import { initError, ffiError, stateError, validationError } from "./types";
 import { Ok, Err, tryFn } from "./result";
-import { ptr } from "bun:ffi";
+import { ptr, type Pointer } from "bun:ffi";
 import {
   validateAll,
   validateFinite,
@@ -29,6 +53,12 @@ import {
 import Vector2 from "./math/Vector2";
 import Vector3 from "./math/Vector3";
 import Rectangle from "./math/Rectangle";
+import {
+  RAYCAST_BATCH_STRIDE,
+  ANIMATION_BATCH_STRIDE,
+  ANIMATION_LAYER_STRIDE,
+  SHADER_TEXTURE_UNITS,
+} from "./constants";
 
 export default class Raylib {
   private previousMousePos: Vector2 = Vector2.Zero();
@@ -36,6 +66,7 @@ export default class Raylib {
   private isInitialized = false;
   private windowWidth = 0;
   private windowHeight = 0;
+  private unloadBudgetMs = 2; // Time endDrawing() may spend releasing unloads
   private rl: any;
 
   constructor(libraryPath?: string) {
@@ -60,6 +91,31 @@ export default class Raylib {
     return new Ok(undefined);
   }
 
+  // Pack Matrix in raylib memory order (column-major m0..m15)
+  private packMatrix(
+    matrix: Matrix,
+    out: Float32Array = new Float32Array(16),
+    offset = 0,
+  ): Float32Array {
+    out[offset + 0] = matrix.m0;
+    out[offset + 1] = matrix.m1;
+    out[offset + 2] = matrix.m2;
+    out[offset + 3] = matrix.m3;
+    out[offset + 4] = matrix.m4;
+    out[offset + 5] = matrix.m5;
+    out[offset + 6] = matrix.m6;
+    out[offset + 7] = matrix.m7;
+    out[offset + 8] = matrix.m8;
+    out[offset + 9] = matrix.m9;
+    out[offset + 10] = matrix.m10;
+    out[offset + 11] = matrix.m11;
+    out[offset + 12] = matrix.m12;
+    out[offset + 13] = matrix.m13;
+    out[offset + 14] = matrix.m14;
+    out[offset + 15] = matrix.m15;
+    return out;
+  }
+
   private safeFFICall<T>(operation: string, fn: () => T): RaylibResult<T> {
     return tryFn(fn).mapErr((error) =>
       ffiError(
@@ -110,6 +166,9 @@ export default class Raylib {
     }
 
     return this.safeFFICall("close window", () => {
+      for (const drain of this.unloadDrains()) {
+        drain(-1); // Release everything still queued while the context lives
+      }
       this.rl.CloseWindowWrapper();
       this.isInitialized = false;
       this.windowWidth = 0;
@@ -140,9 +199,80 @@ export default class Raylib {
     );
   }
 
+  // Ends the frame, evicts textures over the memory budget (see
+  // setTextureMemoryBudget), then releases unloaded models, textures, render
+  // textures and shaders for up to the unload budget (see setUnloadBudget)
   public endDrawing(): RaylibResult<void> {
     return this.requireInitialized().andThen(() =>
-      this.safeFFICall("end drawing", () => this.rl.EndDrawingWrapper()),
+      this.safeFFICall("end drawing", () => {
+        this.rl.EndDrawingWrapper();
+        this.rl.EndTextureFrame();
+        const deadline = performance.now() + this.unloadBudgetMs;
+        for (const drain of this.unloadDrains()) {
+          drain(Math.max(0, deadline - performance.now()));
+        }
+      }),
+    );
+  }
+
+  // Deferred unloads. Unloading a model, texture, render texture or shader
+  // invalidates its handle at once but queues the GPU release; endDrawing()
+  // works the queues off after the frame. Each queue gives up at least one
+  // resource per frame, so they drain even with a zero budget.
+  private unloadDrains(): Array<(budgetMs: number) => number> {
+    return [
+      (budgetMs) => this.rl.DrainModelUnloads(budgetMs),
+      (budgetMs) => this.rl.DrainTextureUnloads(budgetMs),
+      (budgetMs) => this.rl.DrainRenderTextureUnloads(budgetMs),
+      (budgetMs) => this.rl.DrainShaderUnloads(budgetMs),
+    ];
+  }
+
+  // Milliseconds per frame endDrawing() may spend on queued releases (2 by
+  // default)
+  public setUnloadBudget(budgetMs: number): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateRange(budgetMs, 0, 1000, "unload budget"))
+      .andThen(() => {
+        this.unloadBudgetMs = budgetMs;
+        return new Ok(undefined);
+      });
+  }
+
+  // Queue unloads for endDrawing() (default) or release them on the spot.
+  // Turning deferral off releases everything still queued.
+  public setDeferredUnload(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set deferred unload", () => {
+        this.rl.SetDeferredModelUnload(enabled);
+        this.rl.SetDeferredTextureUnload(enabled);
+        this.rl.SetDeferredRenderTextureUnload(enabled);
+        this.rl.SetDeferredShaderUnload(enabled);
+      }),
+    );
+  }
+
+  // Queue depth per resource kind; peaks and release counts cover the time
+  // since the last call
+  public getUnloadQueueStats(): RaylibResult<Record<UnloadQueueKind, UnloadQueueStats>> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get unload queue stats", () => {
+        const statsBuffer = new Int32Array(3);
+        const read = (getStats: (out: Pointer, reset: boolean) => void): UnloadQueueStats => {
+          getStats(ptr(statsBuffer), true);
+          return {
+            pending: statsBuffer[0]!,
+            peakPending: statsBuffer[1]!,
+            released: statsBuffer[2]!,
+          };
+        };
+        return {
+          model: read(this.rl.GetModelUnloadStats),
+          texture: read(this.rl.GetTextureUnloadStats),
+          renderTexture: read(this.rl.GetRenderTextureUnloadStats),
+          shader: read(this.rl.GetShaderUnloadStats),
+        };
+      }),
     );
   }
 
@@ -777,6 +907,9 @@ export default class Raylib {
       );
   }
 
+  // The returned id is only valid while the texture stays on the GPU, so the
+  // texture is pinned: the memory budget will not evict it until
+  // unpinTexture is called. Drawing by slot needs no pin.
   public getTextureFromSlot(slotIndex: number): RaylibResult<Texture2D> {
     return this.requireInitialized()
       .andThen(() => validateFinite(slotIndex, "slotIndex"))
@@ -799,6 +932,18 @@ export default class Raylib {
       );
   }
 
+  // Let the memory budget evict a texture pinned by getTextureFromSlot. Ids
+  // taken before may dangle after the next endDrawing(); fetch a fresh one.
+  public unpinTexture(slotIndex: number): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(slotIndex, "slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("unpin texture", () => {
+          this.rl.UnpinTextureBySlot(slotIndex);
+        }),
+      );
+  }
+
   public unloadTextureFromSlot(slotIndex: number): RaylibResult<void> {
     return this.requireInitialized()
       .andThen(() => validateFinite(slotIndex, "slotIndex"))
@@ -886,6 +1031,113 @@ export default class Raylib {
     );
   }
 
+  // Starts loading a texture: the image is read and decoded on a worker
+  // thread; call updateTextureLoads every frame to upload decoded images and
+  // pollTextureLoad to get the slot once it is ready.
+  public loadTextureAsync(fileName: string): RaylibResult<TextureLoadRequest> {
+    return this.requireInitialized()
+      .andThen(() => validateNonEmptyString(fileName, "fileName"))
+      .andThen(() =>
+        this.safeFFICall("load texture async", () => {
+          const fileNameBuffer = this.textEncoder.encode(fileName + "\0");
+          const requestId = this.rl.LoadTextureAsync(ptr(fileNameBuffer));
+          if (requestId < 0) {
+            throw new Error("Failed to start loading texture");
+          }
+          const request: TextureLoadRequest = { requestId };
+          return request;
+        }),
+      );
+  }
+
+  // Uploads decoded textures for up to budgetMs (at least one per call).
+  // Returns the number of loads still in flight.
+  public updateTextureLoads(budgetMs: number = 4): RaylibResult<number> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(budgetMs, "budgetMs"))
+      .andThen(() =>
+        this.safeFFICall("update texture loads", () =>
+          this.rl.UpdateTextureLoads(budgetMs),
+        ),
+      );
+  }
+
+  // The texture slot once its load has finished, null while it is still
+  // pending. A finished request is released; polling it again is an error.
+  public pollTextureLoad(request: TextureLoadRequest): RaylibResult<number | null> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(request.requestId, "request.requestId"))
+      .andThen(() =>
+        this.safeFFICall("poll texture load", () => {
+          const dataBuffer = new Int32Array(3);
+          const status = this.rl.GetTextureLoadStatus(
+            request.requestId,
+            ptr(dataBuffer),
+          );
+          if (status < 0) {
+            throw new Error("Failed to load texture or unknown load request");
+          }
+          return status === 0 ? null : dataBuffer[0]!;
+        }),
+      );
+  }
+
+  // GPU memory textures may keep resident, in megabytes (0: no budget).
+  // Past it, endDrawing() evicts the least recently drawn textures; they keep
+  // their slots and reload from file when drawn again. Textures pinned by
+  // getTextureFromSlot are never evicted.
+  public setTextureMemoryBudget(megabytes: number): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateRange(megabytes, 0, 1048576, "texture memory budget"))
+      .andThen(() =>
+        this.safeFFICall("set texture memory budget", () => {
+          this.rl.SetTextureMemoryBudget(Math.round(megabytes * 1024));
+        }),
+      );
+  }
+
+  // Estimated texture memory against the budget; eviction and reload counts
+  // cover the time since the last call
+  public getTextureMemoryStats(): RaylibResult<TextureMemoryStats> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get texture memory stats", () => {
+        const statsBuffer = new Int32Array(7);
+        this.rl.GetTextureMemoryStats(ptr(statsBuffer), true);
+        const stats: TextureMemoryStats = {
+          residentMB: statsBuffer[0]! / 1024,
+          budgetMB: statsBuffer[1]! / 1024,
+          resident: statsBuffer[2]!,
+          evicted: statsBuffer[3]!,
+          evictions: statsBuffer[4]!,
+          reloads: statsBuffer[5]!,
+          pinned: statsBuffer[6]!,
+        };
+        return stats;
+      }),
+    );
+  }
+
+  // Progress of the current batch of loadTextureAsync calls
+  public getTextureLoadProgress(): RaylibResult<TextureLoadProgress> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get texture load progress", () => {
+        const progressBuffer = new Int32Array(4);
+        this.rl.GetTextureLoadProgress(ptr(progressBuffer));
+        const started = progressBuffer[0]!;
+        const uploaded = progressBuffer[2]!;
+        const failed = progressBuffer[3]!;
+        const progress: TextureLoadProgress = {
+          started,
+          decoded: progressBuffer[1]!,
+          uploaded,
+          failed,
+          fraction: started > 0 ? (uploaded + failed) / started : 1,
+        };
+        return progress;
+      }),
+    );
+  }
+
   // Render texture management
   public loadRenderTexture(
     width: number,
@@ -986,21 +1238,7 @@ export default class Raylib {
     projection: number,
   ): RaylibResult<void> {
     return this.requireInitialized()
-      .andThen(() =>
-        validateAll(
-          validateFinite(cameraPosition.x, "cameraPosition.x"),
-          validateFinite(cameraPosition.y, "cameraPosition.y"),
-          validateFinite(cameraPosition.z, "cameraPosition.z"),
-          validateFinite(cameraTarget.x, "cameraTarget.x"),
-          validateFinite(cameraTarget.y, "cameraTarget.y"),
-          validateFinite(cameraTarget.z, "cameraTarget.z"),
-          validateFinite(cameraUp.x, "cameraUp.x"),
-          validateFinite(cameraUp.y, "cameraUp.y"),
-          validateFinite(cameraUp.z, "cameraUp.z"),
-          validateFinite(fovy, "fovy"),
-          validateFinite(projection, "projection"),
-        ),
-      )
+      .andThen(() => this.validateCamera(cameraPosition, cameraTarget, cameraUp, fovy, projection))
       .andThen(() =>
         this.safeFFICall("begin mode 3D", () => {
           this.rl.BeginMode3DWrapper(
@@ -1379,6 +1617,246 @@ export default class Raylib {
       );
   }
 
+  // Starts loading a model in the background. The files are read off the main
+  // thread, and with the binary cache on (setModelBinaryCache) so is the
+  // parsing; call updateModelLoads every frame to upload them and
+  // pollModelLoad to get the model once it is ready.
+  public loadModelAsync(fileName: string): RaylibResult<ModelLoadRequest> {
+    return this.requireInitialized()
+      .andThen(() => validateNonEmptyString(fileName, "fileName"))
+      .andThen(() =>
+        this.safeFFICall("load model async", () => {
+          const fileNameBuffer = this.textEncoder.encode(fileName + "\0");
+          const requestId = this.rl.LoadModelAsync(ptr(fileNameBuffer));
+          if (requestId < 0) {
+            throw new Error("Failed to start loading model");
+          }
+          const request: ModelLoadRequest = { requestId };
+          return request;
+        }),
+      );
+  }
+
+  // Uploads loaded models for up to budgetMs (at least one step per call: a
+  // texture or mesh of a cached model, or a whole uncached model). Returns
+  // the number of loads still in flight.
+  public updateModelLoads(budgetMs: number = 4): RaylibResult<number> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(budgetMs, "budgetMs"))
+      .andThen(() =>
+        this.safeFFICall("update model loads", () =>
+          this.rl.UpdateModelLoads(budgetMs),
+        ),
+      );
+  }
+
+  // The model once its load has finished, null while it is still pending.
+  // A finished request is released; polling it again is an error.
+  public pollModelLoad(request: ModelLoadRequest): RaylibResult<Model | null> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(request.requestId, "request.requestId"))
+      .andThen(() =>
+        this.safeFFICall("poll model load", () => {
+          const dataBuffer = new Int32Array(3);
+          const status = this.rl.GetModelLoadStatus(
+            request.requestId,
+            ptr(dataBuffer),
+          );
+          if (status < 0) {
+            throw new Error("Failed to load model or unknown load request");
+          }
+          if (status === 0) {
+            return null;
+          }
+          const model: Model = {
+            slotIndex: dataBuffer[0]!,
+            meshCount: dataBuffer[1]!,
+            materialCount: dataBuffer[2]!,
+          };
+          return model;
+        }),
+      );
+  }
+
+  // Loading a file that is already loaded returns the same model (static
+  // models only) and counts the reference; each load needs its own
+  // unloadModel before the model is freed.
+  public setModelCache(mode: ModelCacheMode): RaylibResult<void> {
+    const modes: ModelCacheMode[] = ["off", "path", "content"];
+    const modeIndex = modes.indexOf(mode);
+    return this.requireInitialized()
+      .andThen(() => {
+        if (modeIndex < 0) {
+          return new Err(validationError("Invalid model cache mode", `got ${mode}`));
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() =>
+        this.safeFFICall("set model cache mode", () => {
+          this.rl.SetModelCacheMode(modeIndex);
+        }),
+      );
+  }
+
+  // Number of loads sharing the model's slot (0 once fully unloaded)
+  public getModelRefCount(model: Model): RaylibResult<number> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("get model ref count", () =>
+          this.rl.GetModelRefCountBySlot(model.slotIndex),
+        ),
+      );
+  }
+
+  // Keep a binary copy of every model loaded from now on next to its file
+  // ("<path>.rlmc") and load from it while the file is unchanged, skipping
+  // parsing. Skinned models store their animations there too. Off by
+  // default.
+  public setModelBinaryCache(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set model binary cache", () => {
+        this.rl.SetModelBinaryCache(enabled);
+      }),
+    );
+  }
+
+  public getModelBinaryCacheStats(): RaylibResult<ModelBinaryCacheStats> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get model binary cache stats", () => {
+        const statsBuffer = new Int32Array(3);
+        this.rl.GetModelBinaryCacheStats(ptr(statsBuffer), true);
+        const stats: ModelBinaryCacheStats = {
+          hits: statsBuffer[0]!,
+          misses: statsBuffer[1]!,
+          writes: statsBuffer[2]!,
+        };
+        return stats;
+      }),
+    );
+  }
+
+  // Weld duplicate vertices and reorder triangles and vertices for the GPU
+  // caches in every model loaded from now on. Off by default.
+  public setModelMeshOptimization(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set model mesh optimization", () => {
+        this.rl.SetModelMeshOptimization(enabled);
+      }),
+    );
+  }
+
+  // Optimizes the meshes of an already loaded model
+  public optimizeModel(model: Model): RaylibResult<MeshOptimizeStats> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("optimize model", () => {
+          this.rl.OptimizeModelBySlot(model.slotIndex);
+        }),
+      )
+      .andThen(() => this.getModelOptimizeStats(model));
+  }
+
+  public getModelOptimizeStats(model: Model): RaylibResult<MeshOptimizeStats> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("get model optimize stats", () => {
+          const statsBuffer = new Float32Array(6);
+          this.rl.GetModelOptimizeStatsBySlot(model.slotIndex, ptr(statsBuffer));
+          const stats: MeshOptimizeStats = {
+            meshesOptimized: statsBuffer[0]!,
+            verticesBefore: statsBuffer[1]!,
+            verticesAfter: statsBuffer[2]!,
+            triangles: statsBuffer[3]!,
+            acmrBefore: statsBuffer[4]!,
+            acmrAfter: statsBuffer[5]!,
+          };
+          return stats;
+        }),
+      );
+  }
+
+  // Number of simplified levels built for models loaded from now on (0-4,
+  // 0 turns generation off). Each level has about half the triangles of the
+  // one before; skinned models are never simplified.
+  public setModelLodGeneration(levelCount: number): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => this.validateLodLevelCount(levelCount))
+      .andThen(() =>
+        this.safeFFICall("set model LOD generation", () => {
+          this.rl.SetModelLodGeneration(levelCount);
+        }),
+      );
+  }
+
+  // Builds (or rebuilds) the levels of an already loaded model
+  public generateModelLods(
+    model: Model,
+    levelCount: number,
+  ): RaylibResult<ModelLodInfo> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() => this.validateLodLevelCount(levelCount))
+      .andThen(() =>
+        this.safeFFICall("generate model LODs", () => {
+          this.rl.GenerateModelLodsBySlot(model.slotIndex, levelCount);
+        }),
+      )
+      .andThen(() => this.getModelLodInfo(model));
+  }
+
+  public getModelLodInfo(model: Model): RaylibResult<ModelLodInfo> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("get model LOD info", () => {
+          const infoBuffer = new Int32Array(6);
+          this.rl.GetModelLodInfoBySlot(model.slotIndex, ptr(infoBuffer));
+          const levelCount = infoBuffer[0]!;
+          const info: ModelLodInfo = {
+            levelCount,
+            triangleCounts: Array.from(infoBuffer.subarray(1, 2 + levelCount)),
+          };
+          return info;
+        }),
+      );
+  }
+
+  // Models covering less than screenSize of the screen height (bounding
+  // sphere diameter) draw at level 1, each halving moves one level further.
+  // 0 always draws full detail. Default 0.5.
+  public setModelLodScreenSize(screenSize: number): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(screenSize, "screenSize"))
+      .andThen(() =>
+        this.safeFFICall("set model LOD screen size", () => {
+          this.rl.SetModelLodScreenSize(screenSize);
+        }),
+      );
+  }
+
+  // Model draws per level (full detail first) since the previous call
+  public getModelLodStats(): RaylibResult<number[]> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get model LOD stats", () => {
+        const draws = new Int32Array(5);
+        this.rl.GetModelLodStats(ptr(draws), true);
+        return Array.from(draws);
+      }),
+    );
+  }
+
+  private validateLodLevelCount(levelCount: number): RaylibResult<void> {
+    if (!Number.isInteger(levelCount) || levelCount < 0 || levelCount > 4) {
+      return new Err(
+        validationError("LOD level count must be an integer from 0 to 4", `got ${levelCount}`),
+      );
+    }
+    return new Ok(undefined);
+  }
+
   public unloadModel(model: Model): RaylibResult<void> {
     return this.requireInitialized().andThen(() => {
       if (model.slotIndex < 0) {
@@ -1417,6 +1895,54 @@ export default class Raylib {
     });
   }
 
+  // Bounds of each mesh in the model's current pose. For skinned models they
+  // follow the last animation update; otherwise they are the load-time
+  // bounds. Model space, like getModelBoundingBox.
+  public getModelMeshBounds(model: Model): RaylibResult<BoundingBox[]> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("get model mesh bounds", () => {
+          const boundsBuffer = new Float32Array(Math.max(model.meshCount, 1) * 6);
+          const count = this.rl.GetModelMeshBoundsBySlot(
+            model.slotIndex,
+            ptr(boundsBuffer),
+            model.meshCount,
+          );
+          return this.readBoundingBoxes(boundsBuffer, count);
+        }),
+      );
+  }
+
+  // Whole-model bounds in the current pose for many models in one call.
+  // Unloaded models get an all-zero box.
+  public getModelBoundsBatch(models: Model[]): RaylibResult<BoundingBox[]> {
+    return this.requireInitialized().andThen(() => {
+      if (models.length === 0) {
+        return new Ok([]);
+      }
+      return this.safeFFICall("get model bounds batch", () => {
+        const slots = Int32Array.from(models, (model) => model.slotIndex);
+        const boundsBuffer = new Float32Array(models.length * 6);
+        this.rl.GetModelBoundsBatch(ptr(slots), models.length, ptr(boundsBuffer));
+        return this.readBoundingBoxes(boundsBuffer, models.length);
+      });
+    });
+  }
+
+  // Bounds layout: min x, y, z then max x, y, z per box
+  private readBoundingBoxes(buffer: Float32Array, count: number): BoundingBox[] {
+    const boxes: BoundingBox[] = [];
+    for (let i = 0; i < count; i++) {
+      const o = i * 6;
+      boxes.push({
+        min: { x: buffer[o]!, y: buffer[o + 1]!, z: buffer[o + 2]! },
+        max: { x: buffer[o + 3]!, y: buffer[o + 4]!, z: buffer[o + 5]! },
+      });
+    }
+    return boxes;
+  }
+
   public getModelInformation(model: Model): RaylibResult<{
     meshCount: number;
     materialCount: number;
@@ -1595,6 +2121,45 @@ export default class Raylib {
       });
   }
 
+  // Draw one copy of the model per matrix in transforms (16 floats each, in
+  // raylib memory order) with a single instanced draw call per mesh. shader
+  // must read the per-instance "instanceTransform" vertex attribute. Copies
+  // outside the view frustum are skipped. Returns the number of copies drawn.
+  public drawModelInstanced(
+    model: Model,
+    transforms: Float32Array,
+    shader: Shader,
+  ): RaylibResult<number> {
+    const count = Math.floor(transforms.length / 16);
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(model.slotIndex, "model.slotIndex"),
+          validateFinite(shader.slotIndex, "shader.slotIndex"),
+        ),
+      )
+      .andThen(() => {
+        if (transforms.length % 16 !== 0) {
+          return new Err(
+            validationError("transforms length must be a multiple of 16", `got ${transforms.length}`),
+          );
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() => {
+        if (count === 0) {
+          return new Ok(0);
+        }
+        return this.safeFFICall("draw model instanced", () => {
+          const shaderPtr = this.rl.GetShaderPointerFromSlot(shader.slotIndex);
+          if (!shaderPtr) {
+            throw new Error("Invalid shader slot");
+          }
+          return this.rl.DrawModelInstancedBySlot(model.slotIndex, ptr(transforms), count, shaderPtr);
+        });
+      });
+  }
+
   private drawWireframeCube(
     position: Vector3,
     size: number,
@@ -1696,10 +2261,33 @@ export default class Raylib {
     );
   }
 
-  // Animation loading and management
-  public loadModelAnimations(fileName: string): RaylibResult<ModelAnimation[]> {
+  // Animation loading and management. With compression the frame poses are
+  // kept as quantized, reduced keyframes (see storedBytes vs rawBytes).
+  public loadModelAnimations(
+    fileName: string,
+    compression?: AnimationCompression,
+  ): RaylibResult<ModelAnimation[]> {
+    const translationTolerance = compression?.translationTolerance ?? 0.001;
+    const rotationTolerance = compression?.rotationTolerance ?? 0.001;
     return this.requireInitialized()
       .andThen(() => validateNonEmptyString(fileName, "fileName"))
+      .andThen(() =>
+        validateAll(
+          validateFinite(translationTolerance, "translationTolerance"),
+          validateFinite(rotationTolerance, "rotationTolerance"),
+        ),
+      )
+      .andThen(() => {
+        if (translationTolerance < 0 || rotationTolerance < 0) {
+          return new Err(
+            validationError(
+              "Compression tolerances must not be negative",
+              `got ${translationTolerance}, ${rotationTolerance}`,
+            ),
+          );
+        }
+        return new Ok(undefined);
+      })
       .andThen(() =>
         this.safeFFICall("load model animations to slot", () => {
           const fileNameBuffer = this.textEncoder.encode(fileName + "\0");
@@ -1717,18 +2305,28 @@ export default class Raylib {
             );
           }
 
+          if (compression !== undefined) {
+            this.rl.CompressAnimationSlot(
+              slotIndex,
+              translationTolerance,
+              rotationTolerance,
+            );
+          }
+
           const animCount = animCountBuffer[0]!;
           const animations: ModelAnimation[] = [];
 
           // Get data for each animation in the slot
           for (let i = 0; i < animCount; i++) {
-            const dataBuffer = new Int32Array(2);
+            const dataBuffer = new Int32Array(4);
             this.rl.GetAnimationDataBySlot(slotIndex, i, ptr(dataBuffer));
 
             animations.push({
               slotIndex,
               frameCount: dataBuffer[0]!,
               boneCount: dataBuffer[1]!,
+              rawBytes: dataBuffer[2]!,
+              storedBytes: dataBuffer[3]!,
             });
           }
 
@@ -1770,23 +2368,240 @@ export default class Raylib {
       });
   }
 
-  public updateModelAnimationBones(
+  // Pose a model from one or more clips sampled at fractional frames and
+  // mixed by weight. CPU skins the meshes unless gpuSkinning is set, in which
+  // case only the bone matrices are updated.
+  public updateModelAnimationBlend(
     model: Model,
-    animation: ModelAnimation,
-    animIndex: number,
-    frame: number,
+    layers: AnimationLayer[],
+    gpuSkinning = false,
   ): RaylibResult<void> {
     return this.requireInitialized()
-      .andThen(() =>
-        validateAll(
-          validateFinite(model.slotIndex, "model.slotIndex"),
-          validateFinite(animation.slotIndex, "animation.slotIndex"),
-          validateNonNegative(animIndex, "animIndex"),
-          validateFinite(frame, "frame"),
-        ),
-      )
       .andThen(() => {
-        if (model.slotIndex < 0) {
+        if (layers.length === 0) {
+          return new Err(validationError("At least one animation layer is required"));
+        }
+        return validateAll(
+          validateFinite(model.slotIndex, "model.slotIndex"),
+          ...layers.map((layer) =>
+            validateAll(
+              validateFinite(layer.animation.slotIndex, "animation.slotIndex"),
+              validateNonNegative(layer.animIndex, "animIndex"),
+              validateFinite(layer.frame, "frame"),
+              validateNonNegative(layer.weight ?? 1, "weight"),
+            ),
+          ),
+        );
+      })
+      .andThen(() =>
+        this.safeFFICall("update model animation blend", () => {
+          const data = new Float32Array(layers.length * ANIMATION_LAYER_STRIDE);
+          layers.forEach((layer, i) => {
+            data.set(
+              [
+                layer.animation.slotIndex,
+                layer.animIndex,
+                layer.frame,
+                layer.weight ?? 1,
+                layer.loop ? 1 : 0,
+              ],
+              i * ANIMATION_LAYER_STRIDE,
+            );
+          });
+          const ok = gpuSkinning
+            ? this.rl.UpdateModelAnimationBonesBlendBySlot(model.slotIndex, ptr(data), layers.length)
+            : this.rl.UpdateModelAnimationBlendBySlot(model.slotIndex, ptr(data), layers.length);
+          if (!ok) {
+            throw new Error("Invalid model, no usable animation layer or model has no skinned meshes");
+          }
+        }),
+      );
+  }
+
+  // Blend from one clip to another: t = 0 shows from, t = 1 shows to
+  public crossfadeModelAnimation(
+    model: Model,
+    from: AnimationLayer,
+    to: AnimationLayer,
+    t: number,
+    gpuSkinning = false,
+  ): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateAll(validateFinite(t, "t"), validateRange(t, 0, 1, "t")))
+      .andThen(() =>
+        this.updateModelAnimationBlend(
+          model,
+          [
+            { ...from, weight: 1 - t },
+            { ...to, weight: t },
+          ],
+          gpuSkinning,
+        ),
+      );
+  }
+
+  // Sample a clip at a time in seconds, interpolating between frames.
+  // frameRate is the rate the clip was stored at (glTF imports use 60).
+  public updateModelAnimationAtTime(
+    model: Model,
+    animation: ModelAnimation,
+    animIndex: number,
+    time: number,
+    frameRate = 60,
+    loop = true,
+    gpuSkinning = false,
+  ): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(time, "time"),
+          validateFinite(frameRate, "frameRate"),
+          validatePositive(frameRate, "frameRate"),
+        ),
+      )
+      .andThen(() =>
+        this.updateModelAnimationBlend(
+          model,
+          [{ animation, animIndex, frame: time * frameRate, loop }],
+          gpuSkinning,
+        ),
+      );
+  }
+
+  // Update many animated models in one call. entries holds
+  // ANIMATION_BATCH_STRIDE floats per model: model slot, animation slot,
+  // animation index, frame. Models on the same animation frame share bone
+  // evaluation and skinning setup. Returns the number of models updated.
+  public updateAnimationsBatch(entries: Float32Array): RaylibResult<number> {
+    const count = Math.floor(entries.length / ANIMATION_BATCH_STRIDE);
+    return this.requireInitialized()
+      .andThen(() => {
+        if (entries.length % ANIMATION_BATCH_STRIDE !== 0) {
+          return new Err(
+            validationError(
+              `entries length must be a multiple of ${ANIMATION_BATCH_STRIDE}`,
+              `got ${entries.length}`,
+            ),
+          );
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() => {
+        if (count === 0) {
+          return new Ok(0);
+        }
+        return this.safeFFICall("update animations batch", () =>
+          this.rl.UpdateAnimationsBatch(ptr(entries), count),
+        );
+      });
+  }
+
+  // Native skinning (default) or raylib's UpdateModelAnimation for
+  // updateModelAnimation
+  public setNativeSkinning(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set native skinning", () => {
+        this.rl.SetNativeSkinningEnabled(enabled);
+      }),
+    );
+  }
+
+  public getSkinningThreadCount(): RaylibResult<number> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get skinning thread count", () => this.rl.GetSkinningThreadCount()),
+    );
+  }
+
+  // Reuse bone matrices between models playing the same animation frame.
+  // Enabled by default.
+  public setPoseCache(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set pose cache", () => {
+        this.rl.SetPoseCacheEnabled(enabled);
+      }),
+    );
+  }
+
+  public clearPoseCache(): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("clear pose cache", () => {
+        this.rl.ClearPoseCache();
+      }),
+    );
+  }
+
+  // Hit/miss counts since the previous call; call once per frame.
+  public getPoseCacheStats(): RaylibResult<PoseCacheStats> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get pose cache stats", () => {
+        const stats = new Int32Array(3);
+        this.rl.GetPoseCacheStats(ptr(stats), true);
+        return {
+          hits: stats[0]!,
+          misses: stats[1]!,
+          entries: stats[2]!,
+        };
+      }),
+    );
+  }
+
+  // Skin one frame with both paths and report timings and the largest
+  // position difference
+  public benchmarkModelSkinning(
+    model: Model,
+    animation: ModelAnimation,
+    animIndex: number,
+    frame: number,
+  ): RaylibResult<SkinningBenchmark> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(model.slotIndex, "model.slotIndex"),
+          validateFinite(animation.slotIndex, "animation.slotIndex"),
+          validateNonNegative(animIndex, "animIndex"),
+          validateFinite(frame, "frame"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("benchmark model skinning", () => {
+          const results = new Float32Array(4);
+          const ok = this.rl.BenchmarkModelSkinning(
+            model.slotIndex,
+            animation.slotIndex,
+            animIndex,
+            Math.floor(frame),
+            ptr(results),
+          );
+          if (!ok) {
+            throw new Error("Invalid model or animation, or model has no skinned meshes");
+          }
+          return {
+            raylibMs: results[0]!,
+            nativeMs: results[1]!,
+            maxError: results[2]!,
+            workerThreads: results[3]!,
+          };
+        }),
+      );
+  }
+
+  public updateModelAnimationBones(
+    model: Model,
+    animation: ModelAnimation,
+    animIndex: number,
+    frame: number,
+  ): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(model.slotIndex, "model.slotIndex"),
+          validateFinite(animation.slotIndex, "animation.slotIndex"),
+          validateNonNegative(animIndex, "animIndex"),
+          validateFinite(frame, "frame"),
+        ),
+      )
+      .andThen(() => {
+        if (model.slotIndex < 0) {
           return new Err(validationError("Invalid model slot index"));
         }
         if (animation.slotIndex < 0) {
@@ -1803,6 +2618,55 @@ export default class Raylib {
       });
   }
 
+  // Current pose of every bone, 16 floats per bone (column-major, like
+  // packMatrix): set by the last animation update, bind pose before any.
+  // Pass out to reuse a buffer across frames (one native call each); it must
+  // hold 16 * boneCount floats.
+  public getModelBonePalette(
+    model: Model,
+    out?: Float32Array,
+    space: BonePaletteSpace = "model",
+  ): RaylibResult<Float32Array> {
+    const spaces: BonePaletteSpace[] = ["model", "skinning"];
+    const spaceIndex = spaces.indexOf(space);
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() => {
+        if (spaceIndex < 0) {
+          return new Err(validationError("Invalid bone palette space", `got ${space}`));
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() =>
+        this.safeFFICall("get model bone palette", () => {
+          // Without a buffer, a first call with capacity 0 sizes one
+          const palette =
+            out ??
+            new Float32Array(
+              this.rl.GetModelBonePaletteBySlot(model.slotIndex, spaceIndex, null, 0) * 16,
+            );
+          const boneCount = this.rl.GetModelBonePaletteBySlot(
+            model.slotIndex,
+            spaceIndex,
+            palette.length > 0 ? ptr(palette) : null,
+            Math.floor(palette.length / 16),
+          );
+          return { palette, boneCount };
+        }),
+      )
+      .andThen(({ palette, boneCount }) => {
+        if (palette.length < boneCount * 16) {
+          return new Err(
+            validationError(
+              "Bone palette buffer too small",
+              `need ${boneCount * 16} floats, got ${palette.length}`,
+            ),
+          );
+        }
+        return new Ok(palette);
+      });
+  }
+
   public isModelAnimationValid(
     model: Model,
     animation: ModelAnimation,
@@ -2356,13 +3220,21 @@ export default class Raylib {
       });
   }
 
-  public setShaderValueTexture(shader: Shader, locIndex: number, textureSlot: number): RaylibResult<void> {
+  // Bind a texture to a texture unit (1 by default) and point the sampler
+  // uniform at it. Use a different unit for each sampler of a shader.
+  public setShaderValueTexture(
+    shader: Shader,
+    locIndex: number,
+    textureSlot: number,
+    unit: number = 1,
+  ): RaylibResult<void> {
     return this.requireInitialized()
       .andThen(() =>
         validateAll(
           validateFinite(shader.slotIndex, "shader.slotIndex"),
           validateFinite(locIndex, "locIndex"),
           validateFinite(textureSlot, "textureSlot"),
+          validateRange(unit, 1, SHADER_TEXTURE_UNITS - 1, "texture unit"),
         ),
       )
       .andThen(() => {
@@ -2373,7 +3245,10 @@ export default class Raylib {
           return new Err(validationError("Invalid texture slot index"));
         }
         return this.safeFFICall("set shader value texture", () => {
-          this.rl.SetShaderValueTextureBySlot(shader.slotIndex, locIndex, textureSlot);
+          if (!this.rl.BindTextureToUnitBySlot(textureSlot, unit)) {
+            throw new Error("Invalid texture slot or texture not loaded");
+          }
+          this.rl.SetShaderValueTextureBySlot(shader.slotIndex, locIndex, unit);
         });
       });
   }
@@ -2530,26 +3405,7 @@ export default class Raylib {
           rayArray[5] = rayDirection.z;
 
           // Create transform matrix if provided, otherwise use identity
-          let transformArray: Float32Array | null = null;
-          if (transform) {
-            transformArray = new Float32Array(16);
-            transformArray[0] = transform.m0;
-            transformArray[1] = transform.m1;
-            transformArray[2] = transform.m2;
-            transformArray[3] = transform.m3;
-            transformArray[4] = transform.m4;
-            transformArray[5] = transform.m5;
-            transformArray[6] = transform.m6;
-            transformArray[7] = transform.m7;
-            transformArray[8] = transform.m8;
-            transformArray[9] = transform.m9;
-            transformArray[10] = transform.m10;
-            transformArray[11] = transform.m11;
-            transformArray[12] = transform.m12;
-            transformArray[13] = transform.m13;
-            transformArray[14] = transform.m14;
-            transformArray[15] = transform.m15;
-          }
+          const transformArray = transform ? this.packMatrix(transform) : null;
 
           // Output buffer for collision result
           const outBuffer = new Float32Array(8);
@@ -2581,6 +3437,750 @@ export default class Raylib {
       );
   }
 
+  // Tests all meshes of a model in one call and returns the closest hit
+  public getRayCollisionModel(
+    rayPosition: Vector3,
+    rayDirection: Vector3,
+    model: Model,
+    transform?: Matrix,
+  ): RaylibResult<ModelRayCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(rayPosition.x, "rayPosition.x"),
+          validateFinite(rayPosition.y, "rayPosition.y"),
+          validateFinite(rayPosition.z, "rayPosition.z"),
+          validateFinite(rayDirection.x, "rayDirection.x"),
+          validateFinite(rayDirection.y, "rayDirection.y"),
+          validateFinite(rayDirection.z, "rayDirection.z"),
+          validateFinite(model.slotIndex, "model.slotIndex"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("get ray collision model", () => {
+          const rayArray = new Float32Array(6);
+          rayArray[0] = rayPosition.x;
+          rayArray[1] = rayPosition.y;
+          rayArray[2] = rayPosition.z;
+          rayArray[3] = rayDirection.x;
+          rayArray[4] = rayDirection.y;
+          rayArray[5] = rayDirection.z;
+
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const outBuffer = new Float32Array(8);
+
+          const meshIndex = this.rl.GetRayCollisionModel(
+            ptr(rayArray),
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(outBuffer),
+          );
+
+          return {
+            hit: outBuffer[0]! !== 0,
+            distance: outBuffer[1]!,
+            point: {
+              x: outBuffer[2]!,
+              y: outBuffer[3]!,
+              z: outBuffer[4]!,
+            },
+            normal: {
+              x: outBuffer[5]!,
+              y: outBuffer[6]!,
+              z: outBuffer[7]!,
+            },
+            meshIndex,
+          };
+        }),
+      );
+  }
+
+  // Casts packed rays (origin.xyz, direction.xyz per ray) against a model in
+  // one call. Results are written to out with RAYCAST_BATCH_STRIDE floats per
+  // ray; returns the number of rays that hit.
+  public raycastBatch(
+    rays: Float32Array,
+    model: Model,
+    out: Float32Array,
+    transform?: Matrix,
+  ): RaylibResult<number> {
+    const rayCount = Math.floor(rays.length / 6);
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() => {
+        if (rays.length % 6 !== 0) {
+          return new Err(
+            validationError("rays length must be a multiple of 6", `got ${rays.length}`),
+          );
+        }
+        if (out.length < rayCount * RAYCAST_BATCH_STRIDE) {
+          return new Err(
+            validationError(
+              `out must hold ${RAYCAST_BATCH_STRIDE} floats per ray`,
+              `got ${out.length} for ${rayCount} rays`,
+            ),
+          );
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() => {
+        if (rayCount === 0) {
+          return new Ok(0);
+        }
+        return this.safeFFICall("raycast batch", () => {
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          return this.rl.RaycastBatch(
+            ptr(rays),
+            rayCount,
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(out),
+          );
+        });
+      });
+  }
+
+  // Builds ray query acceleration for every mesh now instead of on first query
+  public buildModelBVH(model: Model): RaylibResult<number> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() => {
+        if (model.slotIndex < 0) {
+          return new Err(validationError("Invalid model slot index"));
+        }
+        return this.safeFFICall("build model BVH", () => {
+          const nodeCount = this.rl.BuildModelBVHBySlot(model.slotIndex);
+          if (nodeCount < 0) {
+            throw new Error("Invalid slot index or model not loaded");
+          }
+          return nodeCount;
+        });
+      });
+  }
+
+  // Shape queries run against the same cached BVHs as the ray queries. Casts
+  // report distance in units of the direction/motion vector; maxDistance <= 0
+  // means unlimited.
+  public sphereCastModel(
+    rayPosition: Vector3,
+    rayDirection: Vector3,
+    radius: number,
+    model: Model,
+    maxDistance: number = 0,
+    transform?: Matrix,
+  ): RaylibResult<ShapeCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(rayPosition.x, "rayPosition.x"),
+          validateFinite(rayPosition.y, "rayPosition.y"),
+          validateFinite(rayPosition.z, "rayPosition.z"),
+          validateFinite(rayDirection.x, "rayDirection.x"),
+          validateFinite(rayDirection.y, "rayDirection.y"),
+          validateFinite(rayDirection.z, "rayDirection.z"),
+          validateFinite(radius, "radius"),
+          validateNonNegative(radius, "radius"),
+          validateFinite(maxDistance, "maxDistance"),
+          validateFinite(model.slotIndex, "model.slotIndex"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("sphere cast model", () => {
+          const rayArray = new Float32Array([
+            rayPosition.x, rayPosition.y, rayPosition.z,
+            rayDirection.x, rayDirection.y, rayDirection.z,
+          ]);
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const outBuffer = new Float32Array(11);
+
+          this.rl.SphereCastModel(
+            ptr(rayArray),
+            radius,
+            maxDistance,
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(outBuffer),
+          );
+          return this.readShapeCollision(outBuffer);
+        }),
+      );
+  }
+
+  public capsuleCastModel(
+    capsuleStart: Vector3,
+    capsuleEnd: Vector3,
+    radius: number,
+    motion: Vector3,
+    model: Model,
+    maxDistance: number = 0,
+    transform?: Matrix,
+  ): RaylibResult<ShapeCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(capsuleStart.x, "capsuleStart.x"),
+          validateFinite(capsuleStart.y, "capsuleStart.y"),
+          validateFinite(capsuleStart.z, "capsuleStart.z"),
+          validateFinite(capsuleEnd.x, "capsuleEnd.x"),
+          validateFinite(capsuleEnd.y, "capsuleEnd.y"),
+          validateFinite(capsuleEnd.z, "capsuleEnd.z"),
+          validateFinite(radius, "radius"),
+          validateNonNegative(radius, "radius"),
+          validateFinite(motion.x, "motion.x"),
+          validateFinite(motion.y, "motion.y"),
+          validateFinite(motion.z, "motion.z"),
+          validateFinite(maxDistance, "maxDistance"),
+          validateFinite(model.slotIndex, "model.slotIndex"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("capsule cast model", () => {
+          const capsuleArray = new Float32Array([
+            capsuleStart.x, capsuleStart.y, capsuleStart.z,
+            capsuleEnd.x, capsuleEnd.y, capsuleEnd.z,
+            radius,
+          ]);
+          const motionArray = new Float32Array([motion.x, motion.y, motion.z]);
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const outBuffer = new Float32Array(11);
+
+          this.rl.CapsuleCastModel(
+            ptr(capsuleArray),
+            ptr(motionArray),
+            maxDistance,
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(outBuffer),
+          );
+          return this.readShapeCollision(outBuffer);
+        }),
+      );
+  }
+
+  // Closest surface point within radius (radius <= 0 searches everywhere).
+  // depth is radius - distance, i.e. how far a sphere of that radius overlaps.
+  public closestPointOnModel(
+    point: Vector3,
+    model: Model,
+    radius: number = 0,
+    transform?: Matrix,
+  ): RaylibResult<ShapeCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(point.x, "point.x"),
+          validateFinite(point.y, "point.y"),
+          validateFinite(point.z, "point.z"),
+          validateFinite(radius, "radius"),
+          validateFinite(model.slotIndex, "model.slotIndex"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("closest point on model", () => {
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const outBuffer = new Float32Array(11);
+
+          this.rl.ClosestPointOnModel(
+            point.x,
+            point.y,
+            point.z,
+            radius,
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(outBuffer),
+          );
+          return this.readShapeCollision(outBuffer);
+        }),
+      );
+  }
+
+  // Shape query layout: 8-float collision, meshIndex, triangleIndex, depth
+  private readShapeCollision(outBuffer: Float32Array): ShapeCollision {
+    return {
+      hit: outBuffer[0]! !== 0,
+      distance: outBuffer[1]!,
+      point: {
+        x: outBuffer[2]!,
+        y: outBuffer[3]!,
+        z: outBuffer[4]!,
+      },
+      normal: {
+        x: outBuffer[5]!,
+        y: outBuffer[6]!,
+        z: outBuffer[7]!,
+      },
+      meshIndex: outBuffer[8]!,
+      triangleIndex: outBuffer[9]!,
+      depth: outBuffer[10]!,
+    };
+  }
+
+  // Scene instances: a model placed with a world transform. The native side
+  // caches the inverse transform and keeps a top-level BVH over all instances.
+  public createModelInstance(model: Model, transform?: Matrix): RaylibResult<ModelInstance> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(model.slotIndex, "model.slotIndex"))
+      .andThen(() => {
+        if (model.slotIndex < 0) {
+          return new Err(validationError("Invalid model slot index"));
+        }
+        return this.safeFFICall("create model instance", () => {
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const id = this.rl.CreateModelInstance(
+            model.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+          );
+          if (id < 0) {
+            throw new Error("Model not loaded or out of memory for instances");
+          }
+          return { id, model };
+        });
+      });
+  }
+
+  public setModelInstanceTransform(instance: ModelInstance, transform: Matrix): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(instance.id, "instance.id"))
+      .andThen(() =>
+        this.safeFFICall("set model instance transform", () => {
+          const updated = this.rl.SetModelInstanceTransform(instance.id, ptr(this.packMatrix(transform)));
+          if (!updated) {
+            throw new Error("Invalid or removed model instance");
+          }
+        }),
+      );
+  }
+
+  public removeModelInstance(instance: ModelInstance): RaylibResult<void> {
+    return this.requireInitialized().andThen(() => {
+      if (instance.id < 0) {
+        return new Err(validationError("Invalid model instance id"));
+      }
+      return this.safeFFICall("remove model instance", () => {
+        this.rl.RemoveModelInstance(instance.id);
+      });
+    });
+  }
+
+  public clearModelInstances(): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("clear model instances", () => {
+        this.rl.ClearModelInstances();
+      }),
+    );
+  }
+
+  public getModelInstanceCount(): RaylibResult<number> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get model instance count", () => this.rl.GetModelInstanceCount()),
+    );
+  }
+
+  // First hit among all scene instances. maxDistance <= 0 means unlimited.
+  public raycastScene(
+    rayPosition: Vector3,
+    rayDirection: Vector3,
+    maxDistance: number = 0,
+  ): RaylibResult<SceneRayCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(rayPosition.x, "rayPosition.x"),
+          validateFinite(rayPosition.y, "rayPosition.y"),
+          validateFinite(rayPosition.z, "rayPosition.z"),
+          validateFinite(rayDirection.x, "rayDirection.x"),
+          validateFinite(rayDirection.y, "rayDirection.y"),
+          validateFinite(rayDirection.z, "rayDirection.z"),
+          validateFinite(maxDistance, "maxDistance"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("raycast scene", () => {
+          const rayArray = new Float32Array(6);
+          rayArray[0] = rayPosition.x;
+          rayArray[1] = rayPosition.y;
+          rayArray[2] = rayPosition.z;
+          rayArray[3] = rayDirection.x;
+          rayArray[4] = rayDirection.y;
+          rayArray[5] = rayDirection.z;
+
+          const outBuffer = new Float32Array(RAYCAST_BATCH_STRIDE);
+          const instanceId = this.rl.RaycastScene(ptr(rayArray), maxDistance, ptr(outBuffer));
+
+          return {
+            hit: outBuffer[0]! !== 0,
+            distance: outBuffer[1]!,
+            point: {
+              x: outBuffer[2]!,
+              y: outBuffer[3]!,
+              z: outBuffer[4]!,
+            },
+            normal: {
+              x: outBuffer[5]!,
+              y: outBuffer[6]!,
+              z: outBuffer[7]!,
+            },
+            meshIndex: outBuffer[8]!,
+            triangleIndex: outBuffer[9]!,
+            instanceId,
+          };
+        }),
+      );
+  }
+
+  // Persistent camera: created once and updated in place, so drawing and
+  // picking use the same native Camera3D
+  public createCamera3D(
+    cameraPosition: Vector3,
+    cameraTarget: Vector3,
+    cameraUp: Vector3,
+    fovy: number,
+    projection: number,
+  ): RaylibResult<Camera3D> {
+    return this.requireInitialized()
+      .andThen(() => this.validateCamera(cameraPosition, cameraTarget, cameraUp, fovy, projection))
+      .andThen(() =>
+        this.safeFFICall("create camera 3D", () => {
+          const slotIndex = this.rl.CreateCamera3DSlot(
+            cameraPosition.x, cameraPosition.y, cameraPosition.z,
+            cameraTarget.x, cameraTarget.y, cameraTarget.z,
+            cameraUp.x, cameraUp.y, cameraUp.z,
+            fovy, projection
+          );
+          if (slotIndex < 0) {
+            throw new Error("No free camera slots available");
+          }
+          return { slotIndex };
+        }),
+      );
+  }
+
+  public setCamera3D(
+    camera: Camera3D,
+    cameraPosition: Vector3,
+    cameraTarget: Vector3,
+    cameraUp: Vector3,
+    fovy: number,
+    projection: number,
+  ): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => this.validateCamera(cameraPosition, cameraTarget, cameraUp, fovy, projection))
+      .andThen(() =>
+        this.safeFFICall("set camera 3D", () => {
+          const updated = this.rl.SetCamera3DBySlot(
+            camera.slotIndex,
+            cameraPosition.x, cameraPosition.y, cameraPosition.z,
+            cameraTarget.x, cameraTarget.y, cameraTarget.z,
+            cameraUp.x, cameraUp.y, cameraUp.z,
+            fovy, projection
+          );
+          if (!updated) {
+            throw new Error("Invalid camera slot index");
+          }
+        }),
+      );
+  }
+
+  public unloadCamera3D(camera: Camera3D): RaylibResult<void> {
+    return this.requireInitialized().andThen(() => {
+      if (camera.slotIndex < 0) {
+        return new Err(validationError("Invalid camera slot index"));
+      }
+      return this.safeFFICall("unload camera 3D", () => {
+        this.rl.UnloadCamera3DSlot(camera.slotIndex);
+      });
+    });
+  }
+
+  public beginMode3DCamera(camera: Camera3D): RaylibResult<void> {
+    return this.requireInitialized()
+      .andThen(() => validateFinite(camera.slotIndex, "camera.slotIndex"))
+      .andThen(() =>
+        this.safeFFICall("begin mode 3D camera", () => this.rl.BeginMode3DBySlot(camera.slotIndex)),
+      );
+  }
+
+  public getScreenToWorldRay(camera: Camera3D, screenX: number, screenY: number): RaylibResult<Ray> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(screenX, "screenX"),
+          validateFinite(screenY, "screenY"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("get screen to world ray", () => {
+          const outBuffer = new Float32Array(6);
+          if (!this.rl.GetScreenToWorldRayBySlot(camera.slotIndex, screenX, screenY, ptr(outBuffer))) {
+            throw new Error("Invalid camera slot index");
+          }
+          return {
+            position: { x: outBuffer[0]!, y: outBuffer[1]!, z: outBuffer[2]! },
+            direction: { x: outBuffer[3]!, y: outBuffer[4]!, z: outBuffer[5]! },
+          };
+        }),
+      );
+  }
+
+  // Closest scene instance under a screen position (current mouse position
+  // when omitted). Ray construction and scene query happen in one call.
+  public pickSceneInstance(
+    camera: Camera3D,
+    screenX?: number,
+    screenY?: number,
+  ): RaylibResult<SceneRayCollision> {
+    const atMouse = screenX === undefined || screenY === undefined;
+    return this.requireInitialized()
+      .andThen(() =>
+        atMouse
+          ? validateFinite(camera.slotIndex, "camera.slotIndex")
+          : validateAll(
+              validateFinite(screenX!, "screenX"),
+              validateFinite(screenY!, "screenY"),
+            ),
+      )
+      .andThen(() =>
+        this.safeFFICall("pick scene instance", () => {
+          const outBuffer = new Float32Array(RAYCAST_BATCH_STRIDE);
+          const instanceId = atMouse
+            ? this.rl.PickSceneInstanceAtMouse(camera.slotIndex, ptr(outBuffer))
+            : this.rl.PickSceneInstanceBySlot(camera.slotIndex, screenX!, screenY!, ptr(outBuffer));
+
+          return {
+            hit: outBuffer[0]! !== 0,
+            distance: outBuffer[1]!,
+            point: {
+              x: outBuffer[2]!,
+              y: outBuffer[3]!,
+              z: outBuffer[4]!,
+            },
+            normal: {
+              x: outBuffer[5]!,
+              y: outBuffer[6]!,
+              z: outBuffer[7]!,
+            },
+            meshIndex: outBuffer[8]!,
+            triangleIndex: outBuffer[9]!,
+            instanceId,
+          };
+        }),
+      );
+  }
+
+  // Skip model and 3D primitive draws whose bounds fall outside the view
+  // frustum of the active 3D mode. Enabled by default.
+  public setFrustumCulling(enabled: boolean): RaylibResult<void> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("set frustum culling", () => {
+        this.rl.SetFrustumCullingEnabled(enabled);
+        this.rl.SetPrimitiveCullingEnabled(enabled);
+      }),
+    );
+  }
+
+  // Culled/drawn counts since the previous call; call once per frame.
+  public getCullingStats(): RaylibResult<CullingStats> {
+    return this.requireInitialized().andThen(() =>
+      this.safeFFICall("get culling stats", () => {
+        const models = new Int32Array(2);
+        const primitives = new Int32Array(2);
+        this.rl.GetFrustumCullingStats(ptr(models), true);
+        this.rl.GetPrimitiveCullingStats(ptr(primitives), true);
+        return {
+          culled: models[0]! + primitives[0]!,
+          drawn: models[1]! + primitives[1]!,
+          modelsCulled: models[0]!,
+          primitivesCulled: primitives[0]!,
+        };
+      }),
+    );
+  }
+
+  private validateCamera(
+    cameraPosition: Vector3,
+    cameraTarget: Vector3,
+    cameraUp: Vector3,
+    fovy: number,
+    projection: number,
+  ): RaylibResult<void> {
+    return validateAll(
+      validateFinite(cameraPosition.x, "cameraPosition.x"),
+      validateFinite(cameraPosition.y, "cameraPosition.y"),
+      validateFinite(cameraPosition.z, "cameraPosition.z"),
+      validateFinite(cameraTarget.x, "cameraTarget.x"),
+      validateFinite(cameraTarget.y, "cameraTarget.y"),
+      validateFinite(cameraTarget.z, "cameraTarget.z"),
+      validateFinite(cameraUp.x, "cameraUp.x"),
+      validateFinite(cameraUp.y, "cameraUp.y"),
+      validateFinite(cameraUp.z, "cameraUp.z"),
+      validateFinite(fovy, "fovy"),
+      validateFinite(projection, "projection"),
+    );
+  }
+
+  // Mesh collision: positions are packed xyz, indices may be 16 or 32 bit.
+  // Triangle edges are precomputed once so later raycasts test 4/8 triangles
+  // per iteration.
+  public loadCollisionMesh(
+    vertices: Float32Array,
+    indices?: Uint16Array | Uint32Array,
+  ): RaylibResult<Mesh> {
+    const vertexCount = Math.floor(vertices.length / 3);
+    const triangleCount = Math.floor((indices ? indices.length : vertexCount) / 3);
+    return this.requireInitialized()
+      .andThen(() => {
+        if (vertices.length === 0 || vertices.length % 3 !== 0) {
+          return new Err(
+            validationError("vertices length must be a positive multiple of 3", `got ${vertices.length}`),
+          );
+        }
+        if (triangleCount === 0) {
+          return new Err(validationError("Mesh must contain at least one triangle"));
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() =>
+        this.safeFFICall("load collision mesh", () => {
+          const indexSize = indices ? indices.BYTES_PER_ELEMENT : 0;
+          const slotIndex = this.rl.LoadCollisionMeshToSlot(
+            ptr(vertices),
+            vertexCount,
+            indices ? ptr(indices) : null,
+            indexSize,
+            triangleCount,
+          );
+          if (slotIndex < 0) {
+            throw new Error("No free collision mesh slots available");
+          }
+          return { slotIndex, vertexCount, triangleCount };
+        }),
+      );
+  }
+
+  public unloadCollisionMesh(mesh: Mesh): RaylibResult<void> {
+    return this.requireInitialized().andThen(() => {
+      if (mesh.slotIndex < 0) {
+        return new Err(validationError("Invalid collision mesh slot index"));
+      }
+      return this.safeFFICall("unload collision mesh", () => {
+        this.rl.UnloadCollisionMeshBySlot(mesh.slotIndex);
+      });
+    });
+  }
+
+  public raycastCollisionMesh(
+    rayPosition: Vector3,
+    rayDirection: Vector3,
+    mesh: Mesh,
+    transform?: Matrix,
+  ): RaylibResult<RayCollision> {
+    return this.requireInitialized()
+      .andThen(() =>
+        validateAll(
+          validateFinite(rayPosition.x, "rayPosition.x"),
+          validateFinite(rayPosition.y, "rayPosition.y"),
+          validateFinite(rayPosition.z, "rayPosition.z"),
+          validateFinite(rayDirection.x, "rayDirection.x"),
+          validateFinite(rayDirection.y, "rayDirection.y"),
+          validateFinite(rayDirection.z, "rayDirection.z"),
+          validateFinite(mesh.slotIndex, "mesh.slotIndex"),
+        ),
+      )
+      .andThen(() =>
+        this.safeFFICall("raycast collision mesh", () => {
+          const rayArray = new Float32Array(6);
+          rayArray[0] = rayPosition.x;
+          rayArray[1] = rayPosition.y;
+          rayArray[2] = rayPosition.z;
+          rayArray[3] = rayDirection.x;
+          rayArray[4] = rayDirection.y;
+          rayArray[5] = rayDirection.z;
+
+          const transformArray = transform ? this.packMatrix(transform) : null;
+          const outBuffer = new Float32Array(8);
+
+          const result = this.rl.GetRayCollisionMeshBySlot(
+            ptr(rayArray),
+            mesh.slotIndex,
+            transformArray ? ptr(transformArray) : null,
+            ptr(outBuffer),
+          );
+          if (result < 0) {
+            throw new Error("Invalid slot index or collision mesh not loaded");
+          }
+
+          return {
+            hit: outBuffer[0]! !== 0,
+            distance: outBuffer[1]!,
+            point: {
+              x: outBuffer[2]!,
+              y: outBuffer[3]!,
+              z: outBuffer[4]!,
+            },
+            normal: {
+              x: outBuffer[5]!,
+              y: outBuffer[6]!,
+              z: outBuffer[7]!,
+            },
+          };
+        }),
+      );
+  }
+
+  // Runs packed rays (origin.xyz, direction.xyz per ray) through both the
+  // per-triangle GetRayCollisionTriangle loop and the SIMD kernel
+  public benchmarkRayCollisionMesh(
+    vertices: Float32Array,
+    indices: Uint16Array | Uint32Array | null,
+    rays: Float32Array,
+  ): RaylibResult<CollisionBenchmark> {
+    const vertexCount = Math.floor(vertices.length / 3);
+    const triangleCount = Math.floor((indices ? indices.length : vertexCount) / 3);
+    const rayCount = Math.floor(rays.length / 6);
+    return this.requireInitialized()
+      .andThen(() => {
+        if (vertices.length === 0 || vertices.length % 3 !== 0) {
+          return new Err(
+            validationError("vertices length must be a positive multiple of 3", `got ${vertices.length}`),
+          );
+        }
+        if (triangleCount === 0) {
+          return new Err(validationError("Mesh must contain at least one triangle"));
+        }
+        if (rays.length === 0 || rays.length % 6 !== 0) {
+          return new Err(
+            validationError("rays length must be a positive multiple of 6", `got ${rays.length}`),
+          );
+        }
+        return new Ok(undefined);
+      })
+      .andThen(() =>
+        this.safeFFICall("benchmark ray collision mesh", () => {
+          const timings = new Float32Array(4);
+          const mismatches = this.rl.BenchmarkRayCollisionMesh(
+            ptr(vertices),
+            vertexCount,
+            indices ? ptr(indices) : null,
+            indices ? indices.BYTES_PER_ELEMENT : 0,
+            triangleCount,
+            ptr(rays),
+            rayCount,
+            ptr(timings),
+          );
+          if (mismatches < 0) {
+            throw new Error("Benchmark failed to prepare mesh data");
+          }
+          return {
+            gatherMs: timings[0]!,
+            simdMs: timings[1]!,
+            prepareMs: timings[2]!,
+            kernelWidth: timings[3]!,
+            mismatches,
+          };
+        }),
+      );
+  }
+
   // Font loading and management
   public loadFont(fileName: string, fontSize: number): RaylibResult<Font> {
     return this.requireInitialized()
@@ -30,6 +30,22 @@ export const Colors = {
 };
 
 
+// Floats per ray result written by raycastBatch:
+// hit, distance, point.xyz, normal.xyz, meshIndex, triangleIndex
+export const RAYCAST_BATCH_STRIDE = 10;
+
+// Floats per entry read by updateAnimationsBatch:
+// model slot, animation slot, animation index, frame
+export const ANIMATION_BATCH_STRIDE = 4;
+
+// Floats per layer passed to the native animation blend:
+// animation slot, animation index, frame, weight, loop
+export const ANIMATION_LAYER_STRIDE = 5;
+
+// Texture units setShaderValueTexture can bind to. Unit 0 belongs to the
+// render batch, so samplers use 1..SHADER_TEXTURE_UNITS - 1.
+export const SHADER_TEXTURE_UNITS = 16;
+
 export enum kb {
   KEY_NULL = 0,                    // Key: NULL, used for no key pressed
   // Alphanumeric keys
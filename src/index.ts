@@ -1,15 +1,15 @@
-import { Colors, kb, mouse } from "./constants";
+import { Colors, kb, mouse, RAYCAST_BATCH_STRIDE, ANIMATION_BATCH_STRIDE, ANIMATION_LAYER_STRIDE, SHADER_TEXTURE_UNITS } from "./constants";
 import Vector2 from "./math/Vector2";
 import Vector3 from "./math/Vector3";
 import Rectangle from "./math/Rectangle";
 import Color3 from "./math/Color3";
 import Raylib from "./Raylib";
 import { BlendMode, TextAlignment } from "./types";
-import type { RaylibError, RaylibResult, RenderTexture2D, Texture2D, Model, BoundingBox, RayCollision, Shader, Font, TextMeasurement, TextFormatOptions } from "./types";
+import type { RaylibError, RaylibResult, RenderTexture2D, Texture2D, TextureLoadRequest, TextureLoadProgress, TextureMemoryStats, Model, BoundingBox, RayCollision, ModelRayCollision, ShapeCollision, ModelInstance, SceneRayCollision, Camera3D, CullingStats, SkinningBenchmark, PoseCacheStats, AnimationCompression, AnimationLayer, BonePaletteSpace, ModelCacheMode, ModelBinaryCacheStats, UnloadQueueKind, UnloadQueueStats, ModelLoadRequest, ModelLodInfo, MeshOptimizeStats, Mesh, CollisionBenchmark, Shader, Font, TextMeasurement, TextFormatOptions } from "./types";
 import type { Err, None, Ok, Result, Some } from "./result";
 
 // UI Components
 export * from "./ui";
 
-export { Raylib, Vector2, Vector3, Rectangle, Color3, Colors, kb, mouse, BlendMode, TextAlignment }
-export type { RaylibError, RaylibResult, RenderTexture2D, Texture2D, Model, BoundingBox, RayCollision, Result, Ok, Err, Some, None, Shader, Font, TextMeasurement, TextFormatOptions }
\ No newline at end of file
+export { Raylib, Vector2, Vector3, Rectangle, Color3, Colors, kb, mouse, RAYCAST_BATCH_STRIDE, ANIMATION_BATCH_STRIDE, ANIMATION_LAYER_STRIDE, SHADER_TEXTURE_UNITS, BlendMode, TextAlignment }
+export type { RaylibError, RaylibResult, RenderTexture2D, Texture2D, TextureLoadRequest, TextureLoadProgress, TextureMemoryStats, Model, BoundingBox, RayCollision, ModelRayCollision, ShapeCollision, ModelInstance, SceneRayCollision, Camera3D, CullingStats, SkinningBenchmark, PoseCacheStats, AnimationCompression, AnimationLayer, BonePaletteSpace, ModelCacheMode, ModelBinaryCacheStats, UnloadQueueKind, UnloadQueueStats, ModelLoadRequest, ModelLodInfo, MeshOptimizeStats, Mesh, CollisionBenchmark, Result, Ok, Err, Some, None, Shader, Font, TextMeasurement, TextFormatOptions }
\ No newline at end of file
@@ -197,6 +197,15 @@ const raylibWrapperSymbols = {
     args: [FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.i32, FFIType.i32, FFIType.u32],
     returns: FFIType.void
   },
+  // Frustum culling of 3D primitive draws
+  SetPrimitiveCullingEnabled: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetPrimitiveCullingStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
   DrawPlaneWrapper: {
     args: [FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.u32],
     returns: FFIType.void
@@ -239,6 +248,23 @@ const wrapperSymbols = {
     args: [FFIType.ptr],
     returns: FFIType.i32
   },
+  // Asynchronous loading
+  LoadTextureAsync: {
+    args: [FFIType.ptr],
+    returns: FFIType.i32
+  },
+  UpdateTextureLoads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  GetTextureLoadStatus: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  GetTextureLoadProgress: {
+    args: [FFIType.ptr],
+    returns: FFIType.void
+  },
   GetTextureWidthBySlot: {
     args: [FFIType.i32],
     returns: FFIType.i32
@@ -259,6 +285,14 @@ const wrapperSymbols = {
     args: [FFIType.i32],
     returns: FFIType.u32
   },
+  BindTextureToUnitBySlot: {
+    args: [FFIType.i32, FFIType.i32],
+    returns: FFIType.bool
+  },
+  UnpinTextureBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
   UnloadTextureBySlot: {
     args: [FFIType.i32],
     returns: FFIType.void
@@ -279,6 +313,32 @@ const wrapperSymbols = {
     args: [],
     returns: FFIType.void
   },
+  // Deferred unloads
+  DrainTextureUnloads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  SetDeferredTextureUnload: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetTextureUnloadStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
+  // Memory budget
+  SetTextureMemoryBudget: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  EndTextureFrame: {
+    args: [],
+    returns: FFIType.i32
+  },
+  GetTextureMemoryStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
 };
 
 const modelWrapperSymbols = {
@@ -335,6 +395,86 @@ const modelWrapperSymbols = {
     args: [FFIType.i32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.u32],
     returns: FFIType.void
   },
+  SetModelCacheMode: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  GetModelRefCountBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.i32
+  },
+  LoadModelAsync: {
+    args: [FFIType.ptr],
+    returns: FFIType.i32
+  },
+  UpdateModelLoads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  GetModelLoadStatus: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  // Binary model cache
+  SetModelBinaryCache: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetModelBinaryCacheStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
+  // Deferred unloads
+  DrainModelUnloads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  SetDeferredModelUnload: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetModelUnloadStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
+  // Mesh optimization
+  SetModelMeshOptimization: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  OptimizeModelBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.i32
+  },
+  GetModelOptimizeStatsBySlot: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.void
+  },
+  // Level of detail
+  SetModelLodGeneration: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  GenerateModelLodsBySlot: {
+    args: [FFIType.i32, FFIType.i32],
+    returns: FFIType.i32
+  },
+  GetModelLodInfoBySlot: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.void
+  },
+  SetModelLodScreenSize: {
+    args: [FFIType.f32],
+    returns: FFIType.void
+  },
+  GetModelLodStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
+  DrawModelInstancedBySlot: {
+    args: [FFIType.i32, FFIType.ptr, FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
   GetLoadedModelCount: {
     args: [],
     returns: FFIType.i32
@@ -351,6 +491,94 @@ const modelWrapperSymbols = {
     args: [FFIType.ptr, FFIType.i32, FFIType.i32, FFIType.ptr, FFIType.ptr],
     returns: FFIType.void
   },
+  GetRayCollisionModel: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  RaycastBatch: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  BuildModelBVHBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.i32
+  },
+  // Shape queries against cached mesh BVHs
+  SphereCastModel: {
+    args: [FFIType.ptr, FFIType.f32, FFIType.f32, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  CapsuleCastModel: {
+    args: [FFIType.ptr, FFIType.ptr, FFIType.f32, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  ClosestPointOnModel: {
+    args: [FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  // Scene instances (top-level BVH over placed models)
+  CreateModelInstance: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  SetModelInstanceTransform: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.bool
+  },
+  RemoveModelInstance: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  ClearModelInstances: {
+    args: [],
+    returns: FFIType.void
+  },
+  GetModelInstanceCount: {
+    args: [],
+    returns: FFIType.i32
+  },
+  RaycastScene: {
+    args: [FFIType.ptr, FFIType.f32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  // Persistent cameras and screen-space picking
+  CreateCamera3DSlot: {
+    args: [FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.i32],
+    returns: FFIType.i32
+  },
+  SetCamera3DBySlot: {
+    args: [FFIType.i32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.f32, FFIType.i32],
+    returns: FFIType.bool
+  },
+  UnloadCamera3DSlot: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  BeginMode3DBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  GetScreenToWorldRayBySlot: {
+    args: [FFIType.i32, FFIType.f32, FFIType.f32, FFIType.ptr],
+    returns: FFIType.bool
+  },
+  PickSceneInstanceBySlot: {
+    args: [FFIType.i32, FFIType.f32, FFIType.f32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  PickSceneInstanceAtMouse: {
+    args: [FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  // Frustum culling of slot model draws
+  SetFrustumCullingEnabled: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetFrustumCullingStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
   // Optimized model functions - get multiple values in one call
   GetModelDataBySlot: {
     args: [FFIType.i32, FFIType.ptr],
@@ -360,6 +588,14 @@ const modelWrapperSymbols = {
     args: [FFIType.i32, FFIType.ptr],
     returns: FFIType.void
   },
+  GetModelMeshBoundsBySlot: {
+    args: [FFIType.i32, FFIType.ptr, FFIType.i32],
+    returns: FFIType.i32
+  },
+  GetModelBoundsBatch: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
 
   // Animation functions (integrated into model wrapper)
   LoadModelAnimationsToSlot: {
@@ -378,14 +614,58 @@ const modelWrapperSymbols = {
     args: [FFIType.i32, FFIType.i32, FFIType.i32, FFIType.i32],
     returns: FFIType.void
   },
+  SetNativeSkinningEnabled: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetSkinningThreadCount: {
+    args: [],
+    returns: FFIType.i32
+  },
+  UpdateAnimationsBatch: {
+    args: [FFIType.ptr, FFIType.i32],
+    returns: FFIType.i32
+  },
+  SetPoseCacheEnabled: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  ClearPoseCache: {
+    args: [],
+    returns: FFIType.void
+  },
+  GetPoseCacheStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
+  UpdateModelAnimationBlendBySlot: {
+    args: [FFIType.i32, FFIType.ptr, FFIType.i32],
+    returns: FFIType.bool
+  },
+  UpdateModelAnimationBonesBlendBySlot: {
+    args: [FFIType.i32, FFIType.ptr, FFIType.i32],
+    returns: FFIType.bool
+  },
+  BenchmarkModelSkinning: {
+    args: [FFIType.i32, FFIType.i32, FFIType.i32, FFIType.i32, FFIType.ptr],
+    returns: FFIType.bool
+  },
   UpdateModelAnimationBonesBySlot: {
     args: [FFIType.i32, FFIType.i32, FFIType.i32, FFIType.i32],
     returns: FFIType.void
   },
+  GetModelBonePaletteBySlot: {
+    args: [FFIType.i32, FFIType.i32, FFIType.ptr, FFIType.i32],
+    returns: FFIType.i32
+  },
   IsModelAnimationValidBySlot: {
     args: [FFIType.i32, FFIType.i32, FFIType.i32],
     returns: FFIType.bool
   },
+  CompressAnimationSlot: {
+    args: [FFIType.i32, FFIType.f32, FFIType.f32],
+    returns: FFIType.i32
+  },
   GetAnimationDataBySlot: {
     args: [FFIType.i32, FFIType.i32, FFIType.ptr],
     returns: FFIType.void
@@ -462,6 +742,19 @@ const renderTextureWrapperSymbols = {
     args: [],
     returns: FFIType.void
   },
+  // Deferred unloads
+  DrainRenderTextureUnloads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  SetDeferredRenderTextureUnload: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetRenderTextureUnloadStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
 };
 
 const rayCollisionWrapperSymbols = {
@@ -517,6 +810,34 @@ const rayCollisionWrapperSymbols = {
   },
 };
 
+const meshCollisionWrapperSymbols = {
+  // Prepared collision meshes (SoA triangle data, SIMD ray tests)
+  LoadCollisionMeshToSlot: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.ptr, FFIType.i32, FFIType.i32],
+    returns: FFIType.i32
+  },
+  UnloadCollisionMeshBySlot: {
+    args: [FFIType.i32],
+    returns: FFIType.void
+  },
+  GetCollisionMeshTriangleCount: {
+    args: [FFIType.i32],
+    returns: FFIType.i32
+  },
+  GetCollisionKernelWidth: {
+    args: [],
+    returns: FFIType.i32
+  },
+  GetRayCollisionMeshBySlot: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.ptr, FFIType.ptr],
+    returns: FFIType.i32
+  },
+  BenchmarkRayCollisionMesh: {
+    args: [FFIType.ptr, FFIType.i32, FFIType.ptr, FFIType.i32, FFIType.i32, FFIType.ptr, FFIType.i32, FFIType.ptr],
+    returns: FFIType.i32
+  },
+};
+
 const triangleWrapperSymbols = {
   // Triangle drawing functions
   DrawTriangleWrapper: {
@@ -547,12 +868,29 @@ const shaderWrapperSymbols = {
     args: [],
     returns: FFIType.void
   },
+  // Deferred unloads
+  DrainShaderUnloads: {
+    args: [FFIType.f32],
+    returns: FFIType.i32
+  },
+  SetDeferredShaderUnload: {
+    args: [FFIType.bool],
+    returns: FFIType.void
+  },
+  GetShaderUnloadStats: {
+    args: [FFIType.ptr, FFIType.bool],
+    returns: FFIType.void
+  },
 
   // Shader validation
   IsShaderSlotValid: {
     args: [FFIType.i32],
     returns: FFIType.bool
   },
+  GetShaderPointerFromSlot: {
+    args: [FFIType.i32],
+    returns: FFIType.ptr
+  },
   GetLoadedShaderCount: {
     args: [],
     returns: FFIType.i32
@@ -801,6 +1139,13 @@ export const initRaylib = (libraryPath?: string, config?: FFILoaderConfig) => {
       'ray-collision-wrapper'
     );
 
+    const meshCollisionWrapperLib = loadLibraryWithFallback(
+      libraryPaths.meshCollisionWrapper,
+      [prebuiltPaths.meshCollisionWrapper, systemPaths.meshCollisionWrapper, ...customFallbacks],
+      meshCollisionWrapperSymbols,
+      'mesh-collision-wrapper'
+    );
+
     const triangleWrapperLib = loadLibraryWithFallback(
       libraryPaths.triangleWrapper,
       [prebuiltPaths.triangleWrapper, systemPaths.triangleWrapper, ...customFallbacks],
@@ -831,6 +1176,7 @@ export const initRaylib = (libraryPath?: string, config?: FFILoaderConfig) => {
       ...renderTextureWrapperLib.symbols,
       ...modelWrapperLib.symbols,
       ...rayCollisionWrapperLib.symbols,
+      ...meshCollisionWrapperLib.symbols,
       ...triangleWrapperLib.symbols,
       ...shaderWrapperLib.symbols,
       ...fontWrapperLib.symbols
@@ -54,6 +54,32 @@ export interface Texture2D {
     format: number  // Data format (PixelFormat type)
 }
 
+// Pending loadTextureAsync call, polled with pollTextureLoad
+export interface TextureLoadRequest {
+    requestId: number      // Handle in the texture wrapper's request table
+}
+
+// Async texture loads since the last time none were in flight
+export interface TextureLoadProgress {
+    started: number        // Loads in the current batch
+    decoded: number        // Images decoded by the workers
+    uploaded: number       // Textures uploaded and ready to poll
+    failed: number         // Loads that could not be read, decoded or uploaded
+    fraction: number       // Finished share of the batch, 0 to 1
+}
+
+// Texture memory against the budget; evictions and reloads count since the
+// last getTextureMemoryStats() call
+export interface TextureMemoryStats {
+    residentMB: number     // Estimated GPU memory of resident textures
+    budgetMB: number       // 0 when there is no budget
+    resident: number       // Textures on the GPU
+    evicted: number        // Textures released until they are drawn again
+    evictions: number      // Textures evicted to meet the budget
+    reloads: number        // Evicted textures loaded again on use
+    pinned: number         // Textures whose id was handed out, never evicted
+}
+
 // RenderTexture2D structure matching Raylib's RenderTexture2D
 export interface RenderTexture2D {
     id: number          // OpenGL framebuffer object id
@@ -63,19 +89,56 @@ export interface RenderTexture2D {
 
 // Model structure using slot-based approach (like textures)
 export interface Model {
-    slotIndex: number      // Index in the model wrapper's slot array
+    slotIndex: number      // Handle in the model wrapper's slot table
     meshCount: number      // Number of meshes in the model
     materialCount: number  // Number of materials in the model
 }
 
 // ModelAnimation structure using slot-based approach
 export interface ModelAnimation {
-    slotIndex: number      // Index in the animation wrapper's slot array
+    slotIndex: number      // Handle in the animation wrapper's slot table
     frameCount: number     // Number of animation frames
     boneCount: number      // Number of bones in the animation
     name?: string          // Optional animation name
+    rawBytes?: number      // Size of the uncompressed frame poses
+    storedBytes?: number   // Size actually resident (smaller once compressed)
+}
+
+// One clip sampled for updateModelAnimationBlend / crossfadeModelAnimation
+export interface AnimationLayer {
+    animation: ModelAnimation  // Animation slot to sample
+    animIndex: number          // Animation within the slot
+    frame: number              // Fractional frame, interpolated between frames
+    weight?: number            // Relative blend weight (default 1)
+    loop?: boolean             // Wrap past the last frame back to frame 0
+}
+
+// Keyframe compression settings for loadModelAnimations
+export interface AnimationCompression {
+    translationTolerance?: number  // Max translation/scale error (default 0.001)
+    rotationTolerance?: number     // Max rotation error in radians (default 0.001)
 }
 
+// Timings from comparing raylib's UpdateModelAnimation with native skinning
+export interface SkinningBenchmark {
+    raylibMs: number       // UpdateModelAnimation (scalar, single thread)
+    nativeMs: number       // Bone palette + SIMD skinning over the job pool
+    maxError: number       // Largest difference between skinned positions
+    workerThreads: number  // Job pool threads helping the calling thread
+}
+
+// Pose cache counters since the last getPoseCacheStats() call
+export interface PoseCacheStats {
+    hits: number           // Updates that reused cached bone matrices
+    misses: number         // Updates that evaluated the animation frame
+    entries: number        // Poses currently cached
+}
+
+// Space of the matrices getModelBonePalette writes: bone transforms in the
+// space drawModelEx places (for attachments), or skinning matrices with the
+// bind pose removed (for custom skinning shaders)
+export type BonePaletteSpace = "model" | "skinning"
+
 // AnimationState helper interface for playback state management
 export interface AnimationState {
     animation: ModelAnimation  // The animation being played
@@ -105,13 +168,58 @@ export interface RayCollision {
     normal: { x: number; y: number; z: number }    // Surface normal of hit
 }
 
+// Closest hit over all meshes of a model
+export interface ModelRayCollision extends RayCollision {
+    meshIndex: number                              // Index of hit mesh, -1 on miss
+}
+
+// Contact from a sphere-cast, capsule-cast or closest-point query
+export interface ShapeCollision extends ModelRayCollision {
+    triangleIndex: number                          // Touched triangle in the mesh, -1 on miss
+    depth: number                                  // Penetration depth when already overlapping
+}
+
+// Model placed in the scene for instance-level ray queries
+export interface ModelInstance {
+    id: number             // Generational handle, stale once the instance is removed
+    model: Model           // Model the instance was placed from
+}
+
+// Closest hit over all scene instances
+export interface SceneRayCollision extends ModelRayCollision {
+    instanceId: number                             // Hit instance id, -1 on miss
+    triangleIndex: number                          // Hit triangle in the mesh, -1 on miss
+}
+
+// Camera stored on the native side, reused for drawing and picking
+export interface Camera3D {
+    slotIndex: number      // Handle in the model wrapper's camera slot table
+}
+
+// Frustum culling counters since the last getCullingStats() call
+export interface CullingStats {
+    culled: number         // Draws skipped because bounds were outside the frustum
+    drawn: number          // Draws that passed the frustum test
+    modelsCulled: number   // Part of culled coming from slot model draws
+    primitivesCulled: number // Part of culled coming from cube/sphere/cylinder/capsule draws
+}
+
 // Mesh structure (simplified for collision detection)
 export interface Mesh {
-    slotIndex: number      // Index in the mesh wrapper's slot array
+    slotIndex: number      // Handle in the mesh wrapper's slot table
     vertexCount: number    // Number of vertices stored in arrays
     triangleCount: number  // Number of triangles stored (indexed or not)
 }
 
+// Timings from comparing the per-triangle loop with the SIMD collision kernel
+export interface CollisionBenchmark {
+    gatherMs: number       // Per-triangle GetRayCollisionTriangle loop
+    simdMs: number         // Precomputed SoA kernel
+    prepareMs: number      // Time spent precomputing triangle data
+    kernelWidth: number    // Triangles per kernel iteration (8 AVX, 4 SSE, 1 scalar)
+    mismatches: number     // Rays where both paths disagreed
+}
+
 // Matrix structure matching Raylib's Matrix (4x4 matrix)
 export interface Matrix {
     m0: number; m4: number; m8: number; m12: number  // Matrix first row (4 components)
@@ -122,7 +230,7 @@ export interface Matrix {
 
 // Shader structure using slot-based approach
 export interface Shader {
-    slotIndex: number  // Index in the shader wrapper's slot array
+    slotIndex: number  // Handle in the shader wrapper's slot table
 }
 
 // BlendMode enum matching Raylib's BlendMode constants
@@ -139,7 +247,7 @@ export enum BlendMode {
 
 // Font structure using slot-based approach
 export interface Font {
-    slotIndex: number      // Index in the font wrapper's slot array
+    slotIndex: number      // Handle in the font wrapper's slot table
     baseSize: number       // Base size (default chars height)
     glyphCount: number     // Number of glyphs in the font
 }
@@ -168,4 +276,48 @@ export interface TextFormatOptions {
 }
 
 // Type aliases для Result types
-export type RaylibResult<T> = Result<T, RaylibError>
\ No newline at end of file
+export type RaylibResult<T> = Result<T, RaylibError>
+
+// How loadModel shares already loaded files: not at all, by canonical path
+// (default) or by file content
+export type ModelCacheMode = "off" | "path" | "content"
+
+// Resource kinds with a deferred unload queue
+export type UnloadQueueKind = "model" | "texture" | "renderTexture" | "shader"
+
+// One deferred unload queue; peak and released cover the time since the last
+// getUnloadQueueStats() call
+export interface UnloadQueueStats {
+    pending: number        // Resources waiting for release
+    peakPending: number    // Deepest the queue got
+    released: number       // Resources released by endDrawing() drains
+}
+
+// Binary model cache counters since the last getModelBinaryCacheStats() call
+export interface ModelBinaryCacheStats {
+    hits: number           // Loads served from a cache file
+    misses: number         // Loads that had to parse the model
+    writes: number         // Cache files written
+}
+
+// Result of the last mesh optimization pass over a model. ACMR is the
+// average number of vertex shader runs per triangle (0.5 ideal, 3 no reuse).
+export interface MeshOptimizeStats {
+    meshesOptimized: number
+    verticesBefore: number
+    verticesAfter: number
+    triangles: number
+    acmrBefore: number
+    acmrAfter: number
+}
+
+// Simplified levels of detail of a model
+export interface ModelLodInfo {
+    levelCount: number         // Levels generated (0-4)
+    triangleCounts: number[]   // Full detail first, then one entry per level
+}
+
+// Pending loadModelAsync call, polled with pollModelLoad
+export interface ModelLoadRequest {
+    requestId: number      // Handle in the model wrapper's request table
+}
\ No newline at end of file
@@ -0,0 +1,120 @@
+#ifndef WRAPPER_DEFERRED_UNLOAD_H
+#define WRAPPER_DEFERRED_UNLOAD_H
+
+// Queue of GPU resources whose release waits until the frame is done
+// (header-only: every wrapper is its own library, so each one owns the queue
+// it declares). An unload frees its slot right away, so the handle goes stale
+// at once, and hands the resource to the queue; the frame loop drains the
+// queues after EndDrawing within a time budget. Deleting GL objects mid-frame
+// can stall the driver, and a level change releasing hundreds of assets
+// would otherwise land in a single frame.
+//
+// Items are copied in by value into a ring buffer that grows by doubling.
+// If it cannot grow, or the queue is set to immediate, the resource is
+// released on the spot.
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+typedef void (*DeferredUnloadFunction)(void *resource);
+
+typedef struct {
+  size_t itemSize;
+  DeferredUnloadFunction unload;
+  unsigned char *items; // Ring buffer of capacity items
+  int head;             // Oldest item
+  int count;
+  int capacity;
+  bool immediate; // Release on push instead of queueing
+  int peakCount;  // Deepest the queue got since the last stats reset
+  int released;   // Released by drains since the last stats reset
+} DeferredUnloadQueue;
+
+#define DEFERRED_UNLOAD_QUEUE_INIT(type, fn)                                   \
+  {.itemSize = sizeof(type), .unload = (fn)}
+
+static inline void *DeferredUnloadItem(DeferredUnloadQueue *queue, int i) {
+  return queue->items + (size_t)((queue->head + i) % queue->capacity) *
+                            queue->itemSize;
+}
+
+// Double the ring buffer, oldest item first. False when out of memory.
+static inline bool DeferredUnloadGrow(DeferredUnloadQueue *queue) {
+  int capacity = queue->capacity > 0 ? queue->capacity * 2 : 16;
+  unsigned char *items = (unsigned char *)malloc(capacity * queue->itemSize);
+  if (items == NULL) {
+    return false;
+  }
+  for (int i = 0; i < queue->count; i++) {
+    memcpy(items + (size_t)i * queue->itemSize, DeferredUnloadItem(queue, i),
+           queue->itemSize);
+  }
+  free(queue->items);
+  queue->items = items;
+  queue->head = 0;
+  queue->capacity = capacity;
+  return true;
+}
+
+// Queue a resource (copied) for release by the next drain
+static inline void DeferredUnloadPush(DeferredUnloadQueue *queue,
+                                      void *resource) {
+  if (queue->immediate ||
+      (queue->count == queue->capacity && !DeferredUnloadGrow(queue))) {
+    queue->unload(resource);
+    return;
+  }
+  memcpy(DeferredUnloadItem(queue, queue->count), resource, queue->itemSize);
+  queue->count++;
+  if (queue->count > queue->peakCount) {
+    queue->peakCount = queue->count;
+  }
+}
+
+// Release queued resources, oldest first, until budgetMs has passed (at
+// least one per call so the queue always shrinks; a negative budget
+// releases everything). Returns the number released.
+static inline int DeferredUnloadDrain(DeferredUnloadQueue *queue,
+                                      float budgetMs) {
+  double start = GetTime();
+  int released = 0;
+  while (queue->count > 0) {
+    if (released > 0 && budgetMs >= 0.0f &&
+        (GetTime() - start) * 1000.0 >= budgetMs) {
+      break;
+    }
+    void *item = DeferredUnloadItem(queue, 0);
+    queue->head = (queue->head + 1) % queue->capacity;
+    queue->count--;
+    queue->unload(item); // Slot stays untouched until the next push
+    released++;
+  }
+  queue->released += released;
+  return released;
+}
+
+// Queue immediately (true) or defer releases to the drains (false).
+// Switching to immediate releases everything still queued.
+static inline void DeferredUnloadSetImmediate(DeferredUnloadQueue *queue,
+                                              bool immediate) {
+  queue->immediate = immediate;
+  if (immediate) {
+    DeferredUnloadDrain(queue, -1.0f);
+  }
+}
+
+// [queued now, peak queued, released by drains] since the last reset
+static inline void DeferredUnloadStats(DeferredUnloadQueue *queue,
+                                       int *outBuffer, bool reset) {
+  outBuffer[0] = queue->count;
+  outBuffer[1] = queue->peakCount;
+  outBuffer[2] = queue->released;
+  if (reset) {
+    queue->peakCount = queue->count;
+    queue->released = 0;
+  }
+}
+
+#endif // WRAPPER_DEFERRED_UNLOAD_H
@@ -0,0 +1,95 @@
+#ifndef WRAPPER_FRUSTUM_H
+#define WRAPPER_FRUSTUM_H
+
+// View frustum taken from the matrices rlgl will draw with (current transform,
+// modelview and projection), so it matches whatever camera BeginMode3D set up,
+// no matter which wrapper library made the call.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include <math.h>
+#include <stdbool.h>
+
+// Plane: dot(normal, p) + d >= 0 is inside
+typedef struct {
+  Vector3 normal;
+  float d;
+} FrustumPlane;
+
+typedef struct {
+  FrustumPlane planes[6]; // left, right, bottom, top, near, far
+} Frustum;
+
+// Culling counters, reset by the caller once per frame
+typedef struct {
+  int culled;
+  int drawn;
+} FrustumCullStats;
+
+static inline FrustumPlane FrustumMakePlane(float a, float b, float c,
+                                            float d) {
+  float len = sqrtf(a * a + b * b + c * c);
+  if (len > 0.0f) {
+    a /= len;
+    b /= len;
+    c /= len;
+    d /= len;
+  }
+  return (FrustumPlane){{a, b, c}, d};
+}
+
+// Gribb-Hartmann plane extraction from a view-projection matrix
+static inline Frustum FrustumFromMatrix(Matrix m) {
+  Frustum f;
+  f.planes[0] = FrustumMakePlane(m.m3 + m.m0, m.m7 + m.m4, m.m11 + m.m8,
+                                 m.m15 + m.m12); // left
+  f.planes[1] = FrustumMakePlane(m.m3 - m.m0, m.m7 - m.m4, m.m11 - m.m8,
+                                 m.m15 - m.m12); // right
+  f.planes[2] = FrustumMakePlane(m.m3 + m.m1, m.m7 + m.m5, m.m11 + m.m9,
+                                 m.m15 + m.m13); // bottom
+  f.planes[3] = FrustumMakePlane(m.m3 - m.m1, m.m7 - m.m5, m.m11 - m.m9,
+                                 m.m15 - m.m13); // top
+  f.planes[4] = FrustumMakePlane(m.m3 + m.m2, m.m7 + m.m6, m.m11 + m.m10,
+                                 m.m15 + m.m14); // near
+  f.planes[5] = FrustumMakePlane(m.m3 - m.m2, m.m7 - m.m6, m.m11 - m.m10,
+                                 m.m15 - m.m14); // far
+  return f;
+}
+
+// Frustum of the current rlgl state (call between BeginMode3D/EndMode3D)
+static inline Frustum FrustumFromCurrentMatrices(void) {
+  Matrix viewProj = MatrixMultiply(
+      MatrixMultiply(rlGetMatrixTransform(), rlGetMatrixModelview()),
+      rlGetMatrixProjection());
+  return FrustumFromMatrix(viewProj);
+}
+
+// Conservative box test: false only if the box is fully outside one plane
+static inline bool FrustumContainsBox(const Frustum *f, BoundingBox box) {
+  for (int i = 0; i < 6; i++) {
+    Vector3 n = f->planes[i].normal;
+    // Corner farthest along the plane normal
+    Vector3 p = {n.x >= 0.0f ? box.max.x : box.min.x,
+                 n.y >= 0.0f ? box.max.y : box.min.y,
+                 n.z >= 0.0f ? box.max.z : box.min.z};
+    if (n.x * p.x + n.y * p.y + n.z * p.z + f->planes[i].d < 0.0f) {
+      return false;
+    }
+  }
+  return true;
+}
+
+static inline bool FrustumContainsSphere(const Frustum *f, Vector3 center,
+                                         float radius) {
+  for (int i = 0; i < 6; i++) {
+    Vector3 n = f->planes[i].normal;
+    if (n.x * center.x + n.y * center.y + n.z * center.z + f->planes[i].d <
+        -radius) {
+      return false;
+    }
+  }
+  return true;
+}
+
+#endif // WRAPPER_FRUSTUM_H
@@ -0,0 +1,161 @@
+#ifndef WRAPPER_HANDLE_TABLE_H
+#define WRAPPER_HANDLE_TABLE_H
+
+// Growable slot table shared by the wrappers (header-only: every wrapper is
+// its own library, so each one owns the tables it declares).
+//
+// Handles are (generation << HANDLE_INDEX_BITS) | index. Freeing a slot bumps
+// its generation, so a handle kept after unload no longer resolves even once
+// the index is reused. Generations start at 1, which keeps 0 and other small
+// raw numbers invalid, and stay below 256 so handles fit in 24 bits and
+// survive the Float32 batch buffers exactly. Rather than wrap around, which
+// would make the oldest stale handles valid again, a slot whose generation
+// is used up is retired: it never goes back on the free list and the table
+// grows past it instead.
+//
+// Items live in fixed-size pages that are never moved, so pointers returned by
+// HandleTableGet stay valid while the slot is live, however far the table
+// grows. Allocation pops a free list and the live count is kept as a counter,
+// both O(1).
+
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define HANDLE_INDEX_BITS 16
+#define HANDLE_INDEX_MASK ((1 << HANDLE_INDEX_BITS) - 1)
+#define HANDLE_MAX_GENERATION 255
+#define HANDLE_PAGE_SIZE 64
+#define HANDLE_MAX_ITEMS (HANDLE_INDEX_MASK + 1)
+
+typedef struct {
+  size_t itemSize;
+  unsigned char **pages;        // HANDLE_PAGE_SIZE items each
+  unsigned char *generations;   // Current generation per index
+  bool *live;
+  int *nextFree;                // Free list link per index, -1 ends the list
+  int freeHead;
+  int capacity;
+  int liveCount;
+} HandleTable;
+
+#define HANDLE_TABLE_INIT(type) {.itemSize = sizeof(type), .freeHead = -1}
+
+static inline int HandleTableIndex(int handle) {
+  return handle < 0 ? -1 : (handle & HANDLE_INDEX_MASK);
+}
+
+static inline void *HandleTableItem(HandleTable *table, int index) {
+  return table->pages[index / HANDLE_PAGE_SIZE] +
+         (size_t)(index % HANDLE_PAGE_SIZE) * table->itemSize;
+}
+
+// Add one page of free slots. Returns false when out of memory or indices
+static inline bool HandleTableGrow(HandleTable *table) {
+  int oldCapacity = table->capacity;
+  int newCapacity = oldCapacity + HANDLE_PAGE_SIZE;
+  if (newCapacity > HANDLE_MAX_ITEMS) {
+    return false;
+  }
+
+  int pageCount = newCapacity / HANDLE_PAGE_SIZE;
+  unsigned char **pages =
+      realloc(table->pages, pageCount * sizeof(unsigned char *));
+  if (!pages) {
+    return false;
+  }
+  table->pages = pages;
+  pages[pageCount - 1] = calloc(HANDLE_PAGE_SIZE, table->itemSize);
+  if (!pages[pageCount - 1]) {
+    return false;
+  }
+
+  unsigned char *generations = realloc(table->generations, newCapacity);
+  bool *live = realloc(table->live, newCapacity * sizeof(bool));
+  int *nextFree = realloc(table->nextFree, newCapacity * sizeof(int));
+  if (generations) table->generations = generations;
+  if (live) table->live = live;
+  if (nextFree) table->nextFree = nextFree;
+  if (!generations || !live || !nextFree) {
+    free(pages[pageCount - 1]);
+    return false;
+  }
+
+  // Link the new page in index order so low indices are handed out first
+  for (int i = newCapacity - 1; i >= oldCapacity; i--) {
+    generations[i] = 1;
+    live[i] = false;
+    nextFree[i] = table->freeHead;
+    table->freeHead = i;
+  }
+  table->capacity = newCapacity;
+  return true;
+}
+
+// Claim a zeroed slot and return its handle, or -1 when memory runs out
+static inline int HandleTableAlloc(HandleTable *table) {
+  if (table->freeHead < 0 && !HandleTableGrow(table)) {
+    return -1;
+  }
+
+  int index = table->freeHead;
+  table->freeHead = table->nextFree[index];
+  table->live[index] = true;
+  table->liveCount++;
+  memset(HandleTableItem(table, index), 0, table->itemSize);
+  return (table->generations[index] << HANDLE_INDEX_BITS) | index;
+}
+
+// Live item for a handle, NULL for invalid, freed or stale handles
+static inline void *HandleTableGet(HandleTable *table, int handle) {
+  int index = HandleTableIndex(handle);
+  if (index < 0 || index >= table->capacity || !table->live[index] ||
+      table->generations[index] != (handle >> HANDLE_INDEX_BITS)) {
+    return NULL;
+  }
+  return HandleTableItem(table, index);
+}
+
+// Release a slot; its handle and every copy of it become stale
+static inline bool HandleTableFree(HandleTable *table, int handle) {
+  if (!HandleTableGet(table, handle)) {
+    return false;
+  }
+
+  int index = HandleTableIndex(handle);
+  table->live[index] = false;
+  table->liveCount--;
+  if (table->generations[index] >= HANDLE_MAX_GENERATION) {
+    return true; // Retired: every generation has been handed out
+  }
+  table->generations[index]++;
+  table->nextFree[index] = table->freeHead;
+  table->freeHead = index;
+  return true;
+}
+
+static inline int HandleTableCount(const HandleTable *table) {
+  return table->liveCount;
+}
+
+// Indices run 0..capacity-1; use with HandleTableAt to walk live slots
+static inline int HandleTableCapacity(const HandleTable *table) {
+  return table->capacity;
+}
+
+static inline void *HandleTableAt(HandleTable *table, int index) {
+  if (index < 0 || index >= table->capacity || !table->live[index]) {
+    return NULL;
+  }
+  return HandleTableItem(table, index);
+}
+
+// Handle of the live slot at an index, -1 when the slot is free
+static inline int HandleTableHandleAt(const HandleTable *table, int index) {
+  if (index < 0 || index >= table->capacity || !table->live[index]) {
+    return -1;
+  }
+  return (table->generations[index] << HANDLE_INDEX_BITS) | index;
+}
+
+#endif // WRAPPER_HANDLE_TABLE_H
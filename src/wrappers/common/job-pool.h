@@ -0,0 +1,310 @@
+#ifndef WRAPPER_JOB_POOL_H
+#define WRAPPER_JOB_POOL_H
+
+// Small worker pool shared by the wrapper libraries (each library gets its own
+// copy of the statics). Two kinds of work:
+//   - JobPoolParallelFor: data-parallel loop, the calling thread takes part and
+//     returns once every chunk is done. One loop at a time, main thread only.
+//   - JobPoolSubmit: fire-and-forget background job (file parsing, decoding).
+//     The queue grows as needed; a job is never run on the submitting thread.
+// Workers prefer parallel-for chunks over queued jobs so a long background job
+// never holds up a frame for longer than the chunk it is already running.
+//
+// Threads start lazily on first use. Without a worker (single core or thread
+// creation failure) parallel-for loops run inline on the caller and
+// JobPoolSubmit refuses the job, leaving it to the caller.
+
+#include <stdbool.h>
+#include <stdlib.h>
+
+#define JOB_POOL_MAX_THREADS 16
+#define JOB_POOL_INITIAL_QUEUE 64
+
+#ifdef _WIN32
+// windows.h clashes with raylib.h (CloseWindow, Rectangle, DrawText...), so
+// declare the few kernel32 entry points used here. SRWLOCK and
+// CONDITION_VARIABLE are a single pointer initialized to zero.
+typedef struct {
+  void *ptr;
+} JobLock;
+typedef struct {
+  void *ptr;
+} JobCond;
+typedef void *JobThread;
+
+__declspec(dllimport) void __stdcall AcquireSRWLockExclusive(JobLock *lock);
+__declspec(dllimport) void __stdcall ReleaseSRWLockExclusive(JobLock *lock);
+__declspec(dllimport) int __stdcall SleepConditionVariableSRW(
+    JobCond *cond, JobLock *lock, unsigned long ms, unsigned long flags);
+__declspec(dllimport) void __stdcall WakeConditionVariable(JobCond *cond);
+__declspec(dllimport) void __stdcall WakeAllConditionVariable(JobCond *cond);
+__declspec(dllimport) void *__stdcall CreateThread(
+    void *attributes, size_t stackSize, unsigned long(__stdcall *start)(void *),
+    void *param, unsigned long flags, unsigned long *threadId);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+__declspec(dllimport) unsigned long __stdcall GetActiveProcessorCount(
+    unsigned short group);
+
+#define JOB_LOCK_INIT {0}
+#define JOB_COND_INIT {0}
+static inline void JobLockAcquire(JobLock *lock) {
+  AcquireSRWLockExclusive(lock);
+}
+static inline void JobLockRelease(JobLock *lock) {
+  ReleaseSRWLockExclusive(lock);
+}
+static inline void JobCondWait(JobCond *cond, JobLock *lock) {
+  SleepConditionVariableSRW(cond, lock, 0xFFFFFFFFUL, 0);
+}
+static inline void JobCondSignal(JobCond *cond) { WakeConditionVariable(cond); }
+static inline void JobCondBroadcast(JobCond *cond) {
+  WakeAllConditionVariable(cond);
+}
+static inline int JobHardwareThreads(void) {
+  return (int)GetActiveProcessorCount(0xFFFF); // ALL_PROCESSOR_GROUPS
+}
+#else
+#include <pthread.h>
+#include <unistd.h>
+
+typedef pthread_mutex_t JobLock;
+typedef pthread_cond_t JobCond;
+typedef pthread_t JobThread;
+
+#define JOB_LOCK_INIT PTHREAD_MUTEX_INITIALIZER
+#define JOB_COND_INIT PTHREAD_COND_INITIALIZER
+static inline void JobLockAcquire(JobLock *lock) { pthread_mutex_lock(lock); }
+static inline void JobLockRelease(JobLock *lock) { pthread_mutex_unlock(lock); }
+static inline void JobCondWait(JobCond *cond, JobLock *lock) {
+  pthread_cond_wait(cond, lock);
+}
+static inline void JobCondSignal(JobCond *cond) { pthread_cond_signal(cond); }
+static inline void JobCondBroadcast(JobCond *cond) {
+  pthread_cond_broadcast(cond);
+}
+static inline int JobHardwareThreads(void) {
+  return (int)sysconf(_SC_NPROCESSORS_ONLN);
+}
+#endif
+
+// Processes items [begin, end) of a parallel-for
+typedef void (*JobRangeFunction)(void *data, int begin, int end);
+// Background job
+typedef void (*JobFunction)(void *data);
+
+typedef struct {
+  JobFunction function;
+  void *data;
+} Job;
+
+typedef struct {
+  JobLock lock;
+  JobCond workAvailable; // Workers: new chunks or queued jobs
+  JobCond rangeDone;     // Caller of JobPoolParallelFor: last chunk finished
+  bool started;
+  int threadCount; // Worker threads actually running
+
+  // Background job ring buffer, doubled when full
+  Job *queue;
+  int queueHead;
+  int queueCount;
+  int queueCapacity;
+
+  // Active parallel-for, if any
+  JobRangeFunction rangeFunction;
+  void *rangeData;
+  int rangeCount;
+  int rangeGrain;
+  int rangeNext;    // Next unclaimed item
+  int rangeRunning; // Chunks claimed but not finished
+} JobPool;
+
+static JobPool jobPool = {.lock = JOB_LOCK_INIT,
+                          .workAvailable = JOB_COND_INIT,
+                          .rangeDone = JOB_COND_INIT};
+
+// Claim the next parallel-for chunk. Lock must be held.
+static inline bool JobPoolClaimChunk(int *begin, int *end) {
+  if (jobPool.rangeFunction == NULL ||
+      jobPool.rangeNext >= jobPool.rangeCount) {
+    return false;
+  }
+  *begin = jobPool.rangeNext;
+  *end = *begin + jobPool.rangeGrain;
+  if (*end > jobPool.rangeCount) {
+    *end = jobPool.rangeCount;
+  }
+  jobPool.rangeNext = *end;
+  jobPool.rangeRunning++;
+  return true;
+}
+
+// Run a claimed chunk with the lock released, then mark it done
+static inline void JobPoolRunChunk(int begin, int end) {
+  JobRangeFunction function = jobPool.rangeFunction;
+  void *data = jobPool.rangeData;
+  JobLockRelease(&jobPool.lock);
+  function(data, begin, end);
+  JobLockAcquire(&jobPool.lock);
+  jobPool.rangeRunning--;
+  if (jobPool.rangeRunning == 0 && jobPool.rangeNext >= jobPool.rangeCount) {
+    JobCondSignal(&jobPool.rangeDone);
+  }
+}
+
+static inline void JobPoolWorkerLoop(void) {
+  JobLockAcquire(&jobPool.lock);
+  for (;;) {
+    int begin, end;
+    if (JobPoolClaimChunk(&begin, &end)) {
+      JobPoolRunChunk(begin, end);
+      continue;
+    }
+    if (jobPool.queueCount > 0) {
+      Job job = jobPool.queue[jobPool.queueHead];
+      jobPool.queueHead = (jobPool.queueHead + 1) % jobPool.queueCapacity;
+      jobPool.queueCount--;
+      JobLockRelease(&jobPool.lock);
+      job.function(job.data);
+      JobLockAcquire(&jobPool.lock);
+      continue;
+    }
+    JobCondWait(&jobPool.workAvailable, &jobPool.lock);
+  }
+}
+
+#ifdef _WIN32
+static unsigned long __stdcall JobPoolThreadMain(void *arg) {
+  (void)arg;
+  JobPoolWorkerLoop();
+  return 0;
+}
+#else
+static void *JobPoolThreadMain(void *arg) {
+  (void)arg;
+  JobPoolWorkerLoop();
+  return NULL;
+}
+#endif
+
+// Start workers on first use: one per hardware thread minus the caller.
+// Lock must be held.
+static inline void JobPoolStart(void) {
+  if (jobPool.started) {
+    return;
+  }
+  jobPool.started = true;
+
+  int wanted = JobHardwareThreads() - 1;
+  if (wanted > JOB_POOL_MAX_THREADS) {
+    wanted = JOB_POOL_MAX_THREADS;
+  }
+  for (int i = 0; i < wanted; i++) {
+#ifdef _WIN32
+    JobThread thread = CreateThread(NULL, 0, JobPoolThreadMain, NULL, 0, NULL);
+    if (thread == NULL) {
+      break;
+    }
+    CloseHandle(thread); // Workers run detached
+#else
+    JobThread thread;
+    if (pthread_create(&thread, NULL, JobPoolThreadMain, NULL) != 0) {
+      break;
+    }
+    pthread_detach(thread);
+#endif
+    jobPool.threadCount++;
+  }
+}
+
+// Number of worker threads (0 means everything runs on the caller)
+static inline int JobPoolThreadCount(void) {
+  JobLockAcquire(&jobPool.lock);
+  JobPoolStart();
+  int count = jobPool.threadCount;
+  JobLockRelease(&jobPool.lock);
+  return count;
+}
+
+// Call function over [0, count) in chunks of grain items, spread over the
+// workers and the calling thread. Returns after all chunks have finished.
+static inline void JobPoolParallelFor(JobRangeFunction function, void *data,
+                                      int count, int grain) {
+  if (count <= 0) {
+    return;
+  }
+  if (grain < 1) {
+    grain = 1;
+  }
+  if (count <= grain) {
+    function(data, 0, count);
+    return;
+  }
+
+  JobLockAcquire(&jobPool.lock);
+  JobPoolStart();
+  if (jobPool.threadCount == 0) {
+    JobLockRelease(&jobPool.lock);
+    function(data, 0, count);
+    return;
+  }
+
+  jobPool.rangeFunction = function;
+  jobPool.rangeData = data;
+  jobPool.rangeCount = count;
+  jobPool.rangeGrain = grain;
+  jobPool.rangeNext = 0;
+  jobPool.rangeRunning = 0;
+  JobCondBroadcast(&jobPool.workAvailable);
+
+  int begin, end;
+  while (JobPoolClaimChunk(&begin, &end)) {
+    JobPoolRunChunk(begin, end);
+  }
+  while (jobPool.rangeRunning > 0) {
+    JobCondWait(&jobPool.rangeDone, &jobPool.lock);
+  }
+  jobPool.rangeFunction = NULL;
+  jobPool.rangeData = NULL;
+  JobLockRelease(&jobPool.lock);
+}
+
+// Double the job ring buffer, oldest job first. Lock must be held.
+static inline bool JobPoolGrowQueue(void) {
+  int capacity = jobPool.queueCapacity > 0 ? jobPool.queueCapacity * 2
+                                           : JOB_POOL_INITIAL_QUEUE;
+  Job *queue = (Job *)malloc(sizeof(Job) * (size_t)capacity);
+  if (queue == NULL) {
+    return false;
+  }
+  for (int i = 0; i < jobPool.queueCount; i++) {
+    queue[i] = jobPool.queue[(jobPool.queueHead + i) % jobPool.queueCapacity];
+  }
+  free(jobPool.queue);
+  jobPool.queue = queue;
+  jobPool.queueHead = 0;
+  jobPool.queueCapacity = capacity;
+  return true;
+}
+
+// Queue a background job. Returns false, without running it, when there are
+// no workers or the queue cannot grow: the caller still owns the work and
+// retries later or does it itself when it can afford to.
+static inline bool JobPoolSubmit(JobFunction function, void *data) {
+  JobLockAcquire(&jobPool.lock);
+  JobPoolStart();
+  if (jobPool.threadCount == 0 ||
+      (jobPool.queueCount == jobPool.queueCapacity && !JobPoolGrowQueue())) {
+    JobLockRelease(&jobPool.lock);
+    return false;
+  }
+  int tail = (jobPool.queueHead + jobPool.queueCount) % jobPool.queueCapacity;
+  jobPool.queue[tail].function = function;
+  jobPool.queue[tail].data = data;
+  jobPool.queueCount++;
+  JobCondSignal(&jobPool.workAvailable);
+  JobLockRelease(&jobPool.lock);
+  return true;
+}
+
+#endif // WRAPPER_JOB_POOL_H
@@ -1,4 +1,5 @@
 #include "raylib.h"
+#include "../common/handle-table.h"
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,17 +11,15 @@
 #define EXPORT
 #endif
 
-#define MAX_FONTS 32
-
 // Font storage with metadata
 typedef struct {
   Font font;
-  bool isLoaded;
   int baseSize;
   int glyphCount;
 } FontSlot;
 
-static FontSlot fontSlots[MAX_FONTS] = {0};
+// Slot handles are generational: stale handles of unloaded fonts fail
+static HandleTable fontSlots = HANDLE_TABLE_INIT(FontSlot);
 
 // Helper function to convert uint32 color to Color struct
 static Color ColorFromU32(unsigned int color) {
@@ -32,14 +31,9 @@ static Color ColorFromU32(unsigned int color) {
   };
 }
 
-// Find free slot for new font
-static int FindFreeFontSlot() {
-  for (int i = 0; i < MAX_FONTS; i++) {
-    if (!fontSlots[i].isLoaded) {
-      return i;
-    }
-  }
-  return -1; // No free slots
+// Live slot for a handle, NULL when invalid or unloaded
+static FontSlot *GetFontSlot(int slotIndex) {
+  return HandleTableGet(&fontSlots, slotIndex);
 }
 // Load font and return slot index
 EXPORT int LoadFontToSlot(const char *fileName, int fontSize) {
@@ -47,69 +41,56 @@ EXPORT int LoadFontToSlot(const char *fileName, int fontSize) {
     return -1; // Invalid parameters
   }
 
-  int slotIndex = FindFreeFontSlot();
-  if (slotIndex == -1) {
-    return -1; // No free slots
-  }
-
   Font font = LoadFontEx(fileName, fontSize, NULL, 0);
   if (font.texture.id == 0) {
     return -1; // Failed to load
   }
 
-  fontSlots[slotIndex].font = font;
-  fontSlots[slotIndex].isLoaded = true;
-  fontSlots[slotIndex].baseSize = font.baseSize;
-  fontSlots[slotIndex].glyphCount = font.glyphCount;
+  int slotIndex = HandleTableAlloc(&fontSlots);
+  if (slotIndex == -1) {
+    UnloadFont(font);
+    return -1; // Out of memory
+  }
+
+  FontSlot *slot = GetFontSlot(slotIndex);
+  slot->font = font;
+  slot->baseSize = font.baseSize;
+  slot->glyphCount = font.glyphCount;
 
   return slotIndex;
 }
 
 // Unload font by slot index
 EXPORT void UnloadFontBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot) {
     return;
   }
 
-  UnloadFont(fontSlots[slotIndex].font);
-  fontSlots[slotIndex].isLoaded = false;
-  fontSlots[slotIndex].font = (Font){0};
-  fontSlots[slotIndex].baseSize = 0;
-  fontSlots[slotIndex].glyphCount = 0;
+  UnloadFont(slot->font);
+  HandleTableFree(&fontSlots, slotIndex);
 }
 
 // Check if font slot is valid
 EXPORT bool IsFontSlotValid(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS) {
-    return false;
-  }
-  return fontSlots[slotIndex].isLoaded;
+  return GetFontSlot(slotIndex) != NULL;
 }
 
 // Get number of loaded fonts
 EXPORT int GetLoadedFontCount() {
-  int count = 0;
-  for (int i = 0; i < MAX_FONTS; i++) {
-    if (fontSlots[i].isLoaded) {
-      count++;
-    }
-  }
-  return count;
+  return HandleTableCount(&fontSlots);
 }
 
 // Unload all fonts
 EXPORT void UnloadAllFonts() {
-  for (int i = 0; i < MAX_FONTS; i++) {
-    if (fontSlots[i].isLoaded) {
-      UnloadFontBySlot(i);
-    }
+  for (int i = 0; i < HandleTableCapacity(&fontSlots); i++) {
+    UnloadFontBySlot(HandleTableHandleAt(&fontSlots, i));
   }
 }
 // Get font data by slot index (returns baseSize and glyphCount in outBuffer)
 EXPORT void GetFontDataBySlot(int slotIndex, int *outBuffer) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded || outBuffer == NULL) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot || outBuffer == NULL) {
     if (outBuffer != NULL) {
       outBuffer[0] = 0;
       outBuffer[1] = 0;
@@ -117,33 +98,32 @@ EXPORT void GetFontDataBySlot(int slotIndex, int *outBuffer) {
     return;
   }
 
-  outBuffer[0] = fontSlots[slotIndex].baseSize;
-  outBuffer[1] = fontSlots[slotIndex].glyphCount;
+  outBuffer[0] = slot->baseSize;
+  outBuffer[1] = slot->glyphCount;
 }
 
 // Get font base size
 EXPORT int GetFontBaseSize(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot) {
     return 0;
   }
-  return fontSlots[slotIndex].baseSize;
+  return slot->baseSize;
 }
 
 // Get font glyph count
 EXPORT int GetFontGlyphCount(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot) {
     return 0;
   }
-  return fontSlots[slotIndex].glyphCount;
+  return slot->glyphCount;
 }
 // Measure text by slot index (returns width and height in outBuffer)
 EXPORT void MeasureTextBySlot(int slotIndex, const char *text, float fontSize,
                               float spacing, float *outBuffer) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded || text == NULL || outBuffer == NULL ||
-      fontSize <= 0) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot || text == NULL || outBuffer == NULL || fontSize <= 0) {
     if (outBuffer != NULL) {
       outBuffer[0] = 0.0f;
       outBuffer[1] = 0.0f;
@@ -158,8 +138,7 @@ EXPORT void MeasureTextBySlot(int slotIndex, const char *text, float fontSize,
     return;
   }
 
-  Vector2 measurement =
-      MeasureTextEx(fontSlots[slotIndex].font, text, fontSize, spacing);
+  Vector2 measurement = MeasureTextEx(slot->font, text, fontSize, spacing);
   outBuffer[0] = measurement.x;
   outBuffer[1] = measurement.y;
 }
@@ -167,8 +146,8 @@ EXPORT void MeasureTextBySlot(int slotIndex, const char *text, float fontSize,
 EXPORT void DrawTextBySlot(int slotIndex, const char *text, float posX,
                            float posY, float fontSize, float spacing,
                            unsigned int color) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded || text == NULL || fontSize <= 0) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot || text == NULL || fontSize <= 0) {
     return;
   }
 
@@ -180,16 +159,15 @@ EXPORT void DrawTextBySlot(int slotIndex, const char *text, float posX,
   Vector2 position = {posX, posY};
   Color tint = ColorFromU32(color);
 
-  DrawTextEx(fontSlots[slotIndex].font, text, position, fontSize, spacing,
-             tint);
+  DrawTextEx(slot->font, text, position, fontSize, spacing, tint);
 }
 // Wrap text by slot index
 EXPORT int WrapTextBySlot(int slotIndex, const char *text, float fontSize,
                           float spacing, float maxWidth, char *outBuffer,
                           int bufferSize) {
-  if (slotIndex < 0 || slotIndex >= MAX_FONTS ||
-      !fontSlots[slotIndex].isLoaded || text == NULL || outBuffer == NULL ||
-      fontSize <= 0 || maxWidth <= 0 || bufferSize <= 0) {
+  FontSlot *slot = GetFontSlot(slotIndex);
+  if (!slot || text == NULL || outBuffer == NULL || fontSize <= 0 ||
+      maxWidth <= 0 || bufferSize <= 0) {
     return -1;
   }
 
@@ -199,7 +177,7 @@ EXPORT int WrapTextBySlot(int slotIndex, const char *text, float fontSize,
     return 0;
   }
 
-  Font font = fontSlots[slotIndex].font;
+  Font font = slot->font;
   int lineCount = 0;
   int outIndex = 0;
   int textLen = strlen(text);
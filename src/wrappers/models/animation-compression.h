@@ -0,0 +1,428 @@
+#ifndef ANIMATION_COMPRESSION_H
+#define ANIMATION_COMPRESSION_H
+
+// Compressed storage for ModelAnimation frame poses. Every bone has three
+// tracks (translation, rotation, scale):
+//   - tracks that stay within tolerance of their first value keep one key
+//   - other tracks keep only the frames needed so that linear interpolation
+//     between kept keys (nlerp for rotations) stays within tolerance
+//   - rotations are stored as 4 normalized 16-bit integers
+// Sampling reconstructs a full Transform per bone for any (fractional) frame;
+// the SSE path decodes rotations and interpolates 4 lanes at a time.
+
+#include "raylib.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define ANIM_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+
+#define ANIM_TRACK_TRANSLATION 0
+#define ANIM_TRACK_ROTATION 1
+#define ANIM_TRACK_SCALE 2
+#define ANIM_ROTATION_RANGE 32767.0f
+#define ANIM_MAX_FRAMES 65535 // Key frame indices are 16-bit
+
+typedef struct {
+  int keyCount;    // 1 means constant for the whole clip
+  int keyOffset;   // First index in keyFrames (unused for constant tracks)
+  int valueOffset; // First key in vectorKeys or rotationKeys
+} AnimationTrack;
+
+typedef struct {
+  int boneCount;
+  int frameCount;
+  AnimationTrack *tracks;    // 3 per bone: translation, rotation, scale
+  unsigned short *keyFrames; // Frame of every key of non-constant tracks
+  float *vectorKeys;         // 3 floats per key, one float of padding at end
+  short *rotationKeys;       // 4 per key: x, y, z, w scaled to 16 bits
+  size_t storedBytes;        // Memory used by this structure
+} CompressedAnimation;
+
+// Growable array used while building
+typedef struct {
+  void *data;
+  int count;
+  int capacity;
+  size_t elementSize;
+} AnimKeyBuffer;
+
+static void *AnimKeyBufferPush(AnimKeyBuffer *buffer, int count) {
+  if (buffer->count + count > buffer->capacity) {
+    int capacity = buffer->capacity > 0 ? buffer->capacity * 2 : 256;
+    while (capacity < buffer->count + count) {
+      capacity *= 2;
+    }
+    void *data = realloc(buffer->data, (size_t)capacity * buffer->elementSize);
+    if (data == NULL) {
+      return NULL;
+    }
+    buffer->data = data;
+    buffer->capacity = capacity;
+  }
+  void *slot = (char *)buffer->data + (size_t)buffer->count * buffer->elementSize;
+  buffer->count += count;
+  return slot;
+}
+
+static inline short AnimQuantizeUnit(float v) {
+  float scaled = v * ANIM_ROTATION_RANGE;
+  if (scaled > ANIM_ROTATION_RANGE)
+    scaled = ANIM_ROTATION_RANGE;
+  if (scaled < -ANIM_ROTATION_RANGE)
+    scaled = -ANIM_ROTATION_RANGE;
+  return (short)lroundf(scaled);
+}
+
+static inline void AnimNormalize4(float *q) {
+  float len = sqrtf(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+  if (len > 0.0f) {
+    float inv = 1.0f / len;
+    q[0] *= inv;
+    q[1] *= inv;
+    q[2] *= inv;
+    q[3] *= inv;
+  }
+}
+
+// Interpolate two keys: lerp for vectors, nlerp along the short arc for
+// rotations. Same reconstruction the sampler uses.
+static inline void AnimInterpolate(const float *a, const float *b, float t,
+                                   bool rotation, float *out) {
+  float sign = 1.0f;
+  if (rotation && a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3] < 0.0f) {
+    sign = -1.0f;
+  }
+  for (int i = 0; i < 4; i++) {
+    out[i] = a[i] + (sign * b[i] - a[i]) * t;
+  }
+  if (rotation) {
+    AnimNormalize4(out);
+  }
+}
+
+// Distance used for the tolerance: units for vectors, angle for rotations
+static inline float AnimKeyError(const float *a, const float *b, bool rotation) {
+  if (rotation) {
+    float d = fabsf(a[0] * b[0] + a[1] * b[1] + a[2] * b[2] + a[3] * b[3]);
+    return 2.0f * acosf(d > 1.0f ? 1.0f : d);
+  }
+  float dx = a[0] - b[0], dy = a[1] - b[1], dz = a[2] - b[2];
+  return sqrtf(dx * dx + dy * dy + dz * dz);
+}
+
+// Value a key decodes to (rotations go through 16-bit quantization)
+static inline void AnimStoredKey(const float *sample, bool rotation, float *out) {
+  if (rotation) {
+    for (int i = 0; i < 4; i++) {
+      out[i] = (float)AnimQuantizeUnit(sample[i]) / ANIM_ROTATION_RANGE;
+    }
+    AnimNormalize4(out);
+  } else {
+    memcpy(out, sample, 4 * sizeof(float));
+  }
+}
+
+// Greedy key reduction of one track. samples/stored hold 4 floats per frame.
+// Appends the kept frames to keys and returns their count (1 = constant).
+static int AnimReduceTrack(const float *samples, const float *stored,
+                           int frameCount, bool rotation, float tolerance,
+                           int *keys) {
+  bool constant = true;
+  for (int f = 1; f < frameCount && constant; f++) {
+    constant = AnimKeyError(stored, &samples[f * 4], rotation) <= tolerance;
+  }
+  keys[0] = 0;
+  if (constant) {
+    return 1;
+  }
+
+  int keyCount = 1;
+  int a = 0;
+  while (a < frameCount - 1) {
+    int best = a + 1;
+    for (int b = a + 2; b < frameCount; b++) {
+      bool fits = true;
+      for (int i = a + 1; i < b && fits; i++) {
+        float value[4];
+        AnimInterpolate(&stored[a * 4], &stored[b * 4],
+                        (float)(i - a) / (float)(b - a), rotation, value);
+        fits = AnimKeyError(value, &samples[i * 4], rotation) <= tolerance;
+      }
+      if (!fits) {
+        break;
+      }
+      best = b;
+    }
+    keys[keyCount++] = best;
+    a = best;
+  }
+  return keyCount;
+}
+
+static void UnloadCompressedAnimation(CompressedAnimation *anim) {
+  if (anim == NULL) {
+    return;
+  }
+  free(anim->tracks);
+  free(anim->keyFrames);
+  free(anim->vectorKeys);
+  free(anim->rotationKeys);
+  free(anim);
+}
+
+// Bytes of raylib's uncompressed frame poses
+static inline size_t AnimationRawBytes(const ModelAnimation *anim) {
+  return (size_t)anim->frameCount *
+         ((size_t)anim->boneCount * sizeof(Transform) + sizeof(Transform *));
+}
+
+// Build compressed tracks from raylib's frame poses. translationTolerance
+// bounds translation and scale error, rotationTolerance the rotation error
+// in radians. Returns NULL on failure (the animation stays uncompressed).
+static CompressedAnimation *CompressAnimation(const ModelAnimation *anim,
+                                              float translationTolerance,
+                                              float rotationTolerance) {
+  int frameCount = anim->frameCount;
+  int boneCount = anim->boneCount;
+  if (frameCount <= 0 || frameCount > ANIM_MAX_FRAMES || boneCount <= 0 ||
+      anim->framePoses == NULL) {
+    return NULL;
+  }
+
+  CompressedAnimation *out =
+      (CompressedAnimation *)calloc(1, sizeof(CompressedAnimation));
+  float *samples = (float *)malloc((size_t)frameCount * 4 * sizeof(float));
+  float *stored = (float *)malloc((size_t)frameCount * 4 * sizeof(float));
+  int *keys = (int *)malloc((size_t)frameCount * sizeof(int));
+  AnimKeyBuffer keyFrames = {NULL, 0, 0, sizeof(unsigned short)};
+  AnimKeyBuffer vectorKeys = {NULL, 0, 0, sizeof(float)};
+  AnimKeyBuffer rotationKeys = {NULL, 0, 0, sizeof(short)};
+  bool ok = out != NULL && samples != NULL && stored != NULL && keys != NULL;
+  if (ok) {
+    out->tracks = (AnimationTrack *)malloc((size_t)boneCount * 3 *
+                                           sizeof(AnimationTrack));
+    ok = out->tracks != NULL;
+  }
+
+  for (int bone = 0; bone < boneCount && ok; bone++) {
+    for (int kind = 0; kind < 3 && ok; kind++) {
+      bool rotation = kind == ANIM_TRACK_ROTATION;
+      for (int f = 0; f < frameCount; f++) {
+        const Transform *pose = &anim->framePoses[f][bone];
+        float *s = &samples[f * 4];
+        if (kind == ANIM_TRACK_TRANSLATION) {
+          s[0] = pose->translation.x, s[1] = pose->translation.y;
+          s[2] = pose->translation.z, s[3] = 0.0f;
+        } else if (rotation) {
+          s[0] = pose->rotation.x, s[1] = pose->rotation.y;
+          s[2] = pose->rotation.z, s[3] = pose->rotation.w;
+          AnimNormalize4(s);
+          // Keep neighbours on the same hemisphere so lerp takes the short arc
+          if (f > 0 && s[0] * s[-4] + s[1] * s[-3] + s[2] * s[-2] +
+                               s[3] * s[-1] < 0.0f) {
+            s[0] = -s[0], s[1] = -s[1], s[2] = -s[2], s[3] = -s[3];
+          }
+        } else {
+          s[0] = pose->scale.x, s[1] = pose->scale.y;
+          s[2] = pose->scale.z, s[3] = 0.0f;
+        }
+        AnimStoredKey(s, rotation, &stored[f * 4]);
+      }
+
+      float tolerance = rotation ? rotationTolerance : translationTolerance;
+      int keyCount = AnimReduceTrack(samples, stored, frameCount, rotation,
+                                     tolerance, keys);
+      AnimationTrack *track = &out->tracks[bone * 3 + kind];
+      track->keyCount = keyCount;
+      track->keyOffset = keyFrames.count;
+      track->valueOffset = rotation ? rotationKeys.count / 4
+                                    : vectorKeys.count / 3;
+
+      if (keyCount > 1) {
+        unsigned short *frames =
+            (unsigned short *)AnimKeyBufferPush(&keyFrames, keyCount);
+        if (frames == NULL) {
+          ok = false;
+          break;
+        }
+        for (int k = 0; k < keyCount; k++) {
+          frames[k] = (unsigned short)keys[k];
+        }
+      }
+      for (int k = 0; k < keyCount && ok; k++) {
+        const float *s = &samples[keys[k] * 4];
+        if (rotation) {
+          short *q = (short *)AnimKeyBufferPush(&rotationKeys, 4);
+          if (q == NULL) {
+            ok = false;
+            break;
+          }
+          for (int i = 0; i < 4; i++) {
+            q[i] = AnimQuantizeUnit(s[i]);
+          }
+        } else {
+          float *v = (float *)AnimKeyBufferPush(&vectorKeys, 3);
+          if (v == NULL) {
+            ok = false;
+            break;
+          }
+          v[0] = s[0], v[1] = s[1], v[2] = s[2];
+        }
+      }
+    }
+  }
+
+  // One float of padding so the SIMD sampler can load 4 lanes at every key
+  if (ok && AnimKeyBufferPush(&vectorKeys, 1) == NULL) {
+    ok = false;
+  }
+
+  free(samples);
+  free(stored);
+  free(keys);
+  if (!ok) {
+    free(keyFrames.data);
+    free(vectorKeys.data);
+    free(rotationKeys.data);
+    UnloadCompressedAnimation(out);
+    return NULL;
+  }
+
+  out->boneCount = boneCount;
+  out->frameCount = frameCount;
+  out->keyFrames = (unsigned short *)keyFrames.data;
+  out->vectorKeys = (float *)vectorKeys.data;
+  out->rotationKeys = (short *)rotationKeys.data;
+  out->storedBytes = sizeof(CompressedAnimation) +
+                     (size_t)boneCount * 3 * sizeof(AnimationTrack) +
+                     (size_t)keyFrames.count * sizeof(unsigned short) +
+                     (size_t)vectorKeys.count * sizeof(float) +
+                     (size_t)rotationKeys.count * sizeof(short);
+  return out;
+}
+
+// Key segment of a track containing frame: first key index and blend factor
+static inline int AnimFindSegment(const CompressedAnimation *anim,
+                                  const AnimationTrack *track, float frame,
+                                  float *outT) {
+  const unsigned short *frames = anim->keyFrames + track->keyOffset;
+  int lo = 0;
+  int hi = track->keyCount - 1;
+  if (frame >= (float)frames[hi]) {
+    *outT = 0.0f;
+    return hi;
+  }
+  while (hi - lo > 1) {
+    int mid = (lo + hi) / 2;
+    if ((float)frames[mid] <= frame) {
+      lo = mid;
+    } else {
+      hi = mid;
+    }
+  }
+  *outT = (frame - (float)frames[lo]) / (float)(frames[lo + 1] - frames[lo]);
+  return lo;
+}
+
+#if ANIM_SIMD_SSE
+static inline __m128 AnimLoadRotationSSE(const short *q) {
+  __m128i packed = _mm_loadl_epi64((const __m128i *)q);
+  __m128i wide = _mm_srai_epi32(_mm_unpacklo_epi16(packed, packed), 16);
+  return _mm_mul_ps(_mm_cvtepi32_ps(wide),
+                    _mm_set1_ps(1.0f / ANIM_ROTATION_RANGE));
+}
+#endif
+
+static inline void AnimSampleVector(const CompressedAnimation *anim,
+                                    const AnimationTrack *track, float frame,
+                                    Vector3 *out) {
+  int key = 0;
+  float t = 0.0f;
+  if (track->keyCount > 1) {
+    key = AnimFindSegment(anim, track, frame, &t);
+  }
+  const float *a = anim->vectorKeys + (size_t)(track->valueOffset + key) * 3;
+#if ANIM_SIMD_SSE
+  __m128 va = _mm_loadu_ps(a);
+  if (t > 0.0f) {
+    __m128 vb = _mm_loadu_ps(a + 3);
+    va = _mm_add_ps(va, _mm_mul_ps(_mm_sub_ps(vb, va), _mm_set1_ps(t)));
+  }
+  float lanes[4];
+  _mm_storeu_ps(lanes, va);
+  *out = (Vector3){lanes[0], lanes[1], lanes[2]};
+#else
+  *out = (Vector3){a[0], a[1], a[2]};
+  if (t > 0.0f) {
+    out->x += (a[3] - a[0]) * t;
+    out->y += (a[4] - a[1]) * t;
+    out->z += (a[5] - a[2]) * t;
+  }
+#endif
+}
+
+static inline void AnimSampleRotation(const CompressedAnimation *anim,
+                                      const AnimationTrack *track, float frame,
+                                      Quaternion *out) {
+  int key = 0;
+  float t = 0.0f;
+  if (track->keyCount > 1) {
+    key = AnimFindSegment(anim, track, frame, &t);
+  }
+  const short *q = anim->rotationKeys + (size_t)(track->valueOffset + key) * 4;
+  float r[4];
+#if ANIM_SIMD_SSE
+  __m128 qa = AnimLoadRotationSSE(q);
+  if (t > 0.0f) {
+    __m128 qb = AnimLoadRotationSSE(q + 4);
+    float d[4];
+    _mm_storeu_ps(d, _mm_mul_ps(qa, qb));
+    if (d[0] + d[1] + d[2] + d[3] < 0.0f) {
+      qb = _mm_sub_ps(_mm_setzero_ps(), qb);
+    }
+    qa = _mm_add_ps(qa, _mm_mul_ps(_mm_sub_ps(qb, qa), _mm_set1_ps(t)));
+  }
+  _mm_storeu_ps(r, qa);
+#else
+  float a[4], b[4];
+  for (int i = 0; i < 4; i++) {
+    a[i] = (float)q[i] / ANIM_ROTATION_RANGE;
+    r[i] = a[i];
+  }
+  if (t > 0.0f) {
+    for (int i = 0; i < 4; i++) {
+      b[i] = (float)q[i + 4] / ANIM_ROTATION_RANGE;
+    }
+    AnimInterpolate(a, b, t, true, r);
+  }
+#endif
+  AnimNormalize4(r);
+  *out = (Quaternion){r[0], r[1], r[2], r[3]};
+}
+
+// Reconstruct every bone's local transform at frame (may be fractional,
+// clamped to the clip)
+static void SampleCompressedAnimation(const CompressedAnimation *anim,
+                                      float frame, Transform *out) {
+  float last = (float)(anim->frameCount - 1);
+  if (frame < 0.0f)
+    frame = 0.0f;
+  if (frame > last)
+    frame = last;
+
+  for (int bone = 0; bone < anim->boneCount; bone++) {
+    const AnimationTrack *tracks = &anim->tracks[bone * 3];
+    AnimSampleVector(anim, &tracks[ANIM_TRACK_TRANSLATION], frame,
+                     &out[bone].translation);
+    AnimSampleRotation(anim, &tracks[ANIM_TRACK_ROTATION], frame,
+                       &out[bone].rotation);
+    AnimSampleVector(anim, &tracks[ANIM_TRACK_SCALE], frame, &out[bone].scale);
+  }
+}
+
+#endif // ANIMATION_COMPRESSION_H
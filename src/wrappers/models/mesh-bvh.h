@@ -0,0 +1,528 @@
+#ifndef MESH_BVH_H
+#define MESH_BVH_H
+
+// Bounding volume hierarchy over the triangles of a single mesh.
+// Built with binned SAH, traversed front-to-back. Everything lives in mesh
+// (model) space: callers transform the ray into the mesh frame instead of
+// transforming every vertex the way GetRayCollisionMesh does.
+// The same builder also produces box hierarchies (BoxBVH) used as a top-level
+// structure over placed model instances.
+
+#include "raylib.h"
+#include "raymath.h"
+#include <float.h>
+#include <math.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define BVH_BIN_COUNT 12
+#define BVH_MAX_LEAF_SIZE 4
+#define BVH_MAX_DEPTH 48
+#define BVH_STACK_SIZE 64
+#define BVH_EPSILON 0.000001f // Same epsilon as GetRayCollisionTriangle
+
+// 32-byte node: interior nodes store their left child index (right child is
+// leftFirst + 1), leaves store the first triangle and triangle count
+typedef struct {
+  Vector3 min;
+  int leftFirst;
+  Vector3 max;
+  int count; // 0 for interior nodes
+} BVHNode;
+
+typedef struct {
+  BVHNode *nodes;
+  int nodeCount;
+  Vector3 *triangles; // 3 vertices per triangle, reordered into leaf order
+  int *triangleIds;   // Original mesh triangle index per reordered triangle
+  int triangleCount;
+} MeshBVH;
+
+// BVH over arbitrary boxes, leaves reference primitives through primitives[]
+typedef struct {
+  BVHNode *nodes;
+  int nodeCount;
+  int *primitives; // Caller's primitive index per leaf slot
+  int primitiveCount;
+} BoxBVH;
+
+// Scratch data used only while building
+typedef struct {
+  Vector3 *centroids;
+  BoundingBox *bounds;
+  int *order;
+} BVHBuild;
+
+static inline void BVHGrowBox(BoundingBox *box, Vector3 p) {
+  box->min = Vector3Min(box->min, p);
+  box->max = Vector3Max(box->max, p);
+}
+
+static inline void BVHMergeBox(BoundingBox *box, BoundingBox other) {
+  box->min = Vector3Min(box->min, other.min);
+  box->max = Vector3Max(box->max, other.max);
+}
+
+static inline BoundingBox BVHEmptyBox(void) {
+  return (BoundingBox){{FLT_MAX, FLT_MAX, FLT_MAX},
+                       {-FLT_MAX, -FLT_MAX, -FLT_MAX}};
+}
+
+static inline float BVHBoxArea(BoundingBox box) {
+  Vector3 e = Vector3Subtract(box.max, box.min);
+  if (e.x < 0.0f || e.y < 0.0f || e.z < 0.0f) {
+    return 0.0f;
+  }
+  return e.x * e.y + e.y * e.z + e.z * e.x;
+}
+
+static inline float BVHAxis(Vector3 v, int axis) {
+  return (axis == 0) ? v.x : ((axis == 1) ? v.y : v.z);
+}
+
+static void BVHUpdateNodeBounds(BVHBuild *build, BVHNode *node) {
+  BoundingBox box = BVHEmptyBox();
+  for (int i = 0; i < node->count; i++) {
+    BVHMergeBox(&box, build->bounds[build->order[node->leftFirst + i]]);
+  }
+  node->min = box.min;
+  node->max = box.max;
+}
+
+// Evaluate binned SAH along every axis, returns the best cost
+static float BVHFindBestSplit(BVHBuild *build, const BVHNode *node,
+                              int *outAxis, float *outSplit) {
+  float bestCost = FLT_MAX;
+
+  BoundingBox centroidBox = BVHEmptyBox();
+  for (int i = 0; i < node->count; i++) {
+    BVHGrowBox(&centroidBox, build->centroids[build->order[node->leftFirst + i]]);
+  }
+
+  for (int axis = 0; axis < 3; axis++) {
+    float lo = BVHAxis(centroidBox.min, axis);
+    float hi = BVHAxis(centroidBox.max, axis);
+    if (hi <= lo) {
+      continue;
+    }
+
+    BoundingBox binBox[BVH_BIN_COUNT];
+    int binCount[BVH_BIN_COUNT] = {0};
+    for (int b = 0; b < BVH_BIN_COUNT; b++) {
+      binBox[b] = BVHEmptyBox();
+    }
+
+    float scale = BVH_BIN_COUNT / (hi - lo);
+    for (int i = 0; i < node->count; i++) {
+      int tri = build->order[node->leftFirst + i];
+      int b = (int)((BVHAxis(build->centroids[tri], axis) - lo) * scale);
+      if (b >= BVH_BIN_COUNT) {
+        b = BVH_BIN_COUNT - 1;
+      }
+      binCount[b]++;
+      BVHMergeBox(&binBox[b], build->bounds[tri]);
+    }
+
+    // Sweep from both sides to get area/count of every split plane
+    float leftArea[BVH_BIN_COUNT - 1], rightArea[BVH_BIN_COUNT - 1];
+    int leftCount[BVH_BIN_COUNT - 1], rightCount[BVH_BIN_COUNT - 1];
+    BoundingBox leftBox = BVHEmptyBox(), rightBox = BVHEmptyBox();
+    int leftSum = 0, rightSum = 0;
+    for (int i = 0; i < BVH_BIN_COUNT - 1; i++) {
+      leftSum += binCount[i];
+      leftCount[i] = leftSum;
+      BVHMergeBox(&leftBox, binBox[i]);
+      leftArea[i] = BVHBoxArea(leftBox);
+
+      rightSum += binCount[BVH_BIN_COUNT - 1 - i];
+      rightCount[BVH_BIN_COUNT - 2 - i] = rightSum;
+      BVHMergeBox(&rightBox, binBox[BVH_BIN_COUNT - 1 - i]);
+      rightArea[BVH_BIN_COUNT - 2 - i] = BVHBoxArea(rightBox);
+    }
+
+    float binWidth = (hi - lo) / BVH_BIN_COUNT;
+    for (int i = 0; i < BVH_BIN_COUNT - 1; i++) {
+      if (leftCount[i] == 0 || rightCount[i] == 0) {
+        continue;
+      }
+      float cost = leftCount[i] * leftArea[i] + rightCount[i] * rightArea[i];
+      if (cost < bestCost) {
+        bestCost = cost;
+        *outAxis = axis;
+        *outSplit = lo + binWidth * (i + 1);
+      }
+    }
+  }
+
+  return bestCost;
+}
+
+static void BVHSubdivide(BVHNode *nodes, int *nodeCount, BVHBuild *build,
+                         int nodeIndex, int depth) {
+  BVHNode *node = &nodes[nodeIndex];
+  if (node->count <= BVH_MAX_LEAF_SIZE || depth >= BVH_MAX_DEPTH) {
+    return;
+  }
+
+  int axis = 0;
+  float split = 0.0f;
+  float splitCost = BVHFindBestSplit(build, node, &axis, &split);
+
+  BoundingBox nodeBox = {node->min, node->max};
+  float leafCost = node->count * BVHBoxArea(nodeBox);
+  if (splitCost >= leafCost) {
+    return; // Splitting does not pay off
+  }
+
+  // Partition triangle order in place around the split plane
+  int i = node->leftFirst;
+  int j = i + node->count - 1;
+  while (i <= j) {
+    if (BVHAxis(build->centroids[build->order[i]], axis) < split) {
+      i++;
+    } else {
+      int tmp = build->order[i];
+      build->order[i] = build->order[j];
+      build->order[j] = tmp;
+      j--;
+    }
+  }
+
+  int leftCount = i - node->leftFirst;
+  if (leftCount == 0 || leftCount == node->count) {
+    return;
+  }
+
+  int leftIndex = *nodeCount;
+  *nodeCount += 2;
+
+  BVHNode *left = &nodes[leftIndex];
+  BVHNode *right = &nodes[leftIndex + 1];
+  left->leftFirst = node->leftFirst;
+  left->count = leftCount;
+  right->leftFirst = i;
+  right->count = node->count - leftCount;
+  node->leftFirst = leftIndex;
+  node->count = 0;
+
+  BVHUpdateNodeBounds(build, left);
+  BVHUpdateNodeBounds(build, right);
+
+  BVHSubdivide(nodes, nodeCount, build, leftIndex, depth + 1);
+  BVHSubdivide(nodes, nodeCount, build, leftIndex + 1, depth + 1);
+}
+
+// Fetch triangle vertices from mesh CPU data (indexed or not)
+static inline void BVHGetMeshTriangle(Mesh mesh, int tri, Vector3 *a,
+                                      Vector3 *b, Vector3 *c) {
+  Vector3 *vertdata = (Vector3 *)mesh.vertices;
+  if (mesh.indices) {
+    *a = vertdata[mesh.indices[tri * 3 + 0]];
+    *b = vertdata[mesh.indices[tri * 3 + 1]];
+    *c = vertdata[mesh.indices[tri * 3 + 2]];
+  } else {
+    *a = vertdata[tri * 3 + 0];
+    *b = vertdata[tri * 3 + 1];
+    *c = vertdata[tri * 3 + 2];
+  }
+}
+
+static void UnloadMeshBVH(MeshBVH *bvh) {
+  free(bvh->nodes);
+  free(bvh->triangles);
+  free(bvh->triangleIds);
+  memset(bvh, 0, sizeof(MeshBVH));
+}
+
+// Build BVH for mesh vertex data on CPU, returns false if mesh has no
+// triangles or allocation fails
+static bool BuildMeshBVH(MeshBVH *bvh, Mesh mesh) {
+  memset(bvh, 0, sizeof(MeshBVH));
+  if (mesh.vertices == NULL || mesh.triangleCount <= 0) {
+    return false;
+  }
+
+  int triCount = mesh.triangleCount;
+  BVHBuild build = {0};
+  build.centroids = (Vector3 *)malloc(sizeof(Vector3) * triCount);
+  build.bounds = (BoundingBox *)malloc(sizeof(BoundingBox) * triCount);
+  build.order = (int *)malloc(sizeof(int) * triCount);
+  bvh->nodes = (BVHNode *)malloc(sizeof(BVHNode) * (2 * triCount - 1));
+  bvh->triangles = (Vector3 *)malloc(sizeof(Vector3) * 3 * triCount);
+  bvh->triangleIds = (int *)malloc(sizeof(int) * triCount);
+
+  if (!build.centroids || !build.bounds || !build.order || !bvh->nodes ||
+      !bvh->triangles || !bvh->triangleIds) {
+    free(build.centroids);
+    free(build.bounds);
+    free(build.order);
+    UnloadMeshBVH(bvh);
+    return false;
+  }
+
+  for (int i = 0; i < triCount; i++) {
+    Vector3 a, b, c;
+    BVHGetMeshTriangle(mesh, i, &a, &b, &c);
+    BoundingBox box = {a, a};
+    BVHGrowBox(&box, b);
+    BVHGrowBox(&box, c);
+    build.bounds[i] = box;
+    build.centroids[i] = Vector3Scale(Vector3Add(Vector3Add(a, b), c), 1.0f / 3.0f);
+    build.order[i] = i;
+  }
+
+  BVHNode *root = &bvh->nodes[0];
+  root->leftFirst = 0;
+  root->count = triCount;
+  bvh->nodeCount = 1;
+  BVHUpdateNodeBounds(&build, root);
+  BVHSubdivide(bvh->nodes, &bvh->nodeCount, &build, 0, 0);
+
+  // Store triangles contiguously in leaf order so leaves read linear memory
+  for (int i = 0; i < triCount; i++) {
+    Vector3 a, b, c;
+    BVHGetMeshTriangle(mesh, build.order[i], &a, &b, &c);
+    bvh->triangles[i * 3 + 0] = a;
+    bvh->triangles[i * 3 + 1] = b;
+    bvh->triangles[i * 3 + 2] = c;
+    bvh->triangleIds[i] = build.order[i];
+  }
+  bvh->triangleCount = triCount;
+
+  free(build.centroids);
+  free(build.bounds);
+  free(build.order);
+  return true;
+}
+
+// Slab test, returns entry distance or FLT_MAX on miss
+static inline float BVHIntersectBox(Vector3 origin, Vector3 invDir,
+                                    Vector3 bmin, Vector3 bmax,
+                                    float maxDistance) {
+  float tx1 = (bmin.x - origin.x) * invDir.x, tx2 = (bmax.x - origin.x) * invDir.x;
+  float tmin = fminf(tx1, tx2), tmax = fmaxf(tx1, tx2);
+  float ty1 = (bmin.y - origin.y) * invDir.y, ty2 = (bmax.y - origin.y) * invDir.y;
+  tmin = fmaxf(tmin, fminf(ty1, ty2));
+  tmax = fminf(tmax, fmaxf(ty1, ty2));
+  float tz1 = (bmin.z - origin.z) * invDir.z, tz2 = (bmax.z - origin.z) * invDir.z;
+  tmin = fmaxf(tmin, fminf(tz1, tz2));
+  tmax = fminf(tmax, fmaxf(tz1, tz2));
+  if (tmax >= tmin && tmax > 0.0f && tmin < maxDistance) {
+    return tmin;
+  }
+  return FLT_MAX;
+}
+
+// Möller–Trumbore, two-sided like GetRayCollisionTriangle
+static inline bool BVHIntersectTriangle(Vector3 origin, Vector3 dir,
+                                        Vector3 v0, Vector3 v1, Vector3 v2,
+                                        float *outT) {
+  Vector3 edge1 = Vector3Subtract(v1, v0);
+  Vector3 edge2 = Vector3Subtract(v2, v0);
+  Vector3 p = Vector3CrossProduct(dir, edge2);
+  float det = Vector3DotProduct(edge1, p);
+  if (det > -BVH_EPSILON && det < BVH_EPSILON) {
+    return false;
+  }
+  float invDet = 1.0f / det;
+  Vector3 tv = Vector3Subtract(origin, v0);
+  float u = Vector3DotProduct(tv, p) * invDet;
+  if (u < 0.0f || u > 1.0f) {
+    return false;
+  }
+  Vector3 q = Vector3CrossProduct(tv, edge1);
+  float v = Vector3DotProduct(dir, q) * invDet;
+  if (v < 0.0f || (u + v) > 1.0f) {
+    return false;
+  }
+  float t = Vector3DotProduct(edge2, q) * invDet;
+  if (t <= BVH_EPSILON) {
+    return false;
+  }
+  *outT = t;
+  return true;
+}
+
+// Closest hit along ray in mesh space. Distance is the ray parameter t, so a
+// ray transformed by an affine matrix (direction not renormalized) reports the
+// same distance as in world space. Returns reordered triangle index or -1.
+static int IntersectMeshBVH(const MeshBVH *bvh, Ray ray, float maxDistance,
+                            float *outDistance) {
+  if (bvh->nodeCount == 0) {
+    return -1;
+  }
+
+  Vector3 invDir = {1.0f / ray.direction.x, 1.0f / ray.direction.y,
+                    1.0f / ray.direction.z};
+  float closest = maxDistance;
+  int hitTriangle = -1;
+
+  int stack[BVH_STACK_SIZE];
+  int stackSize = 0;
+  const BVHNode *root = &bvh->nodes[0];
+  if (BVHIntersectBox(ray.position, invDir, root->min, root->max, closest) ==
+      FLT_MAX) {
+    return -1;
+  }
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BVHNode *node = &bvh->nodes[stack[--stackSize]];
+
+    if (node->count > 0) {
+      for (int i = 0; i < node->count; i++) {
+        int tri = node->leftFirst + i;
+        const Vector3 *v = &bvh->triangles[tri * 3];
+        float t;
+        if (BVHIntersectTriangle(ray.position, ray.direction, v[0], v[1], v[2],
+                                 &t) &&
+            t < closest) {
+          closest = t;
+          hitTriangle = tri;
+        }
+      }
+      continue;
+    }
+
+    int near = node->leftFirst, far = node->leftFirst + 1;
+    float dNear = BVHIntersectBox(ray.position, invDir, bvh->nodes[near].min,
+                                  bvh->nodes[near].max, closest);
+    float dFar = BVHIntersectBox(ray.position, invDir, bvh->nodes[far].min,
+                                 bvh->nodes[far].max, closest);
+    if (dFar < dNear) {
+      float td = dNear;
+      dNear = dFar;
+      dFar = td;
+      int ti = near;
+      near = far;
+      far = ti;
+    }
+    // Push far child first so the near child is visited next
+    if (dFar != FLT_MAX && stackSize < BVH_STACK_SIZE) {
+      stack[stackSize++] = far;
+    }
+    if (dNear != FLT_MAX && stackSize < BVH_STACK_SIZE) {
+      stack[stackSize++] = near;
+    }
+  }
+
+  if (hitTriangle >= 0) {
+    *outDistance = closest;
+  }
+  return hitTriangle;
+}
+
+static void UnloadBoxBVH(BoxBVH *bvh) {
+  free(bvh->nodes);
+  free(bvh->primitives);
+  memset(bvh, 0, sizeof(BoxBVH));
+}
+
+// Build BVH over boxes, returns false if count is 0 or allocation fails
+static bool BuildBoxBVH(BoxBVH *bvh, const BoundingBox *boxes, int count) {
+  UnloadBoxBVH(bvh);
+  if (boxes == NULL || count <= 0) {
+    return false;
+  }
+
+  BVHBuild build = {0};
+  build.centroids = (Vector3 *)malloc(sizeof(Vector3) * count);
+  build.bounds = (BoundingBox *)malloc(sizeof(BoundingBox) * count);
+  bvh->nodes = (BVHNode *)malloc(sizeof(BVHNode) * (2 * count - 1));
+  bvh->primitives = (int *)malloc(sizeof(int) * count);
+
+  if (!build.centroids || !build.bounds || !bvh->nodes || !bvh->primitives) {
+    free(build.centroids);
+    free(build.bounds);
+    UnloadBoxBVH(bvh);
+    return false;
+  }
+
+  for (int i = 0; i < count; i++) {
+    build.bounds[i] = boxes[i];
+    build.centroids[i] =
+        Vector3Scale(Vector3Add(boxes[i].min, boxes[i].max), 0.5f);
+    bvh->primitives[i] = i;
+  }
+  build.order = bvh->primitives; // Leaf order is the final primitive order
+
+  BVHNode *root = &bvh->nodes[0];
+  root->leftFirst = 0;
+  root->count = count;
+  bvh->nodeCount = 1;
+  BVHUpdateNodeBounds(&build, root);
+  BVHSubdivide(bvh->nodes, &bvh->nodeCount, &build, 0, 0);
+  bvh->primitiveCount = count;
+
+  free(build.centroids);
+  free(build.bounds);
+  return true;
+}
+
+// Axis-aligned bounds of a box after an affine transform (Arvo's method)
+static inline BoundingBox BVHTransformBox(BoundingBox box, Matrix m) {
+  float mat[3][3] = {{m.m0, m.m4, m.m8}, {m.m1, m.m5, m.m9}, {m.m2, m.m6, m.m10}};
+  float lo[3] = {m.m12, m.m13, m.m14};
+  float hi[3] = {m.m12, m.m13, m.m14};
+  float bmin[3] = {box.min.x, box.min.y, box.min.z};
+  float bmax[3] = {box.max.x, box.max.y, box.max.z};
+  for (int i = 0; i < 3; i++) {
+    for (int j = 0; j < 3; j++) {
+      float a = mat[i][j] * bmin[j];
+      float b = mat[i][j] * bmax[j];
+      lo[i] += fminf(a, b);
+      hi[i] += fmaxf(a, b);
+    }
+  }
+  return (BoundingBox){{lo[0], lo[1], lo[2]}, {hi[0], hi[1], hi[2]}};
+}
+
+// Transform direction vector (w = 0) by matrix
+static inline Vector3 BVHTransformDirection(Vector3 v, Matrix m) {
+  return (Vector3){m.m0 * v.x + m.m4 * v.y + m.m8 * v.z,
+                   m.m1 * v.x + m.m5 * v.y + m.m9 * v.z,
+                   m.m2 * v.x + m.m6 * v.y + m.m10 * v.z};
+}
+
+// Transform normal by inverse-transpose, given the inverse matrix
+static inline Vector3 BVHTransformNormal(Vector3 n, Matrix inv) {
+  return (Vector3){inv.m0 * n.x + inv.m1 * n.y + inv.m2 * n.z,
+                   inv.m4 * n.x + inv.m5 * n.y + inv.m6 * n.z,
+                   inv.m8 * n.x + inv.m9 * n.y + inv.m10 * n.z};
+}
+
+// Raycast a world-space ray against a mesh BVH placed with transform.
+// Fills collision in world space with the same conventions as
+// GetRayCollisionMesh and returns the original mesh triangle index or -1.
+static int MeshBVHRaycast(const MeshBVH *bvh, Ray ray, Matrix transform,
+                          Matrix invTransform, float maxDistance,
+                          RayCollision *outCollision) {
+  Ray localRay;
+  localRay.position = Vector3Transform(ray.position, invTransform);
+  localRay.direction = BVHTransformDirection(ray.direction, invTransform);
+
+  float distance = 0.0f;
+  int tri = IntersectMeshBVH(bvh, localRay, maxDistance, &distance);
+  if (tri < 0) {
+    return -1;
+  }
+
+  const Vector3 *v = &bvh->triangles[tri * 3];
+  Vector3 localNormal = Vector3CrossProduct(Vector3Subtract(v[1], v[0]),
+                                            Vector3Subtract(v[2], v[0]));
+  Vector3 normal = BVHTransformNormal(localNormal, invTransform);
+  // Mirroring transforms flip the winding of the world-space triangle
+  if (MatrixDeterminant(transform) < 0.0f) {
+    normal = Vector3Negate(normal);
+  }
+
+  outCollision->hit = true;
+  outCollision->distance = distance;
+  outCollision->point =
+      Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+  outCollision->normal = Vector3Normalize(normal);
+  return bvh->triangleIds[tri];
+}
+
+#endif // MESH_BVH_H
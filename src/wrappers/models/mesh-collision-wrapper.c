@@ -1,7 +1,11 @@
 #include "raylib.h"
 #include "raymath.h"
 #include <stdlib.h>
+#include <math.h>
+#include <time.h>
 
+#include "ray-triangle-simd.h"
+#include "../common/handle-table.h"
 
 // Export macro for Windows DLL
 #ifdef _WIN32
@@ -9,20 +13,156 @@
 #else
     #define EXPORT
 #endif
+
+// Prepared collision mesh: SoA edge data built once, tested 4/8 triangles at a time
+typedef struct {
+    TriangleSoA triangles;
+} CollisionMeshSlot;
+
+static HandleTable collisionMeshSlots = HANDLE_TABLE_INIT(CollisionMeshSlot);
+
 // Thread-local storage for last collision result
 static RayCollision lastCollision = {0};
 
-// Wrapper for GetRayCollisionMesh that stores result in thread-local storage
-EXPORT void GetRayCollisionMeshWrapper(Ray* ray, int modelSlotIndex, int meshIndex, Matrix* transform) {
-    // This function needs access to the model slots from model-wrapper.c
-    // We'll need to expose a function to get mesh data
-    // For now, we'll implement a simpler version that works with the existing system
-    
-    // Reset last collision
+static CollisionMeshSlot* GetCollisionMeshSlot(int slotIndex) {
+    return HandleTableGet(&collisionMeshSlots, slotIndex);
+}
+
+static void WriteCollisionData(RayCollision collision, float* outBuffer) {
+    outBuffer[0] = collision.hit ? 1.0f : 0.0f;
+    outBuffer[1] = collision.distance;
+    outBuffer[2] = collision.point.x;
+    outBuffer[3] = collision.point.y;
+    outBuffer[4] = collision.point.z;
+    outBuffer[5] = collision.normal.x;
+    outBuffer[6] = collision.normal.y;
+    outBuffer[7] = collision.normal.z;
+}
+
+// Closest hit against a prepared mesh. The ray is moved into model space without
+// renormalizing its direction, so distance stays in world units.
+static RayCollision RaycastTriangleSoA(const TriangleSoA* soa, Ray ray, Matrix* transform) {
+    RayCollision collision = {0};
+    Ray localRay = ray;
+    Matrix invTransform = MatrixIdentity();
+
+    if (transform != NULL) {
+        invTransform = MatrixInvert(*transform);
+        localRay.position = Vector3Transform(ray.position, invTransform);
+        localRay.direction = (Vector3){
+            invTransform.m0 * ray.direction.x + invTransform.m4 * ray.direction.y + invTransform.m8 * ray.direction.z,
+            invTransform.m1 * ray.direction.x + invTransform.m5 * ray.direction.y + invTransform.m9 * ray.direction.z,
+            invTransform.m2 * ray.direction.x + invTransform.m6 * ray.direction.y + invTransform.m10 * ray.direction.z
+        };
+    }
+
+    float distance = FLT_MAX;
+    int tri = IntersectTriangleSoA(soa, localRay, &distance);
+    if (tri < 0) {
+        return collision;
+    }
+
+    // Face normal in model space, oriented like GetRayCollisionTriangle (e1 x e2)
+    Vector3 e1 = { soa->e1x[tri], soa->e1y[tri], soa->e1z[tri] };
+    Vector3 e2 = { soa->e2x[tri], soa->e2y[tri], soa->e2z[tri] };
+    Vector3 normal = Vector3CrossProduct(e1, e2);
+
+    if (transform != NULL) {
+        // Inverse-transpose keeps normals perpendicular under non-uniform scale
+        normal = (Vector3){
+            invTransform.m0 * normal.x + invTransform.m1 * normal.y + invTransform.m2 * normal.z,
+            invTransform.m4 * normal.x + invTransform.m5 * normal.y + invTransform.m6 * normal.z,
+            invTransform.m8 * normal.x + invTransform.m9 * normal.y + invTransform.m10 * normal.z
+        };
+        if (MatrixDeterminant(*transform) < 0.0f) {
+            normal = Vector3Negate(normal);
+        }
+    }
+
+    collision.hit = true;
+    collision.distance = distance;
+    collision.point = Vector3Add(ray.position, Vector3Scale(ray.direction, distance));
+    collision.normal = Vector3Normalize(normal);
+    return collision;
+}
+
+// Prepare a collision mesh from raw positions (xyz per vertex).
+// indexSize: 0 = non-indexed, 2 = 16-bit indices, 4 = 32-bit indices
+EXPORT int LoadCollisionMeshToSlot(float* vertices, int vertexCount, void* indices, int indexSize, int triangleCount) {
+    if (vertices == NULL || vertexCount <= 0 || triangleCount <= 0) {
+        return -1;
+    }
+    if (indexSize != 0 && indexSize != 2 && indexSize != 4) {
+        return -1;
+    }
+    if (indexSize != 0 && indices == NULL) {
+        return -1;
+    }
+    if (indexSize == 0 && triangleCount * 3 > vertexCount) {
+        return -1;
+    }
+
+    int slotIndex = HandleTableAlloc(&collisionMeshSlots);
+    if (slotIndex == -1) {
+        return -1;
+    }
+
+    CollisionMeshSlot* slot = GetCollisionMeshSlot(slotIndex);
+    if (!BuildTriangleSoA(&slot->triangles, vertices, vertexCount,
+                          indexSize != 0 ? indices : NULL, indexSize, triangleCount)) {
+        HandleTableFree(&collisionMeshSlots, slotIndex);
+        return -1;
+    }
+    return slotIndex;
+}
+
+EXPORT void UnloadCollisionMeshBySlot(int slotIndex) {
+    CollisionMeshSlot* slot = GetCollisionMeshSlot(slotIndex);
+    if (slot == NULL) {
+        return;
+    }
+    UnloadTriangleSoA(&slot->triangles);
+    HandleTableFree(&collisionMeshSlots, slotIndex);
+}
+
+EXPORT int GetCollisionMeshTriangleCount(int slotIndex) {
+    CollisionMeshSlot* slot = GetCollisionMeshSlot(slotIndex);
+    if (slot == NULL) {
+        return 0;
+    }
+    return slot->triangles.triangleCount;
+}
+
+// Triangles tested per kernel iteration on this CPU (8 = AVX, 4 = SSE, 1 = scalar)
+EXPORT int GetCollisionKernelWidth(void) {
+    return TriangleSoAKernelWidth();
+}
+
+// Raycast a prepared collision mesh, result written as
+// [hit, distance, px, py, pz, nx, ny, nz]. Returns 1 on hit, 0 on miss, -1 on error.
+EXPORT int GetRayCollisionMeshBySlot(Ray* ray, int slotIndex, Matrix* transform, float* outBuffer) {
+    if (ray == NULL || outBuffer == NULL) {
+        return -1;
+    }
+    CollisionMeshSlot* slot = GetCollisionMeshSlot(slotIndex);
+    if (slot == NULL) {
+        return -1;
+    }
+
+    RayCollision collision = RaycastTriangleSoA(&slot->triangles, *ray, transform);
+    lastCollision = collision;
+    WriteCollisionData(collision, outBuffer);
+    return collision.hit ? 1 : 0;
+}
+
+// Raycast a prepared collision mesh and store the result for GetLastMeshCollisionData
+EXPORT void GetRayCollisionMeshWrapper(Ray* ray, int meshSlotIndex, Matrix* transform) {
     lastCollision = (RayCollision){0};
-    
-    // Note: This is a placeholder - actual implementation needs model slot access
-    // The proper way is to add a function in model-wrapper.c that exposes mesh data
+    CollisionMeshSlot* slot = GetCollisionMeshSlot(meshSlotIndex);
+    if (ray == NULL || slot == NULL) {
+        return;
+    }
+    lastCollision = RaycastTriangleSoA(&slot->triangles, *ray, transform);
 }
 
 // Alternative: Direct ray-mesh collision with explicit mesh data
@@ -30,7 +170,7 @@ EXPORT void GetRayCollisionMeshDirect(Ray* ray, float* vertices, int vertexCount
     RayCollision collision = {0};
     collision.distance = 10000.0f;
     collision.hit = false;
-    
+
     // Transform ray to model space if transform is provided
     Ray localRay = *ray;
     if (transform != NULL) {
@@ -39,43 +179,132 @@ EXPORT void GetRayCollisionMeshDirect(Ray* ray, float* vertices, int vertexCount
         localRay.direction = Vector3Transform(ray->direction, invTransform);
         localRay.direction = Vector3Normalize(localRay.direction);
     }
-    
+
     // Check collision with each triangle
     for (int i = 0; i < triangleCount; i++) {
         int idx0 = indices ? indices[i * 3 + 0] : (i * 3 + 0);
         int idx1 = indices ? indices[i * 3 + 1] : (i * 3 + 1);
         int idx2 = indices ? indices[i * 3 + 2] : (i * 3 + 2);
-        
+
         Vector3 v0 = { vertices[idx0 * 3 + 0], vertices[idx0 * 3 + 1], vertices[idx0 * 3 + 2] };
         Vector3 v1 = { vertices[idx1 * 3 + 0], vertices[idx1 * 3 + 1], vertices[idx1 * 3 + 2] };
         Vector3 v2 = { vertices[idx2 * 3 + 0], vertices[idx2 * 3 + 1], vertices[idx2 * 3 + 2] };
-        
+
         RayCollision triCollision = GetRayCollisionTriangle(localRay, v0, v1, v2);
-        
+
         if (triCollision.hit && triCollision.distance < collision.distance) {
             collision = triCollision;
         }
     }
-    
+
     // Transform collision point and normal back to world space if needed
     if (collision.hit && transform != NULL) {
         collision.point = Vector3Transform(collision.point, *transform);
         collision.normal = Vector3Transform(collision.normal, *transform);
         collision.normal = Vector3Normalize(collision.normal);
     }
-    
+
     *outCollision = collision;
     lastCollision = collision;
 }
 
+// Benchmark the per-triangle gather loop (GetRayCollisionTriangle, as in
+// GetRayCollisionMeshDirect) against the precomputed SoA kernel on the same rays.
+// rays: 6 floats per ray (origin xyz, direction xyz), model space.
+// outTimings: [gatherMs, simdMs, prepareMs, kernelWidth]
+// Returns the number of rays whose results disagree, or -1 on error.
+EXPORT int BenchmarkRayCollisionMesh(float* vertices, int vertexCount, void* indices, int indexSize, int triangleCount, float* rays, int rayCount, float* outTimings) {
+    if (vertices == NULL || rays == NULL || outTimings == NULL || rayCount <= 0 || triangleCount <= 0) {
+        return -1;
+    }
+    if ((indexSize != 0 && indexSize != 2 && indexSize != 4) || (indexSize != 0 && indices == NULL)) {
+        return -1;
+    }
+
+    const unsigned short* idx16 = (indexSize == 2) ? indices : NULL;
+    const unsigned int* idx32 = (indexSize == 4) ? indices : NULL;
+
+    clock_t start = clock();
+    TriangleSoA soa;
+    if (!BuildTriangleSoA(&soa, vertices, vertexCount, indexSize != 0 ? indices : NULL, indexSize, triangleCount)) {
+        return -1;
+    }
+    double prepareMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    float* gatherDistances = (float*)malloc(sizeof(float) * rayCount);
+    if (gatherDistances == NULL) {
+        UnloadTriangleSoA(&soa);
+        return -1;
+    }
+
+    start = clock();
+    for (int r = 0; r < rayCount; r++) {
+        Ray ray = {
+            { rays[r * 6 + 0], rays[r * 6 + 1], rays[r * 6 + 2] },
+            { rays[r * 6 + 3], rays[r * 6 + 4], rays[r * 6 + 5] }
+        };
+        float closest = FLT_MAX;
+        for (int i = 0; i < triangleCount; i++) {
+            int idx0 = i * 3 + 0, idx1 = i * 3 + 1, idx2 = i * 3 + 2;
+            if (idx16 != NULL) {
+                idx0 = idx16[idx0]; idx1 = idx16[idx1]; idx2 = idx16[idx2];
+            } else if (idx32 != NULL) {
+                idx0 = (int)idx32[idx0]; idx1 = (int)idx32[idx1]; idx2 = (int)idx32[idx2];
+            }
+            // Unsigned compare: 32-bit indices past INT_MAX turn negative as int
+            if ((unsigned int)idx0 >= (unsigned int)vertexCount || (unsigned int)idx1 >= (unsigned int)vertexCount ||
+                (unsigned int)idx2 >= (unsigned int)vertexCount) {
+                continue;
+            }
+
+            Vector3 v0 = { vertices[idx0 * 3 + 0], vertices[idx0 * 3 + 1], vertices[idx0 * 3 + 2] };
+            Vector3 v1 = { vertices[idx1 * 3 + 0], vertices[idx1 * 3 + 1], vertices[idx1 * 3 + 2] };
+            Vector3 v2 = { vertices[idx2 * 3 + 0], vertices[idx2 * 3 + 1], vertices[idx2 * 3 + 2] };
+
+            RayCollision triCollision = GetRayCollisionTriangle(ray, v0, v1, v2);
+            if (triCollision.hit && triCollision.distance < closest) {
+                closest = triCollision.distance;
+            }
+        }
+        gatherDistances[r] = closest;
+    }
+    double gatherMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    // Both paths report the ray parameter t, so distances compare directly
+    int mismatches = 0;
+    start = clock();
+    for (int r = 0; r < rayCount; r++) {
+        Ray ray = {
+            { rays[r * 6 + 0], rays[r * 6 + 1], rays[r * 6 + 2] },
+            { rays[r * 6 + 3], rays[r * 6 + 4], rays[r * 6 + 5] }
+        };
+        float closest = FLT_MAX;
+        IntersectTriangleSoA(&soa, ray, &closest);
+
+        float expected = gatherDistances[r];
+        bool gatherHit = expected < FLT_MAX;
+        bool simdHit = closest < FLT_MAX;
+        if (gatherHit != simdHit) {
+            mismatches++;
+        } else if (gatherHit) {
+            if (fabsf(closest - expected) > 1e-3f * fmaxf(1.0f, expected)) {
+                mismatches++;
+            }
+        }
+    }
+    double simdMs = (double)(clock() - start) * 1000.0 / CLOCKS_PER_SEC;
+
+    outTimings[0] = (float)gatherMs;
+    outTimings[1] = (float)simdMs;
+    outTimings[2] = (float)prepareMs;
+    outTimings[3] = (float)TriangleSoAKernelWidth();
+
+    free(gatherDistances);
+    UnloadTriangleSoA(&soa);
+    return mismatches;
+}
+
 // Get last collision data (for compatibility with existing system)
 EXPORT void GetLastMeshCollisionData(float* outBuffer) {
-    outBuffer[0] = lastCollision.hit ? 1.0f : 0.0f;
-    outBuffer[1] = lastCollision.distance;
-    outBuffer[2] = lastCollision.point.x;
-    outBuffer[3] = lastCollision.point.y;
-    outBuffer[4] = lastCollision.point.z;
-    outBuffer[5] = lastCollision.normal.x;
-    outBuffer[6] = lastCollision.normal.y;
-    outBuffer[7] = lastCollision.normal.z;
+    WriteCollisionData(lastCollision, outBuffer);
 }
@@ -0,0 +1,387 @@
+#ifndef MESH_OPTIMIZE_H
+#define MESH_OPTIMIZE_H
+
+// Load-time mesh optimization on the CPU copy of a mesh:
+//   1. weld vertices whose attributes are byte-identical (exporters and
+//      raylib's OBJ loader emit one vertex per triangle corner),
+//   2. reorder triangles for the post-transform vertex cache (Forsyth's
+//      linear-speed algorithm),
+//   3. renumber vertices in first-use order so vertex fetch walks memory
+//      forwards.
+// The result is a new mesh with 16-bit indices; meshes that would need more
+// than 65535 vertices are left alone.
+
+#include "raylib.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MESH_CACHE_SIZE 32      // Modelled cache for the reordering
+#define MESH_ACMR_CACHE_SIZE 16 // FIFO size used to report ACMR
+#define MESH_MAX_ATTRIBUTES 10
+
+// Totals over the meshes of a model. Cache misses are vertex shader runs
+// with a FIFO cache of MESH_ACMR_CACHE_SIZE; per triangle (ACMR) 0.5 is
+// ideal and 3 means no reuse at all.
+typedef struct {
+  int meshesOptimized;
+  int verticesBefore;
+  int verticesAfter;
+  int triangles;
+  int cacheMissesBefore;
+  int cacheMissesAfter;
+} MeshOptimizeStats;
+
+// Per-vertex array of a mesh and its size per vertex
+typedef struct {
+  void **data;
+  int stride;
+} MeshAttribute;
+
+static int GetMeshAttributes(Mesh *mesh, MeshAttribute *out) {
+  int count = 0;
+  out[count++] = (MeshAttribute){(void **)&mesh->vertices, 3 * sizeof(float)};
+  out[count++] = (MeshAttribute){(void **)&mesh->texcoords, 2 * sizeof(float)};
+  out[count++] =
+      (MeshAttribute){(void **)&mesh->texcoords2, 2 * sizeof(float)};
+  out[count++] = (MeshAttribute){(void **)&mesh->normals, 3 * sizeof(float)};
+  out[count++] = (MeshAttribute){(void **)&mesh->tangents, 4 * sizeof(float)};
+  out[count++] = (MeshAttribute){(void **)&mesh->colors, 4};
+  out[count++] =
+      (MeshAttribute){(void **)&mesh->animVertices, 3 * sizeof(float)};
+  out[count++] =
+      (MeshAttribute){(void **)&mesh->animNormals, 3 * sizeof(float)};
+  out[count++] = (MeshAttribute){(void **)&mesh->boneIds, 4};
+  out[count++] =
+      (MeshAttribute){(void **)&mesh->boneWeights, 4 * sizeof(float)};
+  return count;
+}
+
+// Vertex shader invocations for an index list under a FIFO cache
+static int MeshCacheMisses(const unsigned int *indices, int indexCount,
+                           int vertexCount) {
+  int *stamp = (int *)malloc(sizeof(int) * vertexCount);
+  if (stamp == NULL) {
+    return 0;
+  }
+  // A vertex is cached while fewer than MESH_ACMR_CACHE_SIZE misses happened
+  // since its own miss
+  for (int v = 0; v < vertexCount; v++) {
+    stamp[v] = -MESH_ACMR_CACHE_SIZE - 1;
+  }
+  int misses = 0;
+  for (int i = 0; i < indexCount; i++) {
+    unsigned int v = indices[i];
+    if (misses - stamp[v] > MESH_ACMR_CACHE_SIZE) {
+      stamp[v] = misses;
+      misses++;
+    }
+  }
+  free(stamp);
+  return misses;
+}
+
+// remap[v] = first vertex with byte-identical attributes
+static int *WeldMeshVertices(const MeshAttribute *attributes,
+                             int attributeCount, int vertexCount) {
+  int size = 16;
+  while (size < vertexCount * 2) {
+    size *= 2;
+  }
+  int *table = (int *)malloc(sizeof(int) * size);
+  int *remap = (int *)malloc(sizeof(int) * vertexCount);
+  if (table == NULL || remap == NULL) {
+    free(table);
+    free(remap);
+    return NULL;
+  }
+  memset(table, -1, sizeof(int) * size);
+
+  for (int v = 0; v < vertexCount; v++) {
+    uint64_t hash = 14695981039346656037ULL; // FNV-1a over every attribute
+    for (int a = 0; a < attributeCount; a++) {
+      const unsigned char *bytes = (const unsigned char *)*attributes[a].data;
+      if (bytes == NULL) {
+        continue;
+      }
+      bytes += (size_t)v * attributes[a].stride;
+      for (int b = 0; b < attributes[a].stride; b++) {
+        hash = (hash ^ bytes[b]) * 1099511628211ULL;
+      }
+    }
+
+    uint32_t slot = (uint32_t)(hash ^ (hash >> 32)) & (size - 1);
+    for (;; slot = (slot + 1) & (size - 1)) {
+      int other = table[slot];
+      if (other < 0) {
+        table[slot] = v;
+        remap[v] = v;
+        break;
+      }
+      bool equal = true;
+      for (int a = 0; a < attributeCount && equal; a++) {
+        const unsigned char *bytes = (const unsigned char *)*attributes[a].data;
+        int stride = attributes[a].stride;
+        equal = bytes == NULL ||
+                memcmp(bytes + (size_t)v * stride,
+                       bytes + (size_t)other * stride, stride) == 0;
+      }
+      if (equal) {
+        remap[v] = other;
+        break;
+      }
+    }
+  }
+  free(table);
+  return remap;
+}
+
+// Forsyth vertex score: recently used vertices and vertices with few
+// triangles left score high
+static float MeshVertexScore(int cachePosition, int remaining) {
+  if (remaining == 0) {
+    return -1.0f;
+  }
+  float score = 0.0f;
+  if (cachePosition >= 0) {
+    score = cachePosition < 3
+                ? 0.75f
+                : powf(1.0f - (float)(cachePosition - 3) /
+                                  (MESH_CACHE_SIZE - 3),
+                       1.5f);
+  }
+  return score + 2.0f / sqrtf((float)remaining);
+}
+
+// Reorder triangles in place for vertex cache reuse. Returns false when out
+// of memory (indices unchanged).
+static bool OptimizeVertexCache(unsigned int *indices, int indexCount,
+                                int vertexCount) {
+  int triangleCount = indexCount / 3;
+  int *offsets = (int *)calloc(vertexCount + 1, sizeof(int));
+  int *remaining = (int *)calloc(vertexCount, sizeof(int));
+  int *adjacency = (int *)malloc(sizeof(int) * indexCount);
+  int *cachePosition = (int *)malloc(sizeof(int) * vertexCount);
+  float *vertexScore = (float *)malloc(sizeof(float) * vertexCount);
+  float *triangleScore = (float *)malloc(sizeof(float) * triangleCount);
+  bool *emitted = (bool *)calloc(triangleCount, sizeof(bool));
+  unsigned int *output =
+      (unsigned int *)malloc(sizeof(unsigned int) * indexCount);
+  if (!offsets || !remaining || !adjacency || !cachePosition ||
+      !vertexScore || !triangleScore || !emitted || !output) {
+    free(offsets);
+    free(remaining);
+    free(adjacency);
+    free(cachePosition);
+    free(vertexScore);
+    free(triangleScore);
+    free(emitted);
+    free(output);
+    return false;
+  }
+
+  // Triangles per vertex; remaining[v] doubles as the fill cursor
+  for (int i = 0; i < indexCount; i++) {
+    offsets[indices[i] + 1]++;
+  }
+  for (int v = 0; v < vertexCount; v++) {
+    offsets[v + 1] += offsets[v];
+  }
+  for (int i = 0; i < indexCount; i++) {
+    unsigned int v = indices[i];
+    adjacency[offsets[v] + remaining[v]++] = i / 3;
+  }
+  for (int v = 0; v < vertexCount; v++) {
+    cachePosition[v] = -1;
+    vertexScore[v] = MeshVertexScore(-1, remaining[v]);
+  }
+  for (int t = 0; t < triangleCount; t++) {
+    triangleScore[t] = vertexScore[indices[t * 3]] +
+                       vertexScore[indices[t * 3 + 1]] +
+                       vertexScore[indices[t * 3 + 2]];
+  }
+
+  unsigned int cache[MESH_CACHE_SIZE + 3];
+  int cacheCount = 0;
+  int cursor = 0; // Next candidate when the cache offers nothing
+  int best = -1;
+  for (int written = 0; written < triangleCount; written++) {
+    if (best < 0) {
+      while (emitted[cursor]) {
+        cursor++;
+      }
+      best = cursor;
+    }
+
+    const unsigned int *tri = &indices[best * 3];
+    memcpy(&output[written * 3], tri, sizeof(unsigned int) * 3);
+    emitted[best] = true;
+
+    // Drop the triangle from its vertices' lists, then move them to the
+    // front of the cache
+    unsigned int next[MESH_CACHE_SIZE + 3];
+    int nextCount = 0;
+    for (int c = 0; c < 3; c++) {
+      unsigned int v = tri[c];
+      int *list = &adjacency[offsets[v]];
+      for (int k = 0; k < remaining[v]; k++) {
+        if (list[k] == best) {
+          list[k] = list[--remaining[v]];
+          break;
+        }
+      }
+      next[nextCount++] = v;
+    }
+    for (int k = 0; k < cacheCount; k++) {
+      unsigned int v = cache[k];
+      if (v != tri[0] && v != tri[1] && v != tri[2]) {
+        next[nextCount++] = v;
+      }
+    }
+
+    // Rescore what is in (or just fell out of) the cache and pick the best
+    // triangle around it
+    best = -1;
+    float bestScore = -1.0f;
+    for (int k = 0; k < nextCount; k++) {
+      unsigned int v = next[k];
+      cachePosition[v] = k < MESH_CACHE_SIZE ? k : -1;
+      vertexScore[v] = MeshVertexScore(cachePosition[v], remaining[v]);
+    }
+    for (int k = 0; k < nextCount; k++) {
+      unsigned int v = next[k];
+      for (int a = 0; a < remaining[v]; a++) {
+        int t = adjacency[offsets[v] + a];
+        triangleScore[t] = vertexScore[indices[t * 3]] +
+                           vertexScore[indices[t * 3 + 1]] +
+                           vertexScore[indices[t * 3 + 2]];
+        if (triangleScore[t] > bestScore) {
+          bestScore = triangleScore[t];
+          best = t;
+        }
+      }
+    }
+    cacheCount = nextCount < MESH_CACHE_SIZE ? nextCount : MESH_CACHE_SIZE;
+    memcpy(cache, next, sizeof(unsigned int) * cacheCount);
+  }
+
+  memcpy(indices, output, sizeof(unsigned int) * indexCount);
+  free(offsets);
+  free(remaining);
+  free(adjacency);
+  free(cachePosition);
+  free(vertexScore);
+  free(triangleScore);
+  free(emitted);
+  free(output);
+  return true;
+}
+
+// Weld, cache-order and fetch-order a mesh into *out: a new CPU mesh (arrays
+// from MemAlloc, not uploaded) that takes over the source's non-vertex data
+// such as boneMatrices. Returns false and leaves *out untouched when the mesh
+// cannot be optimized (no positions, too many vertices, out of memory).
+static bool OptimizeMesh(Mesh *source, Mesh *out, MeshOptimizeStats *stats) {
+  int vertexCount = source->vertexCount;
+  int indexCount =
+      source->indices != NULL ? source->triangleCount * 3 : vertexCount;
+  if (source->vertices == NULL || indexCount < 3) {
+    return false;
+  }
+
+  MeshAttribute attributes[MESH_MAX_ATTRIBUTES];
+  int attributeCount = GetMeshAttributes(source, attributes);
+  unsigned int *indices =
+      (unsigned int *)malloc(sizeof(unsigned int) * indexCount);
+  int *order = (int *)malloc(sizeof(int) * vertexCount); // new -> old
+  int *newIndex = (int *)malloc(sizeof(int) * vertexCount);
+  int *remap = WeldMeshVertices(attributes, attributeCount, vertexCount);
+  bool ok = indices && order && newIndex && remap;
+
+  int missesBefore = 0;
+  if (ok) {
+    for (int i = 0; i < indexCount; i++) {
+      indices[i] =
+          source->indices != NULL ? source->indices[i] : (unsigned int)i;
+    }
+    missesBefore = MeshCacheMisses(indices, indexCount, vertexCount);
+    for (int i = 0; i < indexCount; i++) {
+      indices[i] = (unsigned int)remap[indices[i]];
+    }
+    ok = OptimizeVertexCache(indices, indexCount, vertexCount);
+  }
+
+  // First-use numbering
+  int newCount = 0;
+  if (ok) {
+    memset(newIndex, -1, sizeof(int) * vertexCount);
+    for (int i = 0; i < indexCount; i++) {
+      unsigned int v = indices[i];
+      if (newIndex[v] < 0) {
+        order[newCount] = (int)v;
+        newIndex[v] = newCount++;
+      }
+      indices[i] = (unsigned int)newIndex[v];
+    }
+    ok = newCount <= 65535;
+  }
+
+  Mesh mesh = *source;
+  MeshAttribute outAttributes[MESH_MAX_ATTRIBUTES];
+  GetMeshAttributes(&mesh, outAttributes);
+  mesh.vaoId = 0;
+  mesh.vboId = NULL;
+  mesh.vertexCount = newCount;
+  mesh.triangleCount = indexCount / 3;
+  mesh.indices = NULL;
+  for (int a = 0; a < attributeCount; a++) {
+    *outAttributes[a].data = NULL;
+  }
+  if (ok) {
+    mesh.indices =
+        (unsigned short *)MemAlloc(sizeof(unsigned short) * indexCount);
+    ok = mesh.indices != NULL;
+    for (int i = 0; ok && i < indexCount; i++) {
+      mesh.indices[i] = (unsigned short)indices[i];
+    }
+  }
+  for (int a = 0; ok && a < attributeCount; a++) {
+    const unsigned char *src = (const unsigned char *)*attributes[a].data;
+    if (src == NULL) {
+      continue;
+    }
+    int stride = attributes[a].stride;
+    unsigned char *dst = (unsigned char *)MemAlloc(newCount * stride);
+    *outAttributes[a].data = dst;
+    ok = dst != NULL;
+    for (int v = 0; ok && v < newCount; v++) {
+      memcpy(dst + (size_t)v * stride, src + (size_t)order[v] * stride,
+             stride);
+    }
+  }
+
+  if (ok) {
+    stats->meshesOptimized++;
+    stats->verticesBefore += vertexCount;
+    stats->verticesAfter += newCount;
+    stats->triangles += indexCount / 3;
+    stats->cacheMissesBefore += missesBefore;
+    stats->cacheMissesAfter += MeshCacheMisses(indices, indexCount, newCount);
+    *out = mesh;
+    source->boneMatrices = NULL; // Now owned by the optimized mesh
+  } else {
+    MemFree(mesh.indices);
+    for (int a = 0; a < attributeCount; a++) {
+      MemFree(*outAttributes[a].data);
+    }
+  }
+  free(indices);
+  free(order);
+  free(newIndex);
+  free(remap);
+  return ok;
+}
+
+#endif // MESH_OPTIMIZE_H
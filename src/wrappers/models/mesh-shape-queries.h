@@ -0,0 +1,573 @@
+#ifndef MESH_SHAPE_QUERIES_H
+#define MESH_SHAPE_QUERIES_H
+
+// Volume queries against a MeshBVH: closest point, sphere-cast and
+// capsule-cast. Unlike raycasts these run in world space: node boxes and leaf
+// triangles are moved by the mesh transform on the fly, so spheres stay
+// spheres under non-uniform scale.
+//
+// Casts solve the time of impact per candidate triangle in closed form, one
+// shape feature pair at a time (see CapsuleTriangleTimeOfImpact), so grazing
+// sweeps find their contact like steep ones.
+
+#include "mesh-bvh.h"
+
+#define SHAPE_CAST_TOLERANCE 0.0001f
+
+typedef struct {
+  float distance;  // Cast: ray parameter of first contact. Closest point: distance
+  Vector3 point;   // Contact point on the mesh surface (world space)
+  Vector3 normal;  // Surface normal pointing toward the query shape
+  float depth;     // Penetration depth (> 0 only when already overlapping)
+  int triangle;    // Original mesh triangle index
+} ShapeContact;
+
+// Closest point on triangle abc to p (Ericson, Real-Time Collision Detection)
+static Vector3 ClosestPointOnTriangle(Vector3 p, Vector3 a, Vector3 b,
+                                      Vector3 c) {
+  Vector3 ab = Vector3Subtract(b, a);
+  Vector3 ac = Vector3Subtract(c, a);
+  Vector3 ap = Vector3Subtract(p, a);
+  float d1 = Vector3DotProduct(ab, ap);
+  float d2 = Vector3DotProduct(ac, ap);
+  if (d1 <= 0.0f && d2 <= 0.0f) {
+    return a;
+  }
+
+  Vector3 bp = Vector3Subtract(p, b);
+  float d3 = Vector3DotProduct(ab, bp);
+  float d4 = Vector3DotProduct(ac, bp);
+  if (d3 >= 0.0f && d4 <= d3) {
+    return b;
+  }
+
+  float vc = d1 * d4 - d3 * d2;
+  if (vc <= 0.0f && d1 >= 0.0f && d3 <= 0.0f) {
+    return Vector3Add(a, Vector3Scale(ab, d1 / (d1 - d3)));
+  }
+
+  Vector3 cp = Vector3Subtract(p, c);
+  float d5 = Vector3DotProduct(ab, cp);
+  float d6 = Vector3DotProduct(ac, cp);
+  if (d6 >= 0.0f && d5 <= d6) {
+    return c;
+  }
+
+  float vb = d5 * d2 - d1 * d6;
+  if (vb <= 0.0f && d2 >= 0.0f && d6 <= 0.0f) {
+    return Vector3Add(a, Vector3Scale(ac, d2 / (d2 - d6)));
+  }
+
+  float va = d3 * d6 - d5 * d4;
+  if (va <= 0.0f && (d4 - d3) >= 0.0f && (d5 - d6) >= 0.0f) {
+    Vector3 bc = Vector3Subtract(c, b);
+    return Vector3Add(b, Vector3Scale(bc, (d4 - d3) / ((d4 - d3) + (d5 - d6))));
+  }
+
+  float denom = 1.0f / (va + vb + vc);
+  float v = vb * denom;
+  float w = vc * denom;
+  return Vector3Add(a, Vector3Add(Vector3Scale(ab, v), Vector3Scale(ac, w)));
+}
+
+static inline float ShapeClamp01(float x) {
+  return (x < 0.0f) ? 0.0f : ((x > 1.0f) ? 1.0f : x);
+}
+
+// Closest points between segments p1q1 and p2q2, returns squared distance.
+// Handles degenerate (point) segments.
+static float ClosestPointsSegmentSegment(Vector3 p1, Vector3 q1, Vector3 p2,
+                                         Vector3 q2, Vector3 *c1, Vector3 *c2) {
+  Vector3 d1 = Vector3Subtract(q1, p1);
+  Vector3 d2 = Vector3Subtract(q2, p2);
+  Vector3 r = Vector3Subtract(p1, p2);
+  float a = Vector3DotProduct(d1, d1);
+  float e = Vector3DotProduct(d2, d2);
+  float f = Vector3DotProduct(d2, r);
+  float s = 0.0f, t = 0.0f;
+
+  if (a <= BVH_EPSILON && e <= BVH_EPSILON) {
+    // Both segments are points
+  } else if (a <= BVH_EPSILON) {
+    t = ShapeClamp01(f / e);
+  } else {
+    float c = Vector3DotProduct(d1, r);
+    if (e <= BVH_EPSILON) {
+      s = ShapeClamp01(-c / a);
+    } else {
+      float b = Vector3DotProduct(d1, d2);
+      float denom = a * e - b * b;
+      s = (denom != 0.0f) ? ShapeClamp01((b * f - c * e) / denom) : 0.0f;
+      t = (b * s + f) / e;
+      if (t < 0.0f) {
+        t = 0.0f;
+        s = ShapeClamp01(-c / a);
+      } else if (t > 1.0f) {
+        t = 1.0f;
+        s = ShapeClamp01((b - c) / a);
+      }
+    }
+  }
+
+  *c1 = Vector3Add(p1, Vector3Scale(d1, s));
+  *c2 = Vector3Add(p2, Vector3Scale(d2, t));
+  Vector3 diff = Vector3Subtract(*c1, *c2);
+  return Vector3DotProduct(diff, diff);
+}
+
+// Closest points between segment pq and triangle abc, returns squared distance
+static float ClosestPointsSegmentTriangle(Vector3 p, Vector3 q, Vector3 a,
+                                          Vector3 b, Vector3 c,
+                                          Vector3 *onSegment,
+                                          Vector3 *onTriangle) {
+  // Segment crossing the triangle touches it
+  float t;
+  Vector3 dir = Vector3Subtract(q, p);
+  if (BVHIntersectTriangle(p, dir, a, b, c, &t) && t <= 1.0f) {
+    *onSegment = *onTriangle = Vector3Add(p, Vector3Scale(dir, t));
+    return 0.0f;
+  }
+
+  // Otherwise the closest pair involves a segment endpoint or a triangle edge
+  *onSegment = p;
+  *onTriangle = ClosestPointOnTriangle(p, a, b, c);
+  float best = Vector3DistanceSqr(p, *onTriangle);
+
+  Vector3 tq = ClosestPointOnTriangle(q, a, b, c);
+  float dq = Vector3DistanceSqr(q, tq);
+  if (dq < best) {
+    best = dq;
+    *onSegment = q;
+    *onTriangle = tq;
+  }
+
+  Vector3 edges[3][2] = {{a, b}, {b, c}, {c, a}};
+  for (int i = 0; i < 3; i++) {
+    Vector3 cs, ct;
+    float d = ClosestPointsSegmentSegment(p, q, edges[i][0], edges[i][1], &cs,
+                                          &ct);
+    if (d < best) {
+      best = d;
+      *onSegment = cs;
+      *onTriangle = ct;
+    }
+  }
+  return best;
+}
+
+// Squared distance from point to box
+static inline float ShapePointBoxDistanceSqr(Vector3 p, Vector3 bmin,
+                                             Vector3 bmax) {
+  float dx = fmaxf(fmaxf(bmin.x - p.x, 0.0f), p.x - bmax.x);
+  float dy = fmaxf(fmaxf(bmin.y - p.y, 0.0f), p.y - bmax.y);
+  float dz = fmaxf(fmaxf(bmin.z - p.z, 0.0f), p.z - bmax.z);
+  return dx * dx + dy * dy + dz * dz;
+}
+
+static inline void ShapeWorldTriangle(const MeshBVH *bvh, int tri,
+                                      Matrix transform, Vector3 *a, Vector3 *b,
+                                      Vector3 *c) {
+  const Vector3 *v = &bvh->triangles[tri * 3];
+  *a = Vector3Transform(v[0], transform);
+  *b = Vector3Transform(v[1], transform);
+  *c = Vector3Transform(v[2], transform);
+}
+
+// Normal for contact between a triangle and a query point: from the surface
+// toward the query, falling back to the face normal facing `toward`
+static Vector3 ShapeContactNormal(Vector3 surface, Vector3 query, Vector3 a,
+                                  Vector3 b, Vector3 c, Vector3 toward) {
+  Vector3 n = Vector3Subtract(query, surface);
+  float len = Vector3Length(n);
+  if (len > SHAPE_CAST_TOLERANCE) {
+    return Vector3Scale(n, 1.0f / len);
+  }
+  n = Vector3Normalize(
+      Vector3CrossProduct(Vector3Subtract(b, a), Vector3Subtract(c, a)));
+  return (Vector3DotProduct(n, toward) < 0.0f) ? Vector3Negate(n) : n;
+}
+
+// Closest point on mesh to p within maxDistance. Returns false if no surface
+// is that close.
+static bool MeshBVHClosestPoint(const MeshBVH *bvh, Matrix transform,
+                                Vector3 p, float maxDistance,
+                                ShapeContact *out) {
+  if (bvh->nodeCount == 0) {
+    return false;
+  }
+
+  float bestSqr = maxDistance * maxDistance;
+  if (maxDistance >= sqrtf(FLT_MAX)) {
+    bestSqr = FLT_MAX;
+  }
+  int bestTri = -1;
+  Vector3 bestPoint = {0};
+
+  int stack[BVH_STACK_SIZE];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BVHNode *node = &bvh->nodes[stack[--stackSize]];
+    BoundingBox box =
+        BVHTransformBox((BoundingBox){node->min, node->max}, transform);
+    if (ShapePointBoxDistanceSqr(p, box.min, box.max) > bestSqr) {
+      continue;
+    }
+
+    if (node->count > 0) {
+      for (int i = 0; i < node->count; i++) {
+        int tri = node->leftFirst + i;
+        Vector3 a, b, c;
+        ShapeWorldTriangle(bvh, tri, transform, &a, &b, &c);
+        Vector3 cp = ClosestPointOnTriangle(p, a, b, c);
+        float d = Vector3DistanceSqr(p, cp);
+        if (d <= bestSqr) {
+          bestSqr = d;
+          bestTri = tri;
+          bestPoint = cp;
+        }
+      }
+      continue;
+    }
+
+    // Visit the nearer child first
+    int near = node->leftFirst, far = node->leftFirst + 1;
+    BoundingBox nearBox = BVHTransformBox(
+        (BoundingBox){bvh->nodes[near].min, bvh->nodes[near].max}, transform);
+    BoundingBox farBox = BVHTransformBox(
+        (BoundingBox){bvh->nodes[far].min, bvh->nodes[far].max}, transform);
+    if (ShapePointBoxDistanceSqr(p, farBox.min, farBox.max) <
+        ShapePointBoxDistanceSqr(p, nearBox.min, nearBox.max)) {
+      int tmp = near;
+      near = far;
+      far = tmp;
+    }
+    if (stackSize + 2 <= BVH_STACK_SIZE) {
+      stack[stackSize++] = far;
+      stack[stackSize++] = near;
+    }
+  }
+
+  if (bestTri < 0) {
+    return false;
+  }
+
+  Vector3 a, b, c;
+  ShapeWorldTriangle(bvh, bestTri, transform, &a, &b, &c);
+  out->distance = sqrtf(bestSqr);
+  out->point = bestPoint;
+  out->normal = ShapeContactNormal(bestPoint, p, a, b, c, Vector3Subtract(p, a));
+  out->depth = 0.0f;
+  out->triangle = bvh->triangleIds[bestTri];
+  return true;
+}
+
+// First t >= 0 at which ray o + dir * t (dir unit length) is inside the
+// sphere (c, r). False when it misses or moves away from the outside.
+static bool ShapeRaySphere(Vector3 o, Vector3 dir, Vector3 c, float r,
+                           float *outT) {
+  Vector3 oc = Vector3Subtract(o, c);
+  float b = Vector3DotProduct(dir, oc);
+  float cc = Vector3DotProduct(oc, oc) - r * r;
+  if (cc > 0.0f && b > 0.0f) {
+    return false;
+  }
+  float h = b * b - cc;
+  if (h < 0.0f) {
+    return false;
+  }
+  *outT = fmaxf(-b - sqrtf(h), 0.0f);
+  return true;
+}
+
+// First t >= 0 at which ray o + dir * t (dir unit length) is inside the
+// capsule pa-pb of radius r: the cylinder body, then the end spheres (which
+// also cover entering through the body's flat ends)
+static bool ShapeRayCapsule(Vector3 o, Vector3 dir, Vector3 pa, Vector3 pb,
+                            float r, float *outT) {
+  float best = FLT_MAX;
+  Vector3 ba = Vector3Subtract(pb, pa);
+  float baba = Vector3DotProduct(ba, ba);
+  if (baba > BVH_EPSILON) {
+    Vector3 oa = Vector3Subtract(o, pa);
+    float bard = Vector3DotProduct(ba, dir);
+    float baoa = Vector3DotProduct(ba, oa);
+    float a = baba - bard * bard;
+    if (a > BVH_EPSILON * baba) { // Not parallel to the axis
+      float b = baba * Vector3DotProduct(dir, oa) - baoa * bard;
+      float c = baba * Vector3DotProduct(oa, oa) - baoa * baoa - r * r * baba;
+      float h = b * b - a * c;
+      if (h >= 0.0f) {
+        float t = (-b - sqrtf(h)) / a;
+        float y = baoa + t * bard;
+        if (t >= 0.0f && y >= 0.0f && y <= baba) {
+          best = t;
+        }
+      }
+    }
+  }
+  float t;
+  if (ShapeRaySphere(o, dir, pa, r, &t) && t < best) {
+    best = t;
+  }
+  if (baba > BVH_EPSILON && ShapeRaySphere(o, dir, pb, r, &t) && t < best) {
+    best = t;
+  }
+  if (best == FLT_MAX) {
+    return false;
+  }
+  *outT = best;
+  return true;
+}
+
+// Point q on the plane of triangle abc lies inside it
+static bool ShapePointInTriangle(Vector3 q, Vector3 a, Vector3 b, Vector3 c,
+                                 Vector3 n) {
+  Vector3 ab = Vector3Subtract(b, a), bc = Vector3Subtract(c, b),
+          ca = Vector3Subtract(a, c);
+  return Vector3DotProduct(Vector3CrossProduct(ab, Vector3Subtract(q, a)), n) >=
+             0.0f &&
+         Vector3DotProduct(Vector3CrossProduct(bc, Vector3Subtract(q, b)), n) >=
+             0.0f &&
+         Vector3DotProduct(Vector3CrossProduct(ca, Vector3Subtract(q, c)), n) >=
+             0.0f;
+}
+
+// Time of first contact between capsule ab (radius r) moving by motion * t and
+// a triangle, t in [0, maxT]. Exact: the first contact is between one
+// feature of each shape, so every pair is solved in closed form and the
+// earliest wins:
+//   - a capsule end sphere against the face (plane offset by r)
+//   - a capsule end sphere against an edge (ray vs the edge grown by r)
+//   - a triangle vertex against the capsule (reverse ray vs the capsule)
+//   - the capsule's core segment against an edge, both interiors (lines
+//     reaching distance r)
+// Out points: onShape on the capsule's core segment, onTriangle on the
+// triangle, both at the time of contact.
+static bool CapsuleTriangleTimeOfImpact(Vector3 a, Vector3 b, float radius,
+                                        Vector3 motion, float motionLen,
+                                        Vector3 v0, Vector3 v1, Vector3 v2,
+                                        float maxT, float *outT,
+                                        Vector3 *outOnShape,
+                                        Vector3 *outOnTriangle) {
+  Vector3 onShape, onTriangle;
+  float dist = sqrtf(
+      ClosestPointsSegmentTriangle(a, b, v0, v1, v2, &onShape, &onTriangle));
+  if (dist - radius <= SHAPE_CAST_TOLERANCE) {
+    *outT = 0.0f; // Already touching
+    *outOnShape = onShape;
+    *outOnTriangle = onTriangle;
+    return true;
+  }
+  if (motionLen <= 0.0f) {
+    return false; // Not moving and not touching
+  }
+
+  Vector3 dir = Vector3Scale(motion, 1.0f / motionLen);
+  float best = maxT * motionLen; // Searched along dir, converted at the end
+  bool hit = false;
+  Vector3 ends[2] = {a, b};
+  int endCount = Vector3DistanceSqr(a, b) > BVH_EPSILON ? 2 : 1;
+  Vector3 tri[3] = {v0, v1, v2};
+  Vector3 axis = Vector3Subtract(b, a);
+
+  // End spheres against the face
+  Vector3 n = Vector3CrossProduct(Vector3Subtract(v1, v0),
+                                  Vector3Subtract(v2, v0));
+  float nLen = Vector3Length(n);
+  if (nLen > BVH_EPSILON) {
+    n = Vector3Scale(n, 1.0f / nLen);
+    for (int e = 0; e < endCount; e++) {
+      float side = Vector3DotProduct(Vector3Subtract(ends[e], v0), n);
+      float approach = side >= 0.0f ? -Vector3DotProduct(dir, n)
+                                    : Vector3DotProduct(dir, n);
+      if (approach <= 0.0f) {
+        continue;
+      }
+      float t = (fabsf(side) - radius) / approach;
+      if (t < 0.0f || t > best) {
+        continue;
+      }
+      Vector3 center = Vector3Add(ends[e], Vector3Scale(dir, t));
+      Vector3 q = Vector3Subtract(
+          center, Vector3Scale(n, side >= 0.0f ? radius : -radius));
+      if (ShapePointInTriangle(q, v0, v1, v2, n)) {
+        best = t;
+        hit = true;
+        onShape = center;
+        onTriangle = q;
+      }
+    }
+  }
+
+  for (int i = 0; i < 3; i++) {
+    Vector3 e0 = tri[i], e1 = tri[(i + 1) % 3];
+    float t;
+
+    // End spheres against the edge
+    for (int e = 0; e < endCount; e++) {
+      if (ShapeRayCapsule(ends[e], dir, e0, e1, radius, &t) && t <= best) {
+        best = t;
+        hit = true;
+        onShape = Vector3Add(ends[e], Vector3Scale(dir, t));
+        ClosestPointsSegmentSegment(onShape, onShape, e0, e1, &onShape,
+                                    &onTriangle);
+      }
+    }
+
+    // Vertex against the capsule, seen from the capsule
+    if (ShapeRayCapsule(tri[i], Vector3Negate(dir), a, b, radius, &t) &&
+        t <= best) {
+      best = t;
+      hit = true;
+      Vector3 offset = Vector3Scale(dir, t);
+      onTriangle = tri[i];
+      ClosestPointsSegmentSegment(Vector3Add(a, offset), Vector3Add(b, offset),
+                                  tri[i], tri[i], &onShape, &onTriangle);
+    }
+
+    // Core segment against the edge, both interiors. Only reachable from
+    // outside the radius: lines already closer would first touch through an
+    // end or vertex, found above. Parallel pairs touch there as well.
+    if (endCount < 2) {
+      continue;
+    }
+    Vector3 edge = Vector3Subtract(e1, e0);
+    Vector3 m = Vector3CrossProduct(axis, edge);
+    float mLen = Vector3Length(m);
+    if (mLen <= BVH_EPSILON) {
+      continue;
+    }
+    m = Vector3Scale(m, 1.0f / mLen);
+    float h = Vector3DotProduct(Vector3Subtract(a, e0), m);
+    float closing = h >= 0.0f ? -Vector3DotProduct(dir, m)
+                              : Vector3DotProduct(dir, m);
+    if (fabsf(h) <= radius || closing <= 0.0f) {
+      continue;
+    }
+    t = (fabsf(h) - radius) / closing;
+    if (t > best) {
+      continue;
+    }
+    Vector3 r0 = Vector3Subtract(Vector3Add(a, Vector3Scale(dir, t)), e0);
+    float aa = Vector3DotProduct(axis, axis);
+    float ae = Vector3DotProduct(axis, edge);
+    float ee = Vector3DotProduct(edge, edge);
+    float ar = Vector3DotProduct(axis, r0);
+    float er = Vector3DotProduct(edge, r0);
+    float denom = aa * ee - ae * ae;
+    float s = (ae * er - ee * ar) / denom;
+    float u = (aa * er - ae * ar) / denom;
+    if (s >= 0.0f && s <= 1.0f && u >= 0.0f && u <= 1.0f) {
+      best = t;
+      hit = true;
+      onShape = Vector3Add(Vector3Add(a, Vector3Scale(dir, t)),
+                           Vector3Scale(axis, s));
+      onTriangle = Vector3Add(e0, Vector3Scale(edge, u));
+    }
+  }
+
+  if (!hit) {
+    return false;
+  }
+  *outT = best / motionLen;
+  *outOnShape = onShape;
+  *outOnTriangle = onTriangle;
+  return true;
+}
+
+// Sweep capsule ab (radius r) along motion up to maxT (in units of motion,
+// like the ray parameter). A sphere cast is a capsule with a == b.
+// Already-overlapping shapes report distance 0 and their penetration depth.
+static bool MeshBVHCapsuleCast(const MeshBVH *bvh, Matrix transform, Vector3 a,
+                               Vector3 b, float radius, Vector3 motion,
+                               float maxT, ShapeContact *out) {
+  if (bvh->nodeCount == 0) {
+    return false;
+  }
+
+  // Nodes are tested as boxes grown by the capsule's half extents against the
+  // path of the capsule center
+  Vector3 center = Vector3Scale(Vector3Add(a, b), 0.5f);
+  Vector3 halfSeg = Vector3Scale(Vector3Subtract(b, a), 0.5f);
+  Vector3 extent = {fabsf(halfSeg.x) + radius, fabsf(halfSeg.y) + radius,
+                    fabsf(halfSeg.z) + radius};
+  Vector3 invDir = {1.0f / motion.x, 1.0f / motion.y, 1.0f / motion.z};
+  float motionLen = Vector3Length(motion);
+
+  float bestT = maxT;
+  int bestTri = -1;
+  Vector3 bestOnShape = {0}, bestOnTriangle = {0};
+  float bestDepth = 0.0f;
+
+  int stack[BVH_STACK_SIZE];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BVHNode *node = &bvh->nodes[stack[--stackSize]];
+    BoundingBox box =
+        BVHTransformBox((BoundingBox){node->min, node->max}, transform);
+    Vector3 bmin = Vector3Subtract(box.min, extent);
+    Vector3 bmax = Vector3Add(box.max, extent);
+    bool inside = center.x >= bmin.x && center.x <= bmax.x &&
+                  center.y >= bmin.y && center.y <= bmax.y &&
+                  center.z >= bmin.z && center.z <= bmax.z;
+    if (!inside && (motionLen <= 0.0f ||
+                    BVHIntersectBox(center, invDir, bmin, bmax, bestT) ==
+                        FLT_MAX)) {
+      continue;
+    }
+
+    if (node->count > 0) {
+      for (int i = 0; i < node->count; i++) {
+        int tri = node->leftFirst + i;
+        Vector3 v0, v1, v2;
+        ShapeWorldTriangle(bvh, tri, transform, &v0, &v1, &v2);
+        float t;
+        Vector3 onShape, onTriangle;
+        if (!CapsuleTriangleTimeOfImpact(a, b, radius, motion, motionLen, v0,
+                                         v1, v2, bestT, &t, &onShape,
+                                         &onTriangle)) {
+          continue;
+        }
+        float depth = 0.0f;
+        if (t == 0.0f) {
+          depth = radius - Vector3Distance(onShape, onTriangle);
+        }
+        // Earlier contact wins; among overlaps the deepest one
+        if (t < bestT || (t == 0.0f && bestT == 0.0f && depth > bestDepth) ||
+            bestTri < 0) {
+          bestT = t;
+          bestTri = tri;
+          bestOnShape = onShape;
+          bestOnTriangle = onTriangle;
+          bestDepth = depth;
+        }
+      }
+      continue;
+    }
+
+    if (stackSize + 2 <= BVH_STACK_SIZE) {
+      stack[stackSize++] = node->leftFirst + 1;
+      stack[stackSize++] = node->leftFirst;
+    }
+  }
+
+  if (bestTri < 0) {
+    return false;
+  }
+
+  Vector3 v0, v1, v2;
+  ShapeWorldTriangle(bvh, bestTri, transform, &v0, &v1, &v2);
+  out->distance = bestT;
+  out->point = bestOnTriangle;
+  out->normal = ShapeContactNormal(bestOnTriangle, bestOnShape, v0, v1, v2,
+                                   Vector3Negate(motion));
+  out->depth = (bestDepth > 0.0f) ? bestDepth : 0.0f;
+  out->triangle = bvh->triangleIds[bestTri];
+  return true;
+}
+
+#endif // MESH_SHAPE_QUERIES_H
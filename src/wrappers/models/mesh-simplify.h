@@ -0,0 +1,474 @@
+#ifndef MESH_SIMPLIFY_H
+#define MESH_SIMPLIFY_H
+
+// Quadric error mesh simplification (Garland & Heckbert) by half-edge
+// collapse: a vertex moves onto one of its neighbours, so no new positions or
+// attributes are made up and simplified triangles keep indexing the source
+// vertex data. Vertices sharing a position are welded for connectivity.
+// Border vertices and UV seams are locked so outlines and texture mapping
+// survive, and collapses that would flip a triangle are rejected.
+//
+// Each pass sorts every candidate edge by error and collapses the cheapest
+// ones whose neighbourhood has not changed yet in that pass. Passes repeat
+// until the triangle target is met or no edge is left under the error limit.
+
+#include "raylib.h"
+#include "raymath.h"
+#include <math.h>
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define SIMPLIFY_MAX_PASSES 32
+
+// Symmetric 4x4 error matrix (upper triangle) plus the summed plane weight
+typedef struct {
+  double a2, ab, ac, ad, b2, bc, bd, c2, cd, d2;
+  double weight;
+} Quadric;
+
+typedef struct {
+  float cost;
+  int from; // Position group that moves
+  int to;   // Position group it moves onto
+} SimplifyCollapse;
+
+static inline void QuadricAddPlane(Quadric *q, double a, double b, double c,
+                                   double d, double w) {
+  q->a2 += w * a * a;
+  q->ab += w * a * b;
+  q->ac += w * a * c;
+  q->ad += w * a * d;
+  q->b2 += w * b * b;
+  q->bc += w * b * c;
+  q->bd += w * b * d;
+  q->c2 += w * c * c;
+  q->cd += w * c * d;
+  q->d2 += w * d * d;
+  q->weight += w;
+}
+
+static inline void QuadricAdd(Quadric *q, const Quadric *other) {
+  double *dst = (double *)q;
+  const double *src = (const double *)other;
+  for (int i = 0; i < 11; i++) {
+    dst[i] += src[i];
+  }
+}
+
+// Weighted sum of squared plane distances at p
+static inline double QuadricError(const Quadric *q, Vector3 p) {
+  double x = p.x, y = p.y, z = p.z;
+  double e = q->a2 * x * x + q->b2 * y * y + q->c2 * z * z + q->d2 +
+             2.0 * (q->ab * x * y + q->ac * x * z + q->bc * y * z +
+                    q->ad * x + q->bd * y + q->cd * z);
+  return e > 0.0 ? e : 0.0;
+}
+
+static inline Vector3 SimplifyPosition(const float *vertices, int v) {
+  return (Vector3){vertices[v * 3], vertices[v * 3 + 1], vertices[v * 3 + 2]};
+}
+
+static inline uint32_t SimplifyHash(uint64_t key) {
+  key ^= key >> 33;
+  key *= 0xff51afd7ed558ccdULL;
+  key ^= key >> 33;
+  return (uint32_t)key;
+}
+
+static inline int SimplifyTableSize(int count) {
+  int size = 16;
+  while (size < count * 2) {
+    size *= 2;
+  }
+  return size;
+}
+
+// remap[v] = lowest vertex index with exactly the same position
+static int *WeldMeshPositions(const float *vertices, int vertexCount) {
+  int size = SimplifyTableSize(vertexCount);
+  int *table = (int *)malloc(sizeof(int) * size);
+  int *remap = (int *)malloc(sizeof(int) * vertexCount);
+  if (table == NULL || remap == NULL) {
+    free(table);
+    free(remap);
+    return NULL;
+  }
+  memset(table, -1, sizeof(int) * size);
+
+  for (int v = 0; v < vertexCount; v++) {
+    const float *p = &vertices[v * 3];
+    uint32_t bits[3];
+    memcpy(bits, p, sizeof(bits));
+    uint32_t slot = SimplifyHash(((uint64_t)bits[0] << 32) ^
+                                 ((uint64_t)bits[1] << 16) ^ bits[2]) &
+                    (size - 1);
+    while (table[slot] >= 0 &&
+           memcmp(&vertices[table[slot] * 3], p, sizeof(float) * 3) != 0) {
+      slot = (slot + 1) & (size - 1);
+    }
+    if (table[slot] < 0) {
+      table[slot] = v;
+    }
+    remap[v] = table[slot];
+  }
+  free(table);
+  return remap;
+}
+
+// Mark groups on an open edge (a directed edge without its reverse)
+static bool FindBorderGroups(const unsigned int *indices, int indexCount,
+                             const int *remap, bool *locked) {
+  int size = SimplifyTableSize(indexCount);
+  uint64_t *edges = (uint64_t *)malloc(sizeof(uint64_t) * size);
+  if (edges == NULL) {
+    return false;
+  }
+  memset(edges, 0xff, sizeof(uint64_t) * size); // All ones marks empty
+
+  for (int pass = 0; pass < 2; pass++) {
+    for (int i = 0; i < indexCount; i++) {
+      int a = remap[indices[i]];
+      int b = remap[indices[i % 3 == 2 ? i - 2 : i + 1]];
+      if (a == b) {
+        continue;
+      }
+      // First pass inserts directed edges, second looks up their reverse
+      uint64_t key = pass == 0 ? ((uint64_t)a << 32 | (uint32_t)b)
+                               : ((uint64_t)b << 32 | (uint32_t)a);
+      uint32_t slot = SimplifyHash(key) & (size - 1);
+      while (edges[slot] != UINT64_MAX && edges[slot] != key) {
+        slot = (slot + 1) & (size - 1);
+      }
+      if (pass == 0) {
+        edges[slot] = key;
+      } else if (edges[slot] != key) {
+        locked[a] = true;
+        locked[b] = true;
+      }
+    }
+  }
+  free(edges);
+  return true;
+}
+
+// Groups whose vertices disagree on texture coordinates sit on a UV seam
+static void FindSeamGroups(const Mesh *mesh, const int *remap, bool *seam) {
+  if (mesh->texcoords == NULL) {
+    return;
+  }
+  for (int v = 0; v < mesh->vertexCount; v++) {
+    int g = remap[v];
+    if (g != v && (mesh->texcoords[v * 2] != mesh->texcoords[g * 2] ||
+                   mesh->texcoords[v * 2 + 1] != mesh->texcoords[g * 2 + 1])) {
+      seam[g] = true;
+    }
+  }
+}
+
+static int CompareSimplifyCollapses(const void *a, const void *b) {
+  float ca = ((const SimplifyCollapse *)a)->cost;
+  float cb = ((const SimplifyCollapse *)b)->cost;
+  return (ca > cb) - (ca < cb);
+}
+
+// True if moving group `from` onto `to` turns any surviving triangle over
+static bool CollapseFlipsTriangle(const unsigned int *indices,
+                                  const int *remap, const float *vertices,
+                                  const int *adjacency, int adjacencyBegin,
+                                  int adjacencyEnd, int from, int to) {
+  Vector3 target = SimplifyPosition(vertices, to);
+  for (int k = adjacencyBegin; k < adjacencyEnd; k++) {
+    const unsigned int *tri = &indices[adjacency[k] * 3];
+    int g[3] = {remap[tri[0]], remap[tri[1]], remap[tri[2]]};
+    if (g[0] == to || g[1] == to || g[2] == to) {
+      continue; // Degenerates and is removed
+    }
+    Vector3 p[3], q[3];
+    for (int c = 0; c < 3; c++) {
+      p[c] = SimplifyPosition(vertices, g[c]);
+      q[c] = g[c] == from ? target : p[c];
+    }
+    Vector3 before = Vector3CrossProduct(Vector3Subtract(p[1], p[0]),
+                                         Vector3Subtract(p[2], p[0]));
+    Vector3 after = Vector3CrossProduct(Vector3Subtract(q[1], q[0]),
+                                        Vector3Subtract(q[2], q[0]));
+    if (Vector3DotProduct(before, after) <= 0.0f) {
+      return true;
+    }
+  }
+  return false;
+}
+
+// Simplify a triangle list over the mesh's vertices. indices may be NULL for
+// non-indexed meshes. Writes the simplified list to outIndices (room for
+// indexCount entries) and returns its length, or -1 when out of memory.
+// targetError caps the distance a surface may move, relative to the mesh
+// extent.
+static int SimplifyMeshIndices(const Mesh *mesh, const unsigned int *indices,
+                               int indexCount, int targetIndexCount,
+                               float targetError, unsigned int *outIndices) {
+  int n = mesh->vertexCount;
+  for (int i = 0; i < indexCount; i++) {
+    outIndices[i] = indices != NULL ? indices[i] : (unsigned int)i;
+  }
+  if (indexCount <= targetIndexCount || mesh->vertices == NULL) {
+    return indexCount;
+  }
+
+  int *remap = WeldMeshPositions(mesh->vertices, n);
+  Quadric *quadrics = (Quadric *)calloc(n, sizeof(Quadric));
+  bool *locked = (bool *)calloc(n, sizeof(bool));
+  bool *seam = (bool *)calloc(n, sizeof(bool));
+  int *collapseTo = (int *)malloc(sizeof(int) * n);
+  int *adjacencyOffsets = (int *)malloc(sizeof(int) * (n + 1));
+  int *adjacency = (int *)malloc(sizeof(int) * indexCount);
+  SimplifyCollapse *collapses =
+      (SimplifyCollapse *)malloc(sizeof(SimplifyCollapse) * indexCount * 2);
+  bool ok = remap && quadrics && locked && seam && collapseTo &&
+            adjacencyOffsets && adjacency && collapses &&
+            FindBorderGroups(outIndices, indexCount, remap, locked);
+
+  double errorLimit = 0.0;
+  if (ok) {
+    FindSeamGroups(mesh, remap, seam);
+
+    // Plane quadric of every triangle, weighted by area, on each corner
+    BoundingBox box = {{INFINITY, INFINITY, INFINITY},
+                       {-INFINITY, -INFINITY, -INFINITY}};
+    for (int i = 0; i < indexCount; i += 3) {
+      int g[3] = {remap[outIndices[i]], remap[outIndices[i + 1]],
+                  remap[outIndices[i + 2]]};
+      Vector3 p0 = SimplifyPosition(mesh->vertices, g[0]);
+      Vector3 normal = Vector3CrossProduct(
+          Vector3Subtract(SimplifyPosition(mesh->vertices, g[1]), p0),
+          Vector3Subtract(SimplifyPosition(mesh->vertices, g[2]), p0));
+      double length = Vector3Length(normal);
+      for (int c = 0; c < 3; c++) {
+        Vector3 p = SimplifyPosition(mesh->vertices, g[c]);
+        box.min = Vector3Min(box.min, p);
+        box.max = Vector3Max(box.max, p);
+      }
+      if (length <= 0.0) {
+        continue;
+      }
+      double a = normal.x / length, b = normal.y / length,
+             c = normal.z / length;
+      double d = -(a * p0.x + b * p0.y + c * p0.z);
+      for (int k = 0; k < 3; k++) {
+        QuadricAddPlane(&quadrics[g[k]], a, b, c, d, length * 0.5);
+      }
+    }
+    double extent = Vector3Length(Vector3Subtract(box.max, box.min));
+    errorLimit = (targetError * extent) * (targetError * extent);
+  }
+
+  for (int pass = 0; ok && pass < SIMPLIFY_MAX_PASSES &&
+                     indexCount > targetIndexCount;
+       pass++) {
+    // Triangles around each position group (counting sort)
+    memset(adjacencyOffsets, 0, sizeof(int) * (n + 1));
+    for (int i = 0; i < indexCount; i++) {
+      adjacencyOffsets[remap[outIndices[i]] + 1]++;
+    }
+    for (int v = 0; v < n; v++) {
+      adjacencyOffsets[v + 1] += adjacencyOffsets[v];
+    }
+    for (int i = 0; i < indexCount; i++) {
+      adjacency[adjacencyOffsets[remap[outIndices[i]]]++] = i / 3;
+    }
+    for (int v = n; v > 0; v--) {
+      adjacencyOffsets[v] = adjacencyOffsets[v - 1];
+    }
+    adjacencyOffsets[0] = 0;
+
+    // Candidate edges both ways; the cost uses the mean squared distance
+    int candidateCount = 0;
+    for (int i = 0; i < indexCount; i++) {
+      int a = remap[outIndices[i]];
+      int b = remap[outIndices[i % 3 == 2 ? i - 2 : i + 1]];
+      for (int dir = 0; dir < 2; dir++) {
+        int from = dir == 0 ? a : b;
+        int to = dir == 0 ? b : a;
+        if (from == to || locked[from] || seam[from] || seam[to]) {
+          continue;
+        }
+        Quadric q = quadrics[from];
+        QuadricAdd(&q, &quadrics[to]);
+        double error = QuadricError(&q, SimplifyPosition(mesh->vertices, to));
+        if (q.weight > 0.0) {
+          error /= q.weight;
+        }
+        if (error <= errorLimit) {
+          collapses[candidateCount++] = (SimplifyCollapse){(float)error,
+                                                           from, to};
+        }
+      }
+    }
+    if (candidateCount == 0) {
+      break;
+    }
+    qsort(collapses, candidateCount, sizeof(SimplifyCollapse),
+          CompareSimplifyCollapses);
+
+    // Cheapest first; a collapse freezes the triangles around it this pass
+    // (collapseTo[v] == -1 marks a frozen group that stays put)
+    for (int v = 0; v < n; v++) {
+      collapseTo[v] = v;
+    }
+    int remainingIndices = indexCount;
+    int performed = 0;
+    for (int k = 0; k < candidateCount && remainingIndices > targetIndexCount;
+         k++) {
+      int from = collapses[k].from, to = collapses[k].to;
+      if (collapseTo[from] != from || collapseTo[to] != to ||
+          CollapseFlipsTriangle(outIndices, remap, mesh->vertices, adjacency,
+                                adjacencyOffsets[from],
+                                adjacencyOffsets[from + 1], from, to)) {
+        continue;
+      }
+      for (int t = adjacencyOffsets[from]; t < adjacencyOffsets[from + 1];
+           t++) {
+        const unsigned int *tri = &outIndices[adjacency[t] * 3];
+        bool removed = false;
+        for (int c = 0; c < 3; c++) {
+          int g = remap[tri[c]];
+          removed |= g == to;
+          if (g != from) {
+            collapseTo[g] = -1;
+          }
+        }
+        if (removed) {
+          remainingIndices -= 3;
+        }
+      }
+      collapseTo[from] = to;
+      collapseTo[to] = -1;
+      QuadricAdd(&quadrics[to], &quadrics[from]);
+      performed++;
+    }
+    if (performed == 0) {
+      break;
+    }
+
+    // Apply: corners of moved groups take the target group's vertex, then
+    // drop triangles that collapsed to a line
+    int write = 0;
+    for (int i = 0; i < indexCount; i += 3) {
+      unsigned int tri[3];
+      for (int c = 0; c < 3; c++) {
+        int g = remap[outIndices[i + c]];
+        tri[c] = collapseTo[g] >= 0 && collapseTo[g] != g
+                     ? (unsigned int)collapseTo[g]
+                     : outIndices[i + c];
+      }
+      if (remap[tri[0]] == remap[tri[1]] || remap[tri[1]] == remap[tri[2]] ||
+          remap[tri[0]] == remap[tri[2]]) {
+        continue;
+      }
+      memcpy(&outIndices[write], tri, sizeof(tri));
+      write += 3;
+    }
+    indexCount = write;
+  }
+
+  free(remap);
+  free(quadrics);
+  free(locked);
+  free(seam);
+  free(collapseTo);
+  free(adjacencyOffsets);
+  free(adjacency);
+  free(collapses);
+  return ok ? indexCount : -1;
+}
+
+// New CPU mesh holding only the vertices a simplified index list uses, with
+// 16-bit indices like raylib's own meshes, allocated with MemAlloc so
+// UnloadMesh can release it. Copies positions, texture
+// coordinates, normals, tangents and colors; not for skinned meshes.
+// Returns false when out of memory or the vertices do not fit 16-bit indices.
+static bool BuildSimplifiedMesh(const Mesh *source, const unsigned int *indices,
+                                int indexCount, Mesh *out) {
+  memset(out, 0, sizeof(*out));
+  int *compact = (int *)malloc(sizeof(int) * source->vertexCount);
+  if (compact == NULL) {
+    return false;
+  }
+  memset(compact, -1, sizeof(int) * source->vertexCount);
+  int vertexCount = 0;
+  for (int i = 0; i < indexCount; i++) {
+    if (compact[indices[i]] < 0) {
+      compact[indices[i]] = vertexCount++;
+    }
+  }
+  if (vertexCount > 65535 || indexCount == 0) {
+    free(compact);
+    return false;
+  }
+
+  out->vertexCount = vertexCount;
+  out->triangleCount = indexCount / 3;
+  out->indices =
+      (unsigned short *)MemAlloc(sizeof(unsigned short) * indexCount);
+  out->vertices = (float *)MemAlloc(sizeof(float) * 3 * vertexCount);
+  if (source->texcoords)
+    out->texcoords = (float *)MemAlloc(sizeof(float) * 2 * vertexCount);
+  if (source->texcoords2)
+    out->texcoords2 = (float *)MemAlloc(sizeof(float) * 2 * vertexCount);
+  if (source->normals)
+    out->normals = (float *)MemAlloc(sizeof(float) * 3 * vertexCount);
+  if (source->tangents)
+    out->tangents = (float *)MemAlloc(sizeof(float) * 4 * vertexCount);
+  if (source->colors)
+    out->colors = (unsigned char *)MemAlloc(4 * vertexCount);
+
+  bool ok = out->indices && out->vertices &&
+            (!source->texcoords || out->texcoords) &&
+            (!source->texcoords2 || out->texcoords2) &&
+            (!source->normals || out->normals) &&
+            (!source->tangents || out->tangents) &&
+            (!source->colors || out->colors);
+  if (ok) {
+    for (int i = 0; i < indexCount; i++) {
+      out->indices[i] = (unsigned short)compact[indices[i]];
+    }
+    for (int v = 0; v < source->vertexCount; v++) {
+      int d = compact[v];
+      if (d < 0) {
+        continue;
+      }
+      memcpy(&out->vertices[d * 3], &source->vertices[v * 3],
+             sizeof(float) * 3);
+      if (out->texcoords)
+        memcpy(&out->texcoords[d * 2], &source->texcoords[v * 2],
+               sizeof(float) * 2);
+      if (out->texcoords2)
+        memcpy(&out->texcoords2[d * 2], &source->texcoords2[v * 2],
+               sizeof(float) * 2);
+      if (out->normals)
+        memcpy(&out->normals[d * 3], &source->normals[v * 3],
+               sizeof(float) * 3);
+      if (out->tangents)
+        memcpy(&out->tangents[d * 4], &source->tangents[v * 4],
+               sizeof(float) * 4);
+      if (out->colors)
+        memcpy(&out->colors[d * 4], &source->colors[v * 4], 4);
+    }
+  }
+  free(compact);
+  if (!ok) {
+    MemFree(out->indices);
+    MemFree(out->vertices);
+    MemFree(out->texcoords);
+    MemFree(out->texcoords2);
+    MemFree(out->normals);
+    MemFree(out->tangents);
+    MemFree(out->colors);
+    memset(out, 0, sizeof(*out));
+  }
+  return ok;
+}
+
+#endif // MESH_SIMPLIFY_H
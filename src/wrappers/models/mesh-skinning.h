@@ -0,0 +1,276 @@
+#ifndef MESH_SKINNING_H
+#define MESH_SKINNING_H
+
+// CPU linear blend skinning over a precomputed bone palette. Each palette
+// entry holds the bone matrix columns and the inverse-transpose normal matrix
+// columns, so per vertex the work is: blend up to 4 entries by weight, then
+// one matrix-vector product for the position and one for the normal.
+//
+// Same result as raylib's UpdateModelAnimation (Σ w·(B·v) == (Σ w·B)·v), which
+// instead transforms per bone and inverts the bone matrix for every normal.
+//
+// Paths: SSE (one 4-wide column per register, baseline on x86-64), scalar
+// otherwise. Vertex ranges are independent so callers can split them over
+// threads.
+
+#include "raylib.h"
+#include "raymath.h"
+#include "mesh-bvh.h"
+#include <stdbool.h>
+#include <stdlib.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SKIN_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+
+// Floats per bone: position columns x, y, z, translation then normal columns
+// x, y, z, 4 floats each (w unused)
+#define SKIN_PALETTE_STRIDE 28
+
+typedef struct {
+  float *data;    // 16-byte aligned, SKIN_PALETTE_STRIDE floats per bone
+  float *storage; // Allocation backing data
+  int boneCount;
+  int capacity; // Bones that fit without reallocating
+} SkinPalette;
+
+typedef struct {
+  const SkinPalette *palette;
+  const float *vertices;           // Bind pose positions
+  const float *normals;            // Bind pose normals, NULL to skip
+  const unsigned char *boneIds;    // 4 per vertex
+  const float *boneWeights;        // 4 per vertex
+  float *animVertices;             // Skinned positions out
+  float *animNormals;              // Skinned normals out, NULL to skip
+} SkinJob;
+
+static inline void UnloadSkinPalette(SkinPalette *palette) {
+  free(palette->storage);
+  palette->data = NULL;
+  palette->storage = NULL;
+  palette->boneCount = 0;
+  palette->capacity = 0;
+}
+
+static inline void SkinStoreColumn(float *dst, float x, float y, float z) {
+  dst[0] = x;
+  dst[1] = y;
+  dst[2] = z;
+  dst[3] = 0.0f;
+}
+
+// Fill palette from bone matrices (the boneMatrices raylib's
+// UpdateModelAnimationBones writes). Grows the palette when needed.
+static bool BuildSkinPalette(SkinPalette *palette, const Matrix *bones,
+                             int boneCount) {
+  if (boneCount > palette->capacity) {
+    float *storage = (float *)malloc(
+        (size_t)boneCount * SKIN_PALETTE_STRIDE * sizeof(float) + 16);
+    if (storage == NULL) {
+      return false;
+    }
+    free(palette->storage);
+    palette->storage = storage;
+    palette->data = (float *)(((size_t)storage + 15) & ~(size_t)15);
+    palette->capacity = boneCount;
+  }
+
+  for (int i = 0; i < boneCount; i++) {
+    const Matrix b = bones[i];
+    const Matrix n = MatrixTranspose(MatrixInvert(b));
+    float *dst = palette->data + (size_t)i * SKIN_PALETTE_STRIDE;
+    SkinStoreColumn(dst, b.m0, b.m1, b.m2);
+    SkinStoreColumn(dst + 4, b.m4, b.m5, b.m6);
+    SkinStoreColumn(dst + 8, b.m8, b.m9, b.m10);
+    SkinStoreColumn(dst + 12, b.m12, b.m13, b.m14);
+    SkinStoreColumn(dst + 16, n.m0, n.m1, n.m2);
+    SkinStoreColumn(dst + 20, n.m4, n.m5, n.m6);
+    SkinStoreColumn(dst + 24, n.m8, n.m9, n.m10);
+  }
+  palette->boneCount = boneCount;
+  return true;
+}
+
+static inline void SkinVerticesScalar(const SkinJob *job, int begin, int end) {
+  const int boneCount = job->palette->boneCount;
+  for (int v = begin; v < end; v++) {
+    float m[SKIN_PALETTE_STRIDE] = {0};
+    for (int j = 0; j < 4; j++) {
+      const float w = job->boneWeights[v * 4 + j];
+      const int id = job->boneIds[v * 4 + j];
+      // Zero weights are skipped like raylib does, bad ids are ignored
+      if (w == 0.0f || id >= boneCount) {
+        continue;
+      }
+      const float *b = job->palette->data + (size_t)id * SKIN_PALETTE_STRIDE;
+      for (int k = 0; k < SKIN_PALETTE_STRIDE; k++) {
+        m[k] += w * b[k];
+      }
+    }
+
+    const float x = job->vertices[v * 3];
+    const float y = job->vertices[v * 3 + 1];
+    const float z = job->vertices[v * 3 + 2];
+    float *out = job->animVertices + v * 3;
+    out[0] = m[0] * x + m[4] * y + m[8] * z + m[12];
+    out[1] = m[1] * x + m[5] * y + m[9] * z + m[13];
+    out[2] = m[2] * x + m[6] * y + m[10] * z + m[14];
+
+    if (job->animNormals != NULL) {
+      const float nx = job->normals[v * 3];
+      const float ny = job->normals[v * 3 + 1];
+      const float nz = job->normals[v * 3 + 2];
+      float *outNormal = job->animNormals + v * 3;
+      outNormal[0] = m[16] * nx + m[20] * ny + m[24] * nz;
+      outNormal[1] = m[17] * nx + m[21] * ny + m[25] * nz;
+      outNormal[2] = m[18] * nx + m[22] * ny + m[26] * nz;
+    }
+  }
+}
+
+#if SKIN_SIMD_SSE
+static inline void SkinStore3(float *dst, __m128 v) {
+  _mm_store_ss(dst, v);
+  _mm_store_ss(dst + 1, _mm_shuffle_ps(v, v, _MM_SHUFFLE(1, 1, 1, 1)));
+  _mm_store_ss(dst + 2, _mm_shuffle_ps(v, v, _MM_SHUFFLE(2, 2, 2, 2)));
+}
+
+static void SkinVerticesSSE(const SkinJob *job, int begin, int end) {
+  const int boneCount = job->palette->boneCount;
+  const bool skinNormals = job->animNormals != NULL;
+  for (int v = begin; v < end; v++) {
+    __m128 c0 = _mm_setzero_ps(), c1 = c0, c2 = c0, c3 = c0;
+    __m128 n0 = c0, n1 = c0, n2 = c0;
+    for (int j = 0; j < 4; j++) {
+      const float w = job->boneWeights[v * 4 + j];
+      const int id = job->boneIds[v * 4 + j];
+      if (w == 0.0f || id >= boneCount) {
+        continue;
+      }
+      const float *b = job->palette->data + (size_t)id * SKIN_PALETTE_STRIDE;
+      const __m128 wv = _mm_set1_ps(w);
+      c0 = _mm_add_ps(c0, _mm_mul_ps(wv, _mm_load_ps(b)));
+      c1 = _mm_add_ps(c1, _mm_mul_ps(wv, _mm_load_ps(b + 4)));
+      c2 = _mm_add_ps(c2, _mm_mul_ps(wv, _mm_load_ps(b + 8)));
+      c3 = _mm_add_ps(c3, _mm_mul_ps(wv, _mm_load_ps(b + 12)));
+      if (skinNormals) {
+        n0 = _mm_add_ps(n0, _mm_mul_ps(wv, _mm_load_ps(b + 16)));
+        n1 = _mm_add_ps(n1, _mm_mul_ps(wv, _mm_load_ps(b + 20)));
+        n2 = _mm_add_ps(n2, _mm_mul_ps(wv, _mm_load_ps(b + 24)));
+      }
+    }
+
+    const float *p = job->vertices + v * 3;
+    __m128 pos = _mm_add_ps(
+        _mm_add_ps(_mm_mul_ps(c0, _mm_set1_ps(p[0])),
+                   _mm_mul_ps(c1, _mm_set1_ps(p[1]))),
+        _mm_add_ps(_mm_mul_ps(c2, _mm_set1_ps(p[2])), c3));
+    SkinStore3(job->animVertices + v * 3, pos);
+
+    if (skinNormals) {
+      const float *n = job->normals + v * 3;
+      __m128 normal = _mm_add_ps(
+          _mm_add_ps(_mm_mul_ps(n0, _mm_set1_ps(n[0])),
+                     _mm_mul_ps(n1, _mm_set1_ps(n[1]))),
+          _mm_mul_ps(n2, _mm_set1_ps(n[2])));
+      SkinStore3(job->animNormals + v * 3, normal);
+    }
+  }
+}
+#endif
+
+// JobRangeFunction entry point: skin vertices [begin, end) of a SkinJob
+static void SkinVerticesRange(void *data, int begin, int end) {
+#if SKIN_SIMD_SSE
+  SkinVerticesSSE((const SkinJob *)data, begin, end);
+#else
+  SkinVerticesScalar((const SkinJob *)data, begin, end);
+#endif
+}
+
+// Skinned bounds. A skinned vertex is s times a weighted average of B·v over
+// its bones, s being its weight sum. With s = 1 it lies inside the union of
+// each bone's bind pose box (the vertices that bone moves) under that bone's
+// matrix; otherwise each B·v is scaled by s about the origin, so a bone's
+// transformed box is stretched over the range of sums of its vertices.
+// Bounding a pose then costs one box transform per bone instead of a pass
+// over the vertices.
+
+// Bind pose box of the vertices a bone influences and the range of their
+// weight sums
+typedef struct {
+  BoundingBox box; // Empty for bones that move nothing
+  float minWeightSum;
+  float maxWeightSum;
+} BoneBounds;
+
+// boneCount entries plus one last box merged untransformed, which holds the
+// origin when some vertex has no bone influence at all (it skins to zero).
+// Needs boneIds, boneWeights and vertices.
+static void BuildBoneBounds(const Mesh *mesh, int boneCount,
+                            BoneBounds *outBounds) {
+  for (int b = 0; b <= boneCount; b++) {
+    outBounds[b].box = BVHEmptyBox();
+    outBounds[b].minWeightSum = 1.0f;
+    outBounds[b].maxWeightSum = 1.0f;
+  }
+  for (int v = 0; v < mesh->vertexCount; v++) {
+    Vector3 p = {mesh->vertices[v * 3], mesh->vertices[v * 3 + 1],
+                 mesh->vertices[v * 3 + 2]};
+    float weightSum = 0.0f;
+    for (int j = 0; j < 4; j++) {
+      float w = mesh->boneWeights[v * 4 + j];
+      int id = mesh->boneIds[v * 4 + j];
+      if (w != 0.0f && id < boneCount) { // Skipped by the kernels otherwise
+        weightSum += w;
+      }
+    }
+    if (weightSum == 0.0f) {
+      BVHGrowBox(&outBounds[boneCount].box, Vector3Zero());
+      continue;
+    }
+    for (int j = 0; j < 4; j++) {
+      float w = mesh->boneWeights[v * 4 + j];
+      int id = mesh->boneIds[v * 4 + j];
+      if (w == 0.0f || id >= boneCount) {
+        continue;
+      }
+      BoneBounds *bone = &outBounds[id];
+      BVHGrowBox(&bone->box, p);
+      bone->minWeightSum = fminf(bone->minWeightSum, weightSum);
+      bone->maxWeightSum = fmaxf(bone->maxWeightSum, weightSum);
+    }
+  }
+}
+
+// Box scaled about the origin (factor >= 0)
+static BoundingBox ScaleBoxAboutOrigin(BoundingBox box, float factor) {
+  box.min = Vector3Scale(box.min, factor);
+  box.max = Vector3Scale(box.max, factor);
+  return box;
+}
+
+// Box around a mesh skinned with bones, from its BuildBoneBounds entries
+static BoundingBox SkinnedMeshBounds(const BoneBounds *boneBounds,
+                                     int boneCount, const Matrix *bones) {
+  BoundingBox box = boneBounds[boneCount].box;
+  for (int b = 0; b < boneCount; b++) {
+    const BoneBounds *bone = &boneBounds[b];
+    if (bone->box.min.x > bone->box.max.x) {
+      continue;
+    }
+    BoundingBox moved = BVHTransformBox(bone->box, bones[b]);
+    // Points between s_min·B·v and s_max·B·v: the box holds both ends
+    if (bone->minWeightSum != 1.0f) {
+      BVHMergeBox(&box, ScaleBoxAboutOrigin(moved, bone->minWeightSum));
+    }
+    if (bone->maxWeightSum != 1.0f) {
+      BVHMergeBox(&box, ScaleBoxAboutOrigin(moved, bone->maxWeightSum));
+    }
+    BVHMergeBox(&box, moved);
+  }
+  return box;
+}
+
+#endif // MESH_SKINNING_H
@@ -0,0 +1,881 @@
+#ifndef MODEL_BINARY_CACHE_H
+#define MODEL_BINARY_CACHE_H
+
+// Flat binary snapshot of a loaded model: meshes, materials with their
+// texture pixels, skeleton, bounding boxes and animations. Every block starts
+// on a 16-byte boundary, so a mapped file is read in place: nothing is
+// parsed, texture pixels go to the GPU straight from the mapping, and mesh
+// arrays are copied once into buffers raylib owns (UnloadModel frees them).
+// Reading a file needs no GL context, so async loads do it on a worker and
+// leave only the texture and mesh uploads to the GL thread.
+//
+// A file stores the size, modification time and content hash of its source.
+// It is used when size and time match, or when only the time changed but the
+// content hash still matches (a touched or copied file).
+//
+// File layout: header, textures, materials, meshMaterial, bones, bindPose,
+// per-mesh bounds, meshes, animations. Not portable between architectures
+// (native byte order and struct layout, checked through the header).
+
+#include "raylib.h"
+#include "raymath.h"
+#include "rlgl.h"
+#include "model-prefetch.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#ifdef _WIN32
+// windows.h clashes with raylib.h, see job-pool.h
+__declspec(dllimport) void *__stdcall CreateFileA(
+    const char *name, unsigned long access, unsigned long share,
+    void *security, unsigned long disposition, unsigned long flags,
+    void *templateFile);
+__declspec(dllimport) void *__stdcall CreateFileMappingA(
+    void *file, void *attributes, unsigned long protect,
+    unsigned long sizeHigh, unsigned long sizeLow, const char *name);
+__declspec(dllimport) void *__stdcall MapViewOfFile(void *mapping,
+                                                    unsigned long access,
+                                                    unsigned long offsetHigh,
+                                                    unsigned long offsetLow,
+                                                    size_t bytes);
+__declspec(dllimport) int __stdcall UnmapViewOfFile(const void *address);
+__declspec(dllimport) int __stdcall GetFileSizeEx(void *file, long long *size);
+__declspec(dllimport) int __stdcall CloseHandle(void *handle);
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#define MODEL_CACHE_FILE_MAGIC "RLJSMDL1"
+#define MODEL_CACHE_FILE_VERSION 1
+#define MODEL_CACHE_FILE_BYTE_ORDER 0x01020304u
+#define MODEL_CACHE_FILE_ALIGN 16
+#define MODEL_CACHE_FILE_EXTENSION ".rlmc"
+#define MODEL_CACHE_MATERIAL_MAPS (MATERIAL_MAP_BRDF + 1)
+
+// Texture index values in a material map besides table entries
+#define MODEL_CACHE_TEXTURE_NONE -1    // id 0
+#define MODEL_CACHE_TEXTURE_DEFAULT -2 // rlgl's 1x1 white texture
+
+// Mesh attribute bits, in this order in the file
+#define MODEL_CACHE_VERTICES (1 << 0)
+#define MODEL_CACHE_TEXCOORDS (1 << 1)
+#define MODEL_CACHE_TEXCOORDS2 (1 << 2)
+#define MODEL_CACHE_NORMALS (1 << 3)
+#define MODEL_CACHE_TANGENTS (1 << 4)
+#define MODEL_CACHE_COLORS (1 << 5)
+#define MODEL_CACHE_ANIM_VERTICES (1 << 6)
+#define MODEL_CACHE_ANIM_NORMALS (1 << 7)
+#define MODEL_CACHE_BONE_IDS (1 << 8)
+#define MODEL_CACHE_BONE_WEIGHTS (1 << 9)
+#define MODEL_CACHE_INDICES (1 << 10)
+#define MODEL_CACHE_ATTRIBUTE_COUNT 11
+
+typedef struct {
+  char magic[8];
+  uint32_t version;
+  uint32_t byteOrder;
+  uint32_t headerSize; // sizeof(ModelCacheFileHeader), catches ABI changes
+  uint32_t meshSize;   // sizeof(Mesh)
+  uint64_t sourceHash;
+  int64_t sourceModTime;
+  int64_t sourceSize;
+  int32_t meshCount;
+  int32_t materialCount;
+  int32_t textureCount;
+  int32_t boneCount;
+  int32_t animationCount;
+  int32_t reserved[3];
+  Matrix transform;
+  BoundingBox bounds;
+} ModelCacheFileHeader;
+
+typedef struct {
+  int32_t width;
+  int32_t height;
+  int32_t format;
+  int32_t dataSize; // Pixel bytes that follow
+} ModelCacheTextureRecord;
+
+typedef struct {
+  int32_t texture; // Texture table index or MODEL_CACHE_TEXTURE_*
+  Color color;
+  float value;
+} ModelCacheMapRecord;
+
+typedef struct {
+  float params[4];
+  ModelCacheMapRecord maps[MODEL_CACHE_MATERIAL_MAPS];
+} ModelCacheMaterialRecord;
+
+typedef struct {
+  int32_t vertexCount;
+  int32_t triangleCount;
+  int32_t boneCount;
+  int32_t attributes; // MODEL_CACHE_* bits
+} ModelCacheMeshRecord;
+
+typedef struct {
+  char name[32];
+  int32_t boneCount;
+  int32_t frameCount;
+} ModelCacheAnimationRecord;
+
+typedef struct {
+  const unsigned char *data;
+  size_t size;
+#ifdef _WIN32
+  void *file;
+  void *mapping;
+#endif
+} ModelCacheMapping;
+
+// --- Mapping -----------------------------------------------------------------
+
+static bool MapModelCacheFile(const char *path, ModelCacheMapping *map) {
+  memset(map, 0, sizeof(*map));
+#ifdef _WIN32
+  map->file = CreateFileA(path, 0x80000000UL /* GENERIC_READ */,
+                          1 /* FILE_SHARE_READ */, NULL, 3 /* OPEN_EXISTING */,
+                          0x80 /* FILE_ATTRIBUTE_NORMAL */, NULL);
+  long long size = 0;
+  if (map->file == (void *)-1 || !GetFileSizeEx(map->file, &size) ||
+      size <= 0) {
+    if (map->file != (void *)-1) {
+      CloseHandle(map->file);
+    }
+    return false;
+  }
+  map->mapping =
+      CreateFileMappingA(map->file, NULL, 2 /* PAGE_READONLY */, 0, 0, NULL);
+  void *view = map->mapping != NULL
+                   ? MapViewOfFile(map->mapping, 4 /* FILE_MAP_READ */, 0, 0, 0)
+                   : NULL;
+  if (view == NULL) {
+    if (map->mapping != NULL) {
+      CloseHandle(map->mapping);
+    }
+    CloseHandle(map->file);
+    return false;
+  }
+  map->data = (const unsigned char *)view;
+  map->size = (size_t)size;
+#else
+  int fd = open(path, O_RDONLY);
+  if (fd < 0) {
+    return false;
+  }
+  struct stat info;
+  void *view = MAP_FAILED;
+  if (fstat(fd, &info) == 0 && info.st_size > 0) {
+    view = mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  close(fd); // The mapping stays valid
+  if (view == MAP_FAILED) {
+    return false;
+  }
+  map->data = (const unsigned char *)view;
+  map->size = (size_t)info.st_size;
+#endif
+  return true;
+}
+
+static void UnmapModelCacheFile(ModelCacheMapping *map) {
+  if (map->data == NULL) {
+    return;
+  }
+#ifdef _WIN32
+  UnmapViewOfFile(map->data);
+  CloseHandle(map->mapping);
+  CloseHandle(map->file);
+#else
+  munmap((void *)map->data, map->size);
+#endif
+  map->data = NULL;
+}
+
+// --- Reading and writing blocks -------------------------------------------
+
+typedef struct {
+  const unsigned char *data;
+  size_t size;
+  size_t offset;
+  bool ok; // Cleared by the first read past the end
+} ModelCacheReader;
+
+typedef struct {
+  FILE *file;
+  size_t offset;
+  bool ok;
+} ModelCacheWriter;
+
+static inline size_t ModelCacheAlign(size_t size) {
+  return (size + MODEL_CACHE_FILE_ALIGN - 1) &
+         ~(size_t)(MODEL_CACHE_FILE_ALIGN - 1);
+}
+
+// Pointer to the next block of `size` bytes, NULL (and ok cleared) if the
+// file is too short
+static const void *ModelCacheRead(ModelCacheReader *reader, size_t size) {
+  size_t aligned = ModelCacheAlign(size);
+  if (!reader->ok || aligned < size ||
+      reader->size - reader->offset < aligned) {
+    reader->ok = false;
+    return NULL;
+  }
+  const void *block = reader->data + reader->offset;
+  reader->offset += aligned;
+  return block;
+}
+
+// Block count * size with the multiplication checked
+static const void *ModelCacheReadArray(ModelCacheReader *reader, int count,
+                                       size_t size) {
+  if (count < 0 || (count > 0 && size > SIZE_MAX / (size_t)count)) {
+    reader->ok = false;
+    return NULL;
+  }
+  return ModelCacheRead(reader, (size_t)count * size);
+}
+
+static void ModelCacheWriteBytes(ModelCacheWriter *writer, const void *data,
+                                 size_t size) {
+  if (writer->ok && size > 0) {
+    writer->ok = fwrite(data, 1, size, writer->file) == size;
+  }
+  writer->offset += size;
+}
+
+// Zeros up to the next block boundary
+static void ModelCacheWritePadding(ModelCacheWriter *writer) {
+  static const unsigned char padding[MODEL_CACHE_FILE_ALIGN] = {0};
+  ModelCacheWriteBytes(writer, padding,
+                       ModelCacheAlign(writer->offset) - writer->offset);
+}
+
+static void ModelCacheWrite(ModelCacheWriter *writer, const void *data,
+                            size_t size) {
+  ModelCacheWriteBytes(writer, data, size);
+  ModelCacheWritePadding(writer);
+}
+
+// --- Keys ------------------------------------------------------------------
+
+// Cache file path for a (canonical) model path
+static bool GetModelCacheFilePath(const char *path, char *out, size_t size) {
+  int length = snprintf(out, size, "%s%s", path, MODEL_CACHE_FILE_EXTENSION);
+  return length > 0 && (size_t)length < size;
+}
+
+// Content hash of the source, 0 if it cannot be read
+static uint64_t HashModelSource(const char *sourcePath) {
+  int size = 0;
+  unsigned char *data = PrefetchReadFile(sourcePath, &size);
+  uint64_t hash = data != NULL ? HashModelBytes(data, size) : 0;
+  free(data);
+  return hash;
+}
+
+static bool ModelCacheHeaderMatches(const ModelCacheFileHeader *header,
+                                    const char *sourcePath) {
+  if (memcmp(header->magic, MODEL_CACHE_FILE_MAGIC, 8) != 0 ||
+      header->version != MODEL_CACHE_FILE_VERSION ||
+      header->byteOrder != MODEL_CACHE_FILE_BYTE_ORDER ||
+      header->headerSize != sizeof(ModelCacheFileHeader) ||
+      header->meshSize != sizeof(Mesh) ||
+      header->sourceSize != GetFileLength(sourcePath)) {
+    return false;
+  }
+  if (header->sourceModTime == (int64_t)GetFileModTime(sourcePath)) {
+    return true;
+  }
+  return header->sourceHash != 0 &&
+         header->sourceHash == HashModelSource(sourcePath);
+}
+
+// --- Writing -----------------------------------------------------------------
+
+// Textures referenced by the materials, each once. Returns the count.
+static int CollectModelCacheTextures(const Model *model, Texture2D *textures,
+                                     int capacity) {
+  int count = 0;
+  for (int i = 0; i < model->materialCount; i++) {
+    if (model->materials[i].maps == NULL) {
+      continue;
+    }
+    for (int m = 0; m < MODEL_CACHE_MATERIAL_MAPS; m++) {
+      Texture2D texture = model->materials[i].maps[m].texture;
+      if (texture.id == 0 || texture.id == rlGetTextureIdDefault()) {
+        continue;
+      }
+      bool seen = false;
+      for (int t = 0; t < count && !seen; t++) {
+        seen = textures[t].id == texture.id;
+      }
+      if (!seen && count < capacity) {
+        textures[count++] = texture;
+      }
+    }
+  }
+  return count;
+}
+
+static int32_t FindModelCacheTexture(const Texture2D *textures, int count,
+                                     Texture2D texture) {
+  if (texture.id == 0) {
+    return MODEL_CACHE_TEXTURE_NONE;
+  }
+  for (int t = 0; t < count; t++) {
+    if (textures[t].id == texture.id) {
+      return t;
+    }
+  }
+  return MODEL_CACHE_TEXTURE_DEFAULT; // Default or unreadable texture
+}
+
+static void WriteModelCacheMesh(ModelCacheWriter *writer, const Mesh *mesh) {
+  const void *arrays[MODEL_CACHE_ATTRIBUTE_COUNT] = {
+      mesh->vertices,     mesh->texcoords,   mesh->texcoords2,
+      mesh->normals,      mesh->tangents,    mesh->colors,
+      mesh->animVertices, mesh->animNormals, mesh->boneIds,
+      mesh->boneWeights,  mesh->indices};
+  const size_t sizes[MODEL_CACHE_ATTRIBUTE_COUNT] = {
+      12, 8, 8, 12, 16, 4, 12, 12, 4, 16, 0};
+
+  ModelCacheMeshRecord record = {mesh->vertexCount, mesh->triangleCount,
+                                 mesh->boneCount, 0};
+  for (int a = 0; a < MODEL_CACHE_ATTRIBUTE_COUNT; a++) {
+    if (arrays[a] != NULL) {
+      record.attributes |= 1 << a;
+    }
+  }
+  ModelCacheWrite(writer, &record, sizeof(record));
+  for (int a = 0; a < MODEL_CACHE_ATTRIBUTE_COUNT - 1; a++) {
+    if (arrays[a] != NULL) {
+      ModelCacheWrite(writer, arrays[a], sizes[a] * mesh->vertexCount);
+    }
+  }
+  if (mesh->indices != NULL) {
+    ModelCacheWrite(writer, mesh->indices,
+                    sizeof(unsigned short) * 3 * mesh->triangleCount);
+  }
+}
+
+// Write a cache file for a loaded model (and optionally its animations).
+// Texture pixels are read back from the GPU, so call on the GL thread.
+// Writes to a temporary file first so readers never see a partial file.
+static bool WriteModelCacheFile(const char *cachePath, const char *sourcePath,
+                                uint64_t sourceHash, const Model *model,
+                                BoundingBox bounds,
+                                const BoundingBox *meshBounds,
+                                const ModelAnimation *animations,
+                                int animationCount) {
+  char tempPath[600];
+  if (snprintf(tempPath, sizeof(tempPath), "%s.tmp", cachePath) >=
+      (int)sizeof(tempPath)) {
+    return false;
+  }
+
+  Texture2D *textures = (Texture2D *)malloc(
+      sizeof(Texture2D) *
+      (model->materialCount * MODEL_CACHE_MATERIAL_MAPS + 1));
+  ModelCacheWriter writer = {fopen(tempPath, "wb"), 0, true};
+  if (textures == NULL || writer.file == NULL) {
+    free(textures);
+    if (writer.file != NULL) {
+      fclose(writer.file);
+    }
+    return false;
+  }
+  int textureCount = CollectModelCacheTextures(
+      model, textures, model->materialCount * MODEL_CACHE_MATERIAL_MAPS);
+
+  // Pixels first: textures that cannot be read back become the default
+  Image *images = (Image *)calloc(textureCount + 1, sizeof(Image));
+  int written = 0;
+  for (int t = 0; images != NULL && t < textureCount; t++) {
+    Image image = LoadImageFromTexture(textures[t]);
+    if (image.data == NULL) {
+      continue;
+    }
+    images[written] = image;
+    textures[written++] = textures[t];
+  }
+  textureCount = images != NULL ? written : 0;
+
+  ModelCacheFileHeader header = {0};
+  memcpy(header.magic, MODEL_CACHE_FILE_MAGIC, 8);
+  header.version = MODEL_CACHE_FILE_VERSION;
+  header.byteOrder = MODEL_CACHE_FILE_BYTE_ORDER;
+  header.headerSize = sizeof(ModelCacheFileHeader);
+  header.meshSize = sizeof(Mesh);
+  header.sourceHash = sourceHash;
+  header.sourceModTime = (int64_t)GetFileModTime(sourcePath);
+  header.sourceSize = GetFileLength(sourcePath);
+  header.meshCount = model->meshCount;
+  header.materialCount = model->materialCount;
+  header.textureCount = textureCount;
+  header.boneCount = model->boneCount;
+  header.animationCount = animationCount;
+  header.transform = model->transform;
+  header.bounds = bounds;
+  ModelCacheWrite(&writer, &header, sizeof(header));
+
+  for (int t = 0; t < textureCount; t++) {
+    ModelCacheTextureRecord record = {
+        images[t].width, images[t].height, images[t].format,
+        GetPixelDataSize(images[t].width, images[t].height, images[t].format)};
+    ModelCacheWrite(&writer, &record, sizeof(record));
+    ModelCacheWrite(&writer, images[t].data, record.dataSize);
+    UnloadImage(images[t]);
+  }
+  free(images);
+
+  for (int i = 0; i < model->materialCount; i++) {
+    ModelCacheMaterialRecord record = {0};
+    const Material *material = &model->materials[i];
+    memcpy(record.params, material->params, sizeof(record.params));
+    for (int m = 0; m < MODEL_CACHE_MATERIAL_MAPS; m++) {
+      record.maps[m].texture = MODEL_CACHE_TEXTURE_NONE;
+      if (material->maps != NULL) {
+        record.maps[m].texture = FindModelCacheTexture(
+            textures, textureCount, material->maps[m].texture);
+        record.maps[m].color = material->maps[m].color;
+        record.maps[m].value = material->maps[m].value;
+      }
+    }
+    ModelCacheWrite(&writer, &record, sizeof(record));
+  }
+  free(textures);
+
+  ModelCacheWrite(&writer, model->meshMaterial,
+                  sizeof(int) * model->meshCount);
+  ModelCacheWrite(&writer, model->bones, sizeof(BoneInfo) * model->boneCount);
+  ModelCacheWrite(&writer, model->bindPose,
+                  sizeof(Transform) * model->boneCount);
+  for (int i = 0; i < model->meshCount; i++) {
+    BoundingBox box = meshBounds != NULL ? meshBounds[i] : bounds;
+    ModelCacheWriteBytes(&writer, &box, sizeof(box));
+  }
+  ModelCacheWritePadding(&writer);
+  for (int i = 0; i < model->meshCount; i++) {
+    WriteModelCacheMesh(&writer, &model->meshes[i]);
+  }
+
+  for (int i = 0; i < animationCount; i++) {
+    const ModelAnimation *anim = &animations[i];
+    ModelCacheAnimationRecord record = {{0}, anim->boneCount,
+                                        anim->frameCount};
+    memcpy(record.name, anim->name, sizeof(record.name));
+    ModelCacheWrite(&writer, &record, sizeof(record));
+    ModelCacheWrite(&writer, anim->bones, sizeof(BoneInfo) * anim->boneCount);
+    // Frames back to back, aligned as one block
+    size_t frameBytes = sizeof(Transform) * anim->boneCount;
+    for (int f = 0; f < anim->frameCount; f++) {
+      ModelCacheWriteBytes(&writer, anim->framePoses[f], frameBytes);
+    }
+    ModelCacheWritePadding(&writer);
+  }
+
+  bool ok = fclose(writer.file) == 0 && writer.ok;
+  if (ok) {
+    remove(cachePath); // rename does not replace on Windows
+    ok = rename(tempPath, cachePath) == 0;
+  }
+  if (!ok) {
+    remove(tempPath);
+  }
+  return ok;
+}
+
+// --- Loading -------------------------------------------------------------------
+
+// Copy of a mapped block into raylib-owned memory (freed by UnloadModel)
+static void *CopyModelCacheBlock(ModelCacheReader *reader, int count,
+                                 size_t size) {
+  const void *block = ModelCacheReadArray(reader, count, size);
+  if (block == NULL || count == 0) {
+    return NULL;
+  }
+  void *copy = MemAlloc((unsigned int)(count * size));
+  if (copy != NULL) {
+    memcpy(copy, block, count * size);
+  } else {
+    reader->ok = false;
+  }
+  return copy;
+}
+
+static bool ReadModelCacheMesh(ModelCacheReader *reader, Mesh *mesh) {
+  const ModelCacheMeshRecord *record =
+      ModelCacheRead(reader, sizeof(ModelCacheMeshRecord));
+  if (record == NULL || record->vertexCount < 0 ||
+      record->triangleCount < 0 || record->boneCount < 0) {
+    reader->ok = false;
+    return false;
+  }
+  static const size_t sizes[MODEL_CACHE_ATTRIBUTE_COUNT - 1] = {
+      12, 8, 8, 12, 16, 4, 12, 12, 4, 16};
+  void **arrays[MODEL_CACHE_ATTRIBUTE_COUNT - 1] = {
+      (void **)&mesh->vertices,     (void **)&mesh->texcoords,
+      (void **)&mesh->texcoords2,   (void **)&mesh->normals,
+      (void **)&mesh->tangents,     (void **)&mesh->colors,
+      (void **)&mesh->animVertices, (void **)&mesh->animNormals,
+      (void **)&mesh->boneIds,      (void **)&mesh->boneWeights};
+
+  mesh->vertexCount = record->vertexCount;
+  mesh->triangleCount = record->triangleCount;
+  int attributes = record->attributes;
+  for (int a = 0; a < MODEL_CACHE_ATTRIBUTE_COUNT - 1; a++) {
+    if (attributes & (1 << a)) {
+      *arrays[a] = CopyModelCacheBlock(reader, mesh->vertexCount, sizes[a]);
+    }
+  }
+  if (attributes & MODEL_CACHE_INDICES) {
+    mesh->indices = (unsigned short *)CopyModelCacheBlock(
+        reader, mesh->triangleCount * 3, sizeof(unsigned short));
+    for (int i = 0; reader->ok && i < mesh->triangleCount * 3; i++) {
+      reader->ok = mesh->indices[i] < mesh->vertexCount;
+    }
+  }
+  if (reader->ok && record->boneCount > 0) {
+    mesh->boneCount = record->boneCount;
+    mesh->boneMatrices =
+        (Matrix *)MemAlloc(sizeof(Matrix) * (unsigned int)mesh->boneCount);
+    reader->ok = mesh->boneMatrices != NULL;
+    for (int b = 0; reader->ok && b < mesh->boneCount; b++) {
+      mesh->boneMatrices[b] = MatrixIdentity();
+    }
+  }
+  return reader->ok && mesh->vertices != NULL;
+}
+
+// CPU side of a model read from a cache file: meshes still to upload and the
+// texture table still to create, pixels read in place from the mapping.
+// ReadModelCacheFile builds it off the GL thread, UploadModelCacheStep turns
+// it into GPU objects one texture or mesh at a time, FinishModelCacheLoad
+// hands out the model.
+typedef struct {
+  ModelCacheMapping map; // Kept until the textures are created
+  Model model;           // Materials are built by FinishModelCacheLoad
+  BoundingBox bounds;
+  BoundingBox *meshBounds;
+  Image *images;       // Texture table
+  Texture2D *textures; // Created so far
+  ModelCacheMaterialRecord *materialRecords;
+  int textureCount;
+  int texturesCreated;
+  int meshesUploaded;
+} ModelCacheLoad;
+
+// Release whatever a load still owns (uploaded parts included)
+static void UnloadModelCacheLoad(ModelCacheLoad *load) {
+  for (int t = 0; t < load->texturesCreated; t++) {
+    UnloadTexture(load->textures[t]);
+  }
+  if (load->model.meshes == NULL) {
+    load->model.meshCount = 0;
+  }
+  if (load->model.materials == NULL) {
+    load->model.materialCount = 0; // Not built yet
+  }
+  UnloadModel(load->model);
+  free(load->images);
+  free(load->textures);
+  free(load->materialRecords);
+  free(load->meshBounds);
+  UnmapModelCacheFile(&load->map);
+  memset(load, 0, sizeof(*load));
+}
+
+// Map a valid cache file for sourcePath and read everything but the GPU
+// objects. No GL calls, so safe on a worker thread. Returns false (with
+// nothing left allocated) for a missing, stale or damaged file.
+static bool ReadModelCacheFile(const char *cachePath, const char *sourcePath,
+                               ModelCacheLoad *load) {
+  memset(load, 0, sizeof(*load));
+  if (!MapModelCacheFile(cachePath, &load->map)) {
+    return false;
+  }
+  ModelCacheReader reader = {load->map.data, load->map.size, 0, true};
+  const ModelCacheFileHeader *header =
+      ModelCacheRead(&reader, sizeof(ModelCacheFileHeader));
+  if (header == NULL || !ModelCacheHeaderMatches(header, sourcePath) ||
+      header->meshCount <= 0 || header->materialCount < 0 ||
+      header->textureCount < 0 || header->boneCount < 0) {
+    UnmapModelCacheFile(&load->map);
+    return false;
+  }
+
+  Model *model = &load->model;
+  model->transform = header->transform;
+  load->bounds = header->bounds;
+  load->images = (Image *)calloc(header->textureCount + 1, sizeof(Image));
+  load->textures =
+      (Texture2D *)calloc(header->textureCount + 1, sizeof(Texture2D));
+  load->meshBounds =
+      (BoundingBox *)malloc(sizeof(BoundingBox) * header->meshCount);
+  reader.ok = load->images != NULL && load->textures != NULL &&
+              load->meshBounds != NULL;
+
+  // Texture pixels stay in the mapping until they are uploaded
+  for (; reader.ok && load->textureCount < header->textureCount;
+       load->textureCount++) {
+    const ModelCacheTextureRecord *record =
+        ModelCacheRead(&reader, sizeof(ModelCacheTextureRecord));
+    const void *pixels =
+        record != NULL && record->dataSize > 0 &&
+                record->dataSize == GetPixelDataSize(record->width,
+                                                     record->height,
+                                                     record->format)
+            ? ModelCacheRead(&reader, record->dataSize)
+            : NULL;
+    if (pixels == NULL) {
+      reader.ok = false;
+      break;
+    }
+    load->images[load->textureCount] = (Image){
+        (void *)pixels, record->width, record->height, 1, record->format};
+  }
+
+  model->materialCount = header->materialCount;
+  load->materialRecords = (ModelCacheMaterialRecord *)malloc(
+      sizeof(ModelCacheMaterialRecord) * (model->materialCount + 1));
+  reader.ok = reader.ok && load->materialRecords != NULL;
+  for (int i = 0; reader.ok && i < model->materialCount; i++) {
+    const ModelCacheMaterialRecord *record =
+        ModelCacheRead(&reader, sizeof(ModelCacheMaterialRecord));
+    if (record == NULL) {
+      break;
+    }
+    for (int m = 0; m < MODEL_CACHE_MATERIAL_MAPS; m++) {
+      int32_t texture = record->maps[m].texture;
+      if (texture >= header->textureCount ||
+          texture < MODEL_CACHE_TEXTURE_DEFAULT) {
+        reader.ok = false;
+      }
+    }
+    load->materialRecords[i] = *record;
+  }
+
+  model->meshCount = header->meshCount;
+  model->meshMaterial =
+      (int *)CopyModelCacheBlock(&reader, model->meshCount, sizeof(int));
+  for (int i = 0; reader.ok && i < model->meshCount; i++) {
+    reader.ok = model->meshMaterial[i] >= 0 &&
+                model->meshMaterial[i] < model->materialCount;
+  }
+  model->boneCount = header->boneCount;
+  model->bones = (BoneInfo *)CopyModelCacheBlock(&reader, model->boneCount,
+                                                 sizeof(BoneInfo));
+  model->bindPose = (Transform *)CopyModelCacheBlock(
+      &reader, model->boneCount, sizeof(Transform));
+  const BoundingBox *bounds =
+      ModelCacheReadArray(&reader, model->meshCount, sizeof(BoundingBox));
+  if (bounds != NULL) {
+    memcpy(load->meshBounds, bounds, sizeof(BoundingBox) * model->meshCount);
+  }
+
+  model->meshes = (Mesh *)MemAlloc(sizeof(Mesh) * model->meshCount);
+  reader.ok = reader.ok && model->meshes != NULL;
+  for (int i = 0; reader.ok && i < model->meshCount; i++) {
+    ReadModelCacheMesh(&reader, &model->meshes[i]);
+  }
+
+  if (!reader.ok) {
+    UnloadModelCacheLoad(load);
+    return false;
+  }
+  return true;
+}
+
+// Create the next texture or upload the next mesh. GL thread only. Returns
+// true once nothing is left to upload.
+static bool UploadModelCacheStep(ModelCacheLoad *load) {
+  if (load->texturesCreated < load->textureCount) {
+    load->textures[load->texturesCreated] =
+        LoadTextureFromImage(load->images[load->texturesCreated]);
+    load->texturesCreated++;
+  } else if (load->meshesUploaded < load->model.meshCount) {
+    Mesh *mesh = &load->model.meshes[load->meshesUploaded];
+    if (mesh->vertices != NULL) {
+      UploadMesh(mesh, false);
+    }
+    load->meshesUploaded++;
+  }
+  return load->texturesCreated == load->textureCount &&
+         load->meshesUploaded == load->model.meshCount;
+}
+
+// Build the materials of a fully uploaded load and hand out the model, its
+// bounds and per-mesh bounds (the load is left empty). GL thread only.
+static void FinishModelCacheLoad(ModelCacheLoad *load, Model *outModel,
+                                 BoundingBox *outBounds,
+                                 BoundingBox **outMeshBounds) {
+  Model model = load->model;
+  model.materials =
+      (Material *)MemAlloc(sizeof(Material) * (model.materialCount + 1));
+  for (int i = 0; model.materials != NULL && i < model.materialCount; i++) {
+    const ModelCacheMaterialRecord *record = &load->materialRecords[i];
+    Material material = LoadMaterialDefault();
+    memcpy(material.params, record->params, sizeof(material.params));
+    for (int m = 0; m < MODEL_CACHE_MATERIAL_MAPS; m++) {
+      int32_t texture = record->maps[m].texture;
+      if (texture >= 0) {
+        material.maps[m].texture = load->textures[texture];
+      } else if (texture == MODEL_CACHE_TEXTURE_DEFAULT) {
+        material.maps[m].texture = (Texture2D){
+            rlGetTextureIdDefault(), 1, 1, 1,
+            PIXELFORMAT_UNCOMPRESSED_R8G8B8A8};
+      } else {
+        material.maps[m].texture = (Texture2D){0};
+      }
+      material.maps[m].color = record->maps[m].color;
+      material.maps[m].value = record->maps[m].value;
+    }
+    model.materials[i] = material;
+  }
+  if (model.materials == NULL) {
+    model.materialCount = 0;
+  }
+
+  *outModel = model;
+  *outBounds = load->bounds;
+  *outMeshBounds = load->meshBounds;
+  free(load->images);
+  free(load->textures);
+  free(load->materialRecords);
+  UnmapModelCacheFile(&load->map);
+  memset(load, 0, sizeof(*load));
+}
+
+// Build a model from a valid cache file for sourcePath in one go. Meshes are
+// uploaded and textures created, so call on the GL thread. Returns false
+// (with nothing left allocated) for a missing, stale or damaged file.
+static bool LoadModelCacheFile(const char *cachePath, const char *sourcePath,
+                               Model *outModel, BoundingBox *outBounds,
+                               BoundingBox **outMeshBounds) {
+  ModelCacheLoad load;
+  if (!ReadModelCacheFile(cachePath, sourcePath, &load)) {
+    return false;
+  }
+  while (!UploadModelCacheStep(&load)) {
+  }
+  FinishModelCacheLoad(&load, outModel, outBounds, outMeshBounds);
+  return true;
+}
+
+// Animations stored in a valid cache file for sourcePath, laid out like
+// LoadModelAnimations output (UnloadModelAnimations frees them). NULL when
+// the file is missing, stale, damaged or holds no animations.
+static ModelAnimation *LoadModelCacheAnimations(const char *cachePath,
+                                                const char *sourcePath,
+                                                int *outCount) {
+  *outCount = 0;
+  ModelCacheMapping map;
+  if (!MapModelCacheFile(cachePath, &map)) {
+    return NULL;
+  }
+  ModelCacheReader reader = {map.data, map.size, 0, true};
+  const ModelCacheFileHeader *header =
+      ModelCacheRead(&reader, sizeof(ModelCacheFileHeader));
+  if (header == NULL || !ModelCacheHeaderMatches(header, sourcePath) ||
+      header->animationCount <= 0) {
+    UnmapModelCacheFile(&map);
+    return NULL;
+  }
+
+  // Skip to the animations: every block before them has a known size
+  for (int t = 0; reader.ok && t < header->textureCount; t++) {
+    const ModelCacheTextureRecord *record =
+        ModelCacheRead(&reader, sizeof(ModelCacheTextureRecord));
+    if (record != NULL) {
+      ModelCacheReadArray(&reader, record->dataSize, 1);
+    }
+  }
+  for (int i = 0; reader.ok && i < header->materialCount; i++) {
+    ModelCacheRead(&reader, sizeof(ModelCacheMaterialRecord));
+  }
+  ModelCacheReadArray(&reader, header->meshCount, sizeof(int));
+  ModelCacheReadArray(&reader, header->boneCount, sizeof(BoneInfo));
+  ModelCacheReadArray(&reader, header->boneCount, sizeof(Transform));
+  ModelCacheReadArray(&reader, header->meshCount, sizeof(BoundingBox));
+  static const size_t sizes[MODEL_CACHE_ATTRIBUTE_COUNT - 1] = {
+      12, 8, 8, 12, 16, 4, 12, 12, 4, 16};
+  for (int i = 0; reader.ok && i < header->meshCount; i++) {
+    const ModelCacheMeshRecord *record =
+        ModelCacheRead(&reader, sizeof(ModelCacheMeshRecord));
+    for (int a = 0; record != NULL && a < MODEL_CACHE_ATTRIBUTE_COUNT - 1;
+         a++) {
+      if (record->attributes & (1 << a)) {
+        ModelCacheReadArray(&reader, record->vertexCount, sizes[a]);
+      }
+    }
+    if (record != NULL && (record->attributes & MODEL_CACHE_INDICES)) {
+      ModelCacheReadArray(&reader, record->triangleCount * 3,
+                          sizeof(unsigned short));
+    }
+  }
+
+  int count = header->animationCount;
+  ModelAnimation *animations =
+      reader.ok ? (ModelAnimation *)MemAlloc(sizeof(ModelAnimation) * count)
+                : NULL;
+  int loaded = 0;
+  for (; animations != NULL && loaded < count; loaded++) {
+    const ModelCacheAnimationRecord *record =
+        ModelCacheRead(&reader, sizeof(ModelCacheAnimationRecord));
+    if (record == NULL || record->boneCount <= 0 || record->frameCount < 0) {
+      break;
+    }
+    ModelAnimation *anim = &animations[loaded];
+    memcpy(anim->name, record->name, sizeof(anim->name));
+    anim->name[sizeof(anim->name) - 1] = '\0';
+    anim->boneCount = record->boneCount;
+    anim->bones = (BoneInfo *)CopyModelCacheBlock(&reader, anim->boneCount,
+                                                  sizeof(BoneInfo));
+    const Transform *poses = (const Transform *)ModelCacheReadArray(
+        &reader, anim->boneCount,
+        sizeof(Transform) * (size_t)record->frameCount);
+    anim->framePoses = (Transform **)MemAlloc(
+        sizeof(Transform *) * (unsigned int)(record->frameCount + 1));
+    if (!reader.ok || anim->bones == NULL || anim->framePoses == NULL) {
+      anim->frameCount = 0;
+      loaded++; // Partly built, released below
+      reader.ok = false;
+      break;
+    }
+    for (int f = 0; f < record->frameCount; f++) {
+      anim->framePoses[f] = (Transform *)MemAlloc(
+          sizeof(Transform) * (unsigned int)anim->boneCount);
+      if (anim->framePoses[f] == NULL) {
+        reader.ok = false;
+        break;
+      }
+      memcpy(anim->framePoses[f], poses + (size_t)f * anim->boneCount,
+             sizeof(Transform) * anim->boneCount);
+      anim->frameCount = f + 1;
+    }
+    if (!reader.ok) {
+      loaded++;
+      break;
+    }
+  }
+  UnmapModelCacheFile(&map);
+
+  if (animations == NULL || !reader.ok || loaded < count) {
+    if (animations != NULL) {
+      UnloadModelAnimations(animations, loaded);
+    }
+    return NULL;
+  }
+  *outCount = count;
+  return animations;
+}
+
+#endif // MODEL_BINARY_CACHE_H
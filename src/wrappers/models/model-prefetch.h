@@ -0,0 +1,225 @@
+#ifndef MODEL_PREFETCH_H
+#define MODEL_PREFETCH_H
+
+// Reads a model's files into memory ahead of parsing. Prefetching runs on a
+// worker thread and only touches the disk; raylib's loader runs later on the
+// GL thread and is fed from memory through its LoadFileData callback, so the
+// frame loop never waits on I/O. For .gltf files, external buffers and images
+// named by "uri" entries are read too. Anything not prefetched (or requested
+// under a path that does not resolve to a prefetched file) is read from disk
+// as usual.
+
+#include "raylib.h"
+#include <stdbool.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define MODEL_PREFETCH_MAX_FILES 32
+#define MODEL_PREFETCH_PATH_SIZE 512
+
+typedef struct {
+  char path[MODEL_PREFETCH_PATH_SIZE]; // Canonical path
+  unsigned char *data; // malloc'ed, handed to raylib (which frees it) on use
+  int size;
+} PrefetchedFile;
+
+typedef struct {
+  PrefetchedFile files[MODEL_PREFETCH_MAX_FILES]; // files[0] is the model
+  int fileCount;
+} ModelPrefetch;
+
+// Absolute path with links and "." / ".." resolved, so different spellings
+// of one file compare equal. Falls back to fileName when it cannot be
+// resolved or does not fit.
+static void GetCanonicalModelPath(const char *fileName, char *out,
+                                  size_t size) {
+  char resolved[4096];
+#ifdef _WIN32
+  bool ok = _fullpath(resolved, fileName, sizeof(resolved)) != NULL;
+#else
+  bool ok = realpath(fileName, resolved) != NULL;
+#endif
+  const char *path = ok && strlen(resolved) < size ? resolved : fileName;
+  strncpy(out, path, size - 1);
+  out[size - 1] = '\0';
+}
+
+// FNV-1a over a buffer, never 0 so 0 can mean "no hash"
+static uint64_t HashModelBytes(const unsigned char *data, int size) {
+  uint64_t hash = 14695981039346656037ULL;
+  for (int i = 0; i < size; i++) {
+    hash = (hash ^ data[i]) * 1099511628211ULL;
+  }
+  return hash != 0 ? hash : 1;
+}
+
+// Whole file into a malloc'ed buffer (raylib releases callback data with
+// free). Plain stdio: safe off the main thread and independent of any
+// LoadFileData callback installed at the time.
+static unsigned char *PrefetchReadFile(const char *fileName, int *size) {
+  *size = 0;
+  FILE *file = fopen(fileName, "rb");
+  if (file == NULL) {
+    return NULL;
+  }
+  unsigned char *data = NULL;
+  long length = -1;
+  if (fseek(file, 0, SEEK_END) == 0) {
+    length = ftell(file);
+  }
+  if (length > 0 && length <= 0x7FFFFFFF && fseek(file, 0, SEEK_SET) == 0) {
+    data = (unsigned char *)malloc((size_t)length);
+    if (data != NULL &&
+        fread(data, 1, (size_t)length, file) != (size_t)length) {
+      free(data);
+      data = NULL;
+    }
+  }
+  fclose(file);
+  if (data != NULL) {
+    *size = (int)length;
+  }
+  return data;
+}
+
+static void PrefetchAddFile(ModelPrefetch *prefetch, const char *fileName) {
+  if (prefetch->fileCount >= MODEL_PREFETCH_MAX_FILES) {
+    return;
+  }
+  PrefetchedFile *file = &prefetch->files[prefetch->fileCount];
+  file->data = PrefetchReadFile(fileName, &file->size);
+  if (file->data != NULL || prefetch->fileCount == 0) {
+    GetCanonicalModelPath(fileName, file->path, sizeof(file->path));
+    prefetch->fileCount++;
+  }
+}
+
+// Queue every external "uri" of a .gltf document, relative to its folder
+static void PrefetchGLTFResources(ModelPrefetch *prefetch, const char *fileName,
+                                  const unsigned char *json, int size) {
+  const char *slash = strrchr(fileName, '/');
+  const char *backslash = strrchr(fileName, '\\');
+  if (backslash > slash) {
+    slash = backslash;
+  }
+  int dirLength = slash != NULL ? (int)(slash - fileName) + 1 : 0;
+
+  for (int i = 0; i + 5 < size; i++) {
+    if (memcmp(json + i, "\"uri\"", 5) != 0) {
+      continue;
+    }
+    int p = i + 5;
+    while (p < size && (json[p] == ' ' || json[p] == '\t' || json[p] == '\r' ||
+                        json[p] == '\n' || json[p] == ':')) {
+      p++;
+    }
+    if (p >= size || json[p] != '"') {
+      continue;
+    }
+    p++;
+
+    // Folder of the model, then the URI unescaped (JSON and percent escapes)
+    char path[MODEL_PREFETCH_PATH_SIZE];
+    int length = dirLength < (int)sizeof(path) ? dirLength : 0;
+    memcpy(path, fileName, length);
+    int uriStart = length;
+    for (; p < size && json[p] != '"' && length < (int)sizeof(path) - 1; p++) {
+      char c = (char)json[p];
+      if (c == '\\' && p + 1 < size) {
+        c = (char)json[++p];
+      } else if (c == '%' && p + 2 < size) {
+        char hex[3] = {(char)json[p + 1], (char)json[p + 2], '\0'};
+        char *end = NULL;
+        long value = strtol(hex, &end, 16);
+        if (end == hex + 2) {
+          c = (char)value;
+          p += 2;
+        }
+      }
+      path[length++] = c;
+    }
+    path[length] = '\0';
+    i = p;
+
+    if (strncmp(path + uriStart, "data:", 5) != 0) {
+      PrefetchAddFile(prefetch, path);
+    }
+  }
+}
+
+// Case-insensitive ".gltf" suffix check. raylib's IsFileExtension lowercases
+// into a shared static buffer, which is not safe off the main thread.
+static bool IsGLTFFileName(const char *fileName) {
+  size_t length = strlen(fileName);
+  if (length < 5) {
+    return false;
+  }
+  const char *ext = fileName + length - 5;
+  const char *expected = ".gltf";
+  for (int i = 0; i < 5; i++) {
+    char c = ext[i];
+    if (c >= 'A' && c <= 'Z') {
+      c = (char)(c - 'A' + 'a');
+    }
+    if (c != expected[i]) {
+      return false;
+    }
+  }
+  return true;
+}
+
+// Read the model file and, for .gltf, the files it references
+static void PrefetchModelFiles(ModelPrefetch *prefetch, const char *fileName) {
+  memset(prefetch, 0, sizeof(*prefetch));
+  PrefetchAddFile(prefetch, fileName);
+  const PrefetchedFile *model = &prefetch->files[0];
+  if (model->data != NULL && IsGLTFFileName(fileName)) {
+    PrefetchGLTFResources(prefetch, fileName, model->data, model->size);
+  }
+}
+
+static void UnloadModelPrefetch(ModelPrefetch *prefetch) {
+  for (int i = 0; i < prefetch->fileCount; i++) {
+    free(prefetch->files[i].data);
+    prefetch->files[i].data = NULL;
+  }
+  prefetch->fileCount = 0;
+}
+
+static ModelPrefetch *activeModelPrefetch = NULL; // Served during LoadModel
+
+// LoadFileData callback: hands over prefetched data (each file once),
+// reads anything else from disk
+static unsigned char *LoadPrefetchedFileData(const char *fileName,
+                                             int *dataSize) {
+  if (activeModelPrefetch != NULL) {
+    char path[MODEL_PREFETCH_PATH_SIZE];
+    GetCanonicalModelPath(fileName, path, sizeof(path));
+    for (int i = 0; i < activeModelPrefetch->fileCount; i++) {
+      PrefetchedFile *file = &activeModelPrefetch->files[i];
+      if (file->data != NULL && strcmp(file->path, path) == 0) {
+        unsigned char *data = file->data;
+        *dataSize = file->size;
+        file->data = NULL;
+        return data;
+      }
+    }
+  }
+  return PrefetchReadFile(fileName, dataSize);
+}
+
+// raylib's LoadModel with its file reads served from the prefetch. Must run
+// on the GL thread: raylib parses and uploads meshes and textures in one go.
+static Model LoadModelFromPrefetch(const char *fileName,
+                                   ModelPrefetch *prefetch) {
+  activeModelPrefetch = prefetch;
+  SetLoadFileDataCallback(LoadPrefetchedFileData);
+  Model model = LoadModel(fileName);
+  SetLoadFileDataCallback(NULL);
+  activeModelPrefetch = NULL;
+  return model;
+}
+
+#endif // MODEL_PREFETCH_H
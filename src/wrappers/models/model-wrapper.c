@@ -1,5 +1,18 @@
 #include "raylib.h"
 #include "raymath.h"
+#include "animation-compression.h"
+#include "mesh-bvh.h"
+#include "mesh-optimize.h"
+#include "mesh-shape-queries.h"
+#include "mesh-simplify.h"
+#include "mesh-skinning.h"
+#include "model-binary-cache.h"
+#include "model-prefetch.h"
+#include "../common/deferred-unload.h"
+#include "../common/frustum.h"
+#include "../common/handle-table.h"
+#include "../common/job-pool.h"
+#include <stdint.h>
 #include <stdlib.h>
 
 // Export macro for Windows DLL
@@ -16,50 +29,581 @@
 #else
 #define EXPORT
 #endif
-#define MAX_MODELS 64
+
+#define MODEL_MAX_LODS 4
 
 // Model storage with metadata
 typedef struct {
   Model model;
-  bool isLoaded;
-  char fileName[256];
+  char fileName[256];    // Canonical path when it fits, else as passed
+  int refCount;          // Loads sharing this slot (see model cache below)
+  uint64_t contentHash;  // File hash, set when loaded in content cache mode
   BoundingBox boundingBox;
+  BoundingBox *meshBounds; // Per-mesh bounding boxes, computed at load
+  BoneBounds *boneBounds; // Skinned meshes: bind pose box per bone (lazy)
+  BoundingBox *posedMeshBounds; // Per-mesh bounds of boundsPose
+  Matrix *boundsPose;           // Bone matrices posedMeshBounds is for
+  int boundsPoseBoneCount;
+  MeshBVH *meshBVHs; // Per-mesh ray query BVH, built lazily (NULL until used)
+  Matrix *skinnedPose;  // Bone matrices last skinned on the CPU (NULL if none)
+  int skinnedBoneCount; // Entries in skinnedPose
+  uint64_t bindPoseHash; // Pose cache key part, 0 until first needed
+  Mesh *lodMeshes[MODEL_MAX_LODS]; // Simplified meshes per level, meshCount each
+  int lodCount;                    // Levels in lodMeshes (0: full detail only)
+  MeshOptimizeStats optimizeStats; // Last mesh optimization pass
+  int firstInstance; // Scene instances placed from this slot, -1 if none
 } ModelSlot;
 
-static ModelSlot modelSlots[MAX_MODELS] = {0};
+// Slot handles are generational: stale handles of unloaded models fail
+static HandleTable modelSlots = HANDLE_TABLE_INIT(ModelSlot);
 
-// Find free slot for new model
-int FindFreeModelSlot() {
-  for (int i = 0; i < MAX_MODELS; i++) {
-    if (!modelSlots[i].isLoaded) {
-      return i;
+static void ReleaseMesh(void *resource) { UnloadMesh(*(Mesh *)resource); }
+
+// Meshes dropped by live models (replaced by optimization, old detail
+// levels) wait here; drained along with the model unloads below
+static DeferredUnloadQueue meshUnloads =
+    DEFERRED_UNLOAD_QUEUE_INIT(Mesh, ReleaseMesh);
+
+// Placed model: slot plus world transform, inverse cached for ray queries
+typedef struct {
+  int modelSlot;
+  int prevInSlot, nextInSlot; // Other instances of the slot, -1 ends the list
+  Matrix transform;
+  Matrix invTransform;     // Updated together with transform
+  BoundingBox worldBounds; // Mesh-space bounds moved into world space
+} ModelInstance;
+
+// Instance ids are handles too: an id kept after removal stays invalid even
+// once its index is reused by a new instance
+static HandleTable modelInstances = HANDLE_TABLE_INIT(ModelInstance);
+
+// Top-level BVH over instance world bounds, rebuilt lazily after changes
+static BoxBVH sceneBVH = {0};
+static int *sceneInstanceIndices = NULL; // BVH primitive -> instance index
+static int sceneInstanceCapacity = 0;
+static bool sceneBVHDirty = true;
+
+// Live slot for a handle, NULL when invalid or unloaded
+static ModelSlot *GetModelSlot(int slotIndex) {
+  return HandleTableGet(&modelSlots, slotIndex);
+}
+
+// Get BVH for mesh, building it on first use
+static MeshBVH *GetModelMeshBVH(ModelSlot *slot, int meshIndex) {
+  if (slot->meshBVHs == NULL) {
+    slot->meshBVHs =
+        (MeshBVH *)calloc(slot->model.meshCount, sizeof(MeshBVH));
+    if (slot->meshBVHs == NULL) {
+      return NULL;
     }
   }
-  return -1; // No free slots
+
+  MeshBVH *bvh = &slot->meshBVHs[meshIndex];
+  if (bvh->nodeCount == 0 &&
+      !BuildMeshBVH(bvh, slot->model.meshes[meshIndex])) {
+    return NULL; // No CPU vertex data to test against
+  }
+  return bvh;
 }
 
-// Load model and return slot index
-EXPORT int LoadModelToSlot(const char *fileName, int *outBuffer) {
-  int slotIndex = FindFreeModelSlot();
+// Union of per-mesh bounds: the space ray queries run in (model.transform is
+// not applied, same as GetRayCollisionModelMesh)
+static BoundingBox GetModelLocalBounds(ModelSlot *slot) {
+  if (slot->meshBounds == NULL) {
+    return slot->boundingBox;
+  }
+  BoundingBox box = BVHEmptyBox();
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    BVHMergeBox(&box, slot->meshBounds[i]);
+  }
+  return box;
+}
+
+// Free all cached mesh BVHs of a slot
+static void UnloadModelBVHs(ModelSlot *slot) {
+  if (slot->meshBVHs == NULL) {
+    return;
+  }
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    UnloadMeshBVH(&slot->meshBVHs[i]);
+  }
+  free(slot->meshBVHs);
+  slot->meshBVHs = NULL;
+}
+
+// Free the animated bounds of a slot (rebuilt on the next query)
+static void UnloadModelPoseBounds(ModelSlot *slot) {
+  free(slot->boneBounds);
+  free(slot->posedMeshBounds);
+  free(slot->boundsPose);
+  slot->boneBounds = NULL;
+  slot->posedMeshBounds = NULL;
+  slot->boundsPose = NULL;
+  slot->boundsPoseBoneCount = 0;
+}
+
+static ModelInstance *GetModelInstance(int instanceId) {
+  return HandleTableGet(&modelInstances, instanceId);
+}
+
+// Unlink an instance from its slot's list and free its id
+static void FreeModelInstance(int instanceId) {
+  ModelInstance *instance = GetModelInstance(instanceId);
+  if (!instance) {
+    return;
+  }
+
+  if (instance->prevInSlot >= 0) {
+    GetModelInstance(instance->prevInSlot)->nextInSlot = instance->nextInSlot;
+  } else {
+    GetModelSlot(instance->modelSlot)->firstInstance = instance->nextInSlot;
+  }
+  if (instance->nextInSlot >= 0) {
+    GetModelInstance(instance->nextInSlot)->prevInSlot = instance->prevInSlot;
+  }
+  HandleTableFree(&modelInstances, instanceId);
+  sceneBVHDirty = true;
+}
+
+// Drop instances placed from a slot that is being unloaded
+static void RemoveModelInstancesOfSlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  while (slot->firstInstance >= 0) {
+    FreeModelInstance(slot->firstInstance);
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Model cache: loading a file that is already loaded returns the same slot
+// with its reference count raised instead of parsing and uploading again.
+// Matching is by canonical path (default) or by file content hash. Skinned
+// models are never shared since every copy animates its own vertex buffers.
+// ----------------------------------------------------------------------------
+
+#define MODEL_CACHE_OFF 0
+#define MODEL_CACHE_PATH 1
+#define MODEL_CACHE_CONTENT 2
+
+static int modelCacheMode = MODEL_CACHE_PATH;
+
+// FNV-1a over the file bytes, 0 if it cannot be read. Covers only the file
+// itself (not e.g. a .gltf's external buffers).
+static uint64_t HashModelFile(const char *fileName) {
+  int size = 0;
+  unsigned char *data = LoadFileData(fileName, &size);
+  if (data == NULL) {
+    return 0;
+  }
+  uint64_t hash = HashModelBytes(data, size);
+  UnloadFileData(data);
+  return hash;
+}
+
+// Loaded slot holding the same file, -1 if none can be shared
+static int FindCachedModelSlot(const char *path, uint64_t contentHash) {
+  for (int i = 0; i < HandleTableCapacity(&modelSlots); i++) {
+    const ModelSlot *slot = HandleTableAt(&modelSlots, i);
+    if (slot == NULL || slot->model.boneCount > 0) {
+      continue;
+    }
+    bool match = modelCacheMode == MODEL_CACHE_CONTENT
+                     ? contentHash != 0 && slot->contentHash == contentHash
+                     : strcmp(slot->fileName, path) == 0;
+    if (match) {
+      return HandleTableHandleAt(&modelSlots, i);
+    }
+  }
+  return -1;
+}
+
+// 0: always load, 1: share by canonical path (default), 2: share by content
+EXPORT void SetModelCacheMode(int mode) {
+  if (mode >= MODEL_CACHE_OFF && mode <= MODEL_CACHE_CONTENT) {
+    modelCacheMode = mode;
+  }
+}
+
+// Number of loads sharing a slot, 0 if it is not loaded
+EXPORT int GetModelRefCountBySlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return 0;
+  }
+  return slot->refCount;
+}
+
+// ----------------------------------------------------------------------------
+// Binary model cache: after a model is parsed, a flat copy of it (meshes,
+// materials with texture pixels, skeleton, bounds and animations) is written
+// next to the source as "<path>.rlmc". Later loads map that file and upload
+// from it instead of parsing; a changed source invalidates it (see
+// model-binary-cache.h for the key). Off by default: it writes files beside
+// the models.
+// ----------------------------------------------------------------------------
+
+static bool modelBinaryCacheEnabled = false;
+static int modelBinaryCacheHits = 0;
+static int modelBinaryCacheMisses = 0;
+static int modelBinaryCacheWrites = 0;
+
+// Model and bounds from the cache file of a canonical path, false on a miss
+static bool LoadModelFromBinaryCache(const char *path, Model *outModel,
+                                     BoundingBox *outBounds,
+                                     BoundingBox **outMeshBounds) {
+  char cachePath[300];
+  if (!modelBinaryCacheEnabled ||
+      !GetModelCacheFilePath(path, cachePath, sizeof(cachePath))) {
+    return false;
+  }
+  if (LoadModelCacheFile(cachePath, path, outModel, outBounds,
+                         outMeshBounds)) {
+    modelBinaryCacheHits++;
+    return true;
+  }
+  modelBinaryCacheMisses++;
+  return false;
+}
+
+// Write the cache file for a freshly parsed model. Skinned models carry
+// their animations so LoadModelAnimationsToSlot can skip parsing as well.
+static void WriteModelBinaryCache(const char *path, uint64_t contentHash,
+                                  const Model *model, BoundingBox bbox,
+                                  const BoundingBox *meshBounds) {
+  char cachePath[300];
+  if (!modelBinaryCacheEnabled ||
+      !GetModelCacheFilePath(path, cachePath, sizeof(cachePath))) {
+    return;
+  }
+  uint64_t sourceHash = contentHash != 0 ? contentHash : HashModelSource(path);
+  int animCount = 0;
+  ModelAnimation *animations = NULL;
+  if (model->boneCount > 0) {
+    animations = LoadModelAnimations(path, &animCount);
+  }
+  if (WriteModelCacheFile(cachePath, path, sourceHash, model, bbox,
+                          meshBounds, animations, animations ? animCount : 0)) {
+    modelBinaryCacheWrites++;
+  }
+  if (animations != NULL) {
+    UnloadModelAnimations(animations, animCount);
+  }
+}
+
+// Use (and write) cache files for models loaded from now on
+EXPORT void SetModelBinaryCache(bool enabled) {
+  modelBinaryCacheEnabled = enabled;
+}
+
+// Since the last reset: [loads served from cache files, loads that had to
+// parse, cache files written]
+EXPORT void GetModelBinaryCacheStats(int *outBuffer, bool reset) {
+  outBuffer[0] = modelBinaryCacheHits;
+  outBuffer[1] = modelBinaryCacheMisses;
+  outBuffer[2] = modelBinaryCacheWrites;
+  if (reset) {
+    modelBinaryCacheHits = 0;
+    modelBinaryCacheMisses = 0;
+    modelBinaryCacheWrites = 0;
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Level of detail: simplified copies of a static model's meshes, each level
+// aiming for half the triangles of the one before. Draws pick a level from
+// the model's projected size on screen (see SelectModelLod).
+// ----------------------------------------------------------------------------
+
+static int modelLodGenerationCount = 0; // Levels built on load, 0 = off
+static bool modelMeshOptimization = false; // See mesh optimization below
+
+// Allowed surface error per level, relative to the mesh extent
+static const float modelLodErrors[MODEL_MAX_LODS] = {0.01f, 0.02f, 0.04f,
+                                                     0.08f};
+
+// Meshes a level could not simplify share the full-detail mesh
+static bool IsLodMeshShared(const ModelSlot *slot, int level, int meshIndex) {
+  return slot->lodMeshes[level][meshIndex].vertices ==
+         slot->model.meshes[meshIndex].vertices;
+}
+
+static void UnloadModelLods(ModelSlot *slot) {
+  for (int level = 0; level < slot->lodCount; level++) {
+    for (int m = 0; m < slot->model.meshCount; m++) {
+      if (!IsLodMeshShared(slot, level, m)) {
+        DeferredUnloadPush(&meshUnloads, &slot->lodMeshes[level][m]);
+      }
+    }
+    free(slot->lodMeshes[level]);
+    slot->lodMeshes[level] = NULL;
+  }
+  slot->lodCount = 0;
+}
+
+// Simplify one mesh level by level into lods[level][meshIndex]. Levels that
+// fail or remove nothing share the full mesh.
+static void BuildMeshLods(ModelSlot *slot, int meshIndex, int lodCount,
+                          unsigned int *current, unsigned int *simplified) {
+  Mesh *mesh = &slot->model.meshes[meshIndex];
+  int fullCount = mesh->indices != NULL ? mesh->triangleCount * 3
+                                        : mesh->vertexCount;
+  for (int i = 0; i < fullCount; i++) {
+    current[i] = mesh->indices != NULL ? mesh->indices[i] : (unsigned int)i;
+  }
+
+  int count = fullCount;
+  for (int level = 0; level < lodCount; level++) {
+    Mesh *lod = &slot->lodMeshes[level][meshIndex];
+    *lod = *mesh;
+    int target = (fullCount >> (level + 1)) / 3 * 3;
+    int reduced = SimplifyMeshIndices(mesh, current, count, target,
+                                      modelLodErrors[level], simplified);
+    Mesh built;
+    if (reduced > 0 && modelMeshOptimization) {
+      OptimizeVertexCache(simplified, reduced, mesh->vertexCount);
+    }
+    if (reduced > 0 && reduced < fullCount &&
+        BuildSimplifiedMesh(mesh, simplified, reduced, &built)) {
+      UploadMesh(&built, false);
+      *lod = built;
+      memcpy(current, simplified, sizeof(unsigned int) * reduced);
+      count = reduced;
+    }
+  }
+}
+
+// Build lodCount simplified levels for a static model, replacing any it had.
+// Returns the number of levels built (0 for skinned models or no CPU data).
+static int GenerateModelLods(ModelSlot *slot, int lodCount) {
+  UnloadModelLods(slot);
+  Model *model = &slot->model;
+  if (lodCount <= 0 || model->boneCount > 0) {
+    return 0;
+  }
+  if (lodCount > MODEL_MAX_LODS) {
+    lodCount = MODEL_MAX_LODS;
+  }
+
+  int maxIndices = 0;
+  for (int m = 0; m < model->meshCount; m++) {
+    const Mesh *mesh = &model->meshes[m];
+    if (mesh->vertices == NULL || mesh->animVertices != NULL) {
+      return 0;
+    }
+    int count = mesh->indices != NULL ? mesh->triangleCount * 3
+                                      : mesh->vertexCount;
+    if (count > maxIndices) {
+      maxIndices = count;
+    }
+  }
+
+  unsigned int *current = (unsigned int *)malloc(sizeof(int) * maxIndices);
+  unsigned int *simplified = (unsigned int *)malloc(sizeof(int) * maxIndices);
+  bool ok = current != NULL && simplified != NULL;
+  for (int level = 0; ok && level < lodCount; level++) {
+    slot->lodMeshes[level] =
+        (Mesh *)calloc(model->meshCount, sizeof(Mesh));
+    ok = slot->lodMeshes[level] != NULL;
+    if (ok) {
+      for (int m = 0; m < model->meshCount; m++) {
+        slot->lodMeshes[level][m] = model->meshes[m];
+      }
+      slot->lodCount = level + 1;
+    }
+  }
+  if (ok) {
+    for (int m = 0; m < model->meshCount; m++) {
+      BuildMeshLods(slot, m, lodCount, current, simplified);
+    }
+  } else {
+    UnloadModelLods(slot);
+  }
+  free(current);
+  free(simplified);
+  return slot->lodCount;
+}
+
+// Levels built for models loaded from now on (0-4, 0 turns it off)
+EXPORT void SetModelLodGeneration(int lodCount) {
+  modelLodGenerationCount = lodCount < 0                ? 0
+                            : lodCount > MODEL_MAX_LODS ? MODEL_MAX_LODS
+                                                        : lodCount;
+}
+
+// Build (or rebuild) the levels of a loaded model. Returns the number built.
+EXPORT int GenerateModelLodsBySlot(int slotIndex, int lodCount) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return 0;
+  }
+  return GenerateModelLods(slot, lodCount);
+}
+
+// [lodCount, triangles at full detail, triangles per level (MODEL_MAX_LODS
+// entries, 0 past lodCount)]
+EXPORT void GetModelLodInfoBySlot(int slotIndex, int *outBuffer) {
+  memset(outBuffer, 0, sizeof(int) * (MODEL_MAX_LODS + 2));
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+  outBuffer[0] = slot->lodCount;
+  for (int m = 0; m < slot->model.meshCount; m++) {
+    outBuffer[1] += slot->model.meshes[m].triangleCount;
+    for (int level = 0; level < slot->lodCount; level++) {
+      outBuffer[2 + level] += slot->lodMeshes[level][m].triangleCount;
+    }
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Mesh optimization: weld duplicate vertices, reorder triangles for the
+// vertex cache and vertices for fetch locality (see mesh-optimize.h). raylib
+// uploads while loading, so optimized meshes are uploaded again and the
+// originals released; with the option on this happens before the model
+// reaches its slot.
+// ----------------------------------------------------------------------------
+
+// Optimize every mesh of a slot, dropping and rebuilding data derived from
+// the meshes. Returns the number of meshes optimized.
+static int OptimizeModelMeshes(ModelSlot *slot) {
+  int lodCount = slot->lodCount;
+  UnloadModelLods(slot); // Levels may share the meshes being replaced
+  UnloadModelBVHs(slot);
+  UnloadModelPoseBounds(slot);
+
+  slot->optimizeStats = (MeshOptimizeStats){0};
+  for (int m = 0; m < slot->model.meshCount; m++) {
+    Mesh optimized;
+    if (OptimizeMesh(&slot->model.meshes[m], &optimized,
+                     &slot->optimizeStats)) {
+      UploadMesh(&optimized, false);
+      DeferredUnloadPush(&meshUnloads, &slot->model.meshes[m]);
+      slot->model.meshes[m] = optimized;
+    }
+  }
+
+  if (lodCount > 0) {
+    GenerateModelLods(slot, lodCount);
+  }
+  return slot->optimizeStats.meshesOptimized;
+}
+
+// Optimize the meshes of models loaded from now on (off by default)
+EXPORT void SetModelMeshOptimization(bool enabled) {
+  modelMeshOptimization = enabled;
+}
+
+// Optimize a loaded model. Returns the number of meshes optimized.
+EXPORT int OptimizeModelBySlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return 0;
+  }
+  return OptimizeModelMeshes(slot);
+}
+
+// Last optimization pass: [meshes optimized, vertices before, vertices after,
+// triangles, ACMR before, ACMR after]
+EXPORT void GetModelOptimizeStatsBySlot(int slotIndex, float *outBuffer) {
+  memset(outBuffer, 0, sizeof(float) * 6);
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+  const MeshOptimizeStats *stats = &slot->optimizeStats;
+  outBuffer[0] = (float)stats->meshesOptimized;
+  outBuffer[1] = (float)stats->verticesBefore;
+  outBuffer[2] = (float)stats->verticesAfter;
+  outBuffer[3] = (float)stats->triangles;
+  if (stats->triangles > 0) {
+    outBuffer[4] = (float)stats->cacheMissesBefore / stats->triangles;
+    outBuffer[5] = (float)stats->cacheMissesAfter / stats->triangles;
+  }
+}
+
+// Bounding box of a loaded model plus per-mesh bounds for ray query
+// early-outs (NULL if out of memory). CPU only, safe on a worker thread.
+static BoundingBox *ComputeModelBounds(const Model *model,
+                                       BoundingBox *outBounds) {
+  *outBounds = GetModelBoundingBox(*model);
+  BoundingBox *meshBounds =
+      (BoundingBox *)malloc(sizeof(BoundingBox) * model->meshCount);
+  if (meshBounds != NULL) {
+    for (int i = 0; i < model->meshCount; i++) {
+      meshBounds[i] = GetMeshBoundingBox(model->meshes[i]);
+    }
+  }
+  return meshBounds;
+}
+
+// Put a loaded model in a new slot with one reference. Unloads the model
+// and returns -1 if the slot table cannot grow.
+static int StoreModelInSlot(Model model, const char *path,
+                            uint64_t contentHash, BoundingBox bbox,
+                            BoundingBox *meshBounds) {
+  int slotIndex = HandleTableAlloc(&modelSlots);
   if (slotIndex == -1) {
-    return -1; // No free slots
+    free(meshBounds);
+    UnloadModel(model);
+    return -1;
   }
 
-  Model model = LoadModel(fileName);
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  slot->model = model;
+  slot->meshBounds = meshBounds;
+  slot->boundingBox = bbox;
+  strncpy(slot->fileName, path, sizeof(slot->fileName) - 1);
+  slot->refCount = 1;
+  slot->contentHash = contentHash;
+  slot->firstInstance = -1;
+  if (modelMeshOptimization) {
+    OptimizeModelMeshes(slot);
+  }
+  if (modelLodGenerationCount > 0) {
+    GenerateModelLods(slot, modelLodGenerationCount);
+  }
+  return slotIndex;
+}
 
-  // Check if model loaded successfully
-  // A valid model should have at least one mesh
-  if (model.meshCount == 0) {
-    return -1; // Failed to load
+// Load model and return slot index. A file already loaded returns its slot
+// (unless caching is off); each such load needs its own UnloadModelBySlot.
+EXPORT int LoadModelToSlot(const char *fileName, int *outBuffer) {
+  char path[256];
+  GetCanonicalModelPath(fileName, path, sizeof(path));
+  uint64_t contentHash =
+      modelCacheMode == MODEL_CACHE_CONTENT ? HashModelFile(fileName) : 0;
+
+  if (modelCacheMode != MODEL_CACHE_OFF) {
+    int cached = FindCachedModelSlot(path, contentHash);
+    if (cached >= 0) {
+      ModelSlot *slot = GetModelSlot(cached);
+      slot->refCount++;
+      outBuffer[0] = cached;
+      outBuffer[1] = slot->model.meshCount;
+      outBuffer[2] = slot->model.materialCount;
+      return cached;
+    }
+  }
+
+  Model model;
+  BoundingBox bbox;
+  BoundingBox *meshBounds = NULL;
+  if (!LoadModelFromBinaryCache(path, &model, &bbox, &meshBounds)) {
+    model = LoadModel(fileName);
+
+    // Check if model loaded successfully
+    // A valid model should have at least one mesh
+    if (model.meshCount == 0) {
+      return -1; // Failed to load
+    }
+    meshBounds = ComputeModelBounds(&model, &bbox);
+    WriteModelBinaryCache(path, contentHash, &model, bbox, meshBounds);
   }
-  // Calculate and cache bounding box
-  BoundingBox bbox = GetModelBoundingBox(model);
 
-  modelSlots[slotIndex].model = model;
-  modelSlots[slotIndex].isLoaded = true;
-  modelSlots[slotIndex].boundingBox = bbox;
-  strncpy(modelSlots[slotIndex].fileName, fileName, 255);
-  modelSlots[slotIndex].fileName[255] = '\0';
+  int slotIndex = StoreModelInSlot(model, path, contentHash, bbox, meshBounds);
+  if (slotIndex == -1) {
+    return -1; // Out of memory
+  }
 
   outBuffer[0] = slotIndex;
   outBuffer[1] = model.meshCount;
@@ -68,299 +612,2128 @@ EXPORT int LoadModelToSlot(const char *fileName, int *outBuffer) {
   return slotIndex;
 }
 
+// ----------------------------------------------------------------------------
+// Asynchronous loading. LoadModelAsync returns a request right away and the
+// frame loop calls UpdateModelLoads, which does the GL side of ready
+// requests within a time budget. GetModelLoadStatus yields the model slot.
+//
+// With the binary cache on, a worker reads the model's cache file: meshes,
+// materials and texture pixels are all in CPU memory before the frame loop
+// sees the request, and UpdateModelLoads only creates textures and uploads
+// meshes, one at a time, so a large model spreads over several frames.
+// Without a valid cache file the worker reads the source files into memory
+// (hashing them when needed) and raylib parses them on the GL thread: its
+// LoadModel creates textures and uploads meshes while parsing, so that call
+// cannot move to a worker or be split. Bounds are then computed on a worker
+// and the cache file written, so the next load takes the first path.
+//
+// Worker steps never run inside LoadModelAsync: one no worker can take yet
+// waits queued and is handed over by the next update (or, with no worker
+// threads at all, run there within the budget).
+// ----------------------------------------------------------------------------
+
+#define MODEL_LOAD_FAILED -1
+#define MODEL_LOAD_PENDING 0
+#define MODEL_LOAD_DONE 1
+
+// Request stages. A worker owns the request while READING or BOUNDING.
+#define MODEL_REQUEST_READING 0  // Worker reads the cache file or source
+#define MODEL_REQUEST_READ 1     // Source read, waiting for raylib to parse
+#define MODEL_REQUEST_BOUNDING 2 // Worker computes bounds
+#define MODEL_REQUEST_BOUNDED 3  // Waiting for UpdateModelLoads to publish
+#define MODEL_REQUEST_DONE 4
+#define MODEL_REQUEST_FAILED 5
+#define MODEL_REQUEST_QUEUED 6    // Worker step waiting for a worker
+#define MODEL_REQUEST_UPLOADING 7 // Cache file read, GPU uploads under way
+
+typedef struct {
+  char fileName[256];
+  char path[256];       // Canonical, for the model cache
+  bool shareByContent;  // Content cache mode: slots are shared by hash
+  bool useBinaryCache;  // Binary cache setting when the load started
+  uint64_t contentHash;
+  ModelPrefetch *prefetch;
+  ModelCacheLoad cacheLoad; // UPLOADING: what is left to upload
+  bool uploadStarted;       // Past the shared slot check
+  Model model;
+  BoundingBox boundingBox;
+  BoundingBox *meshBounds;
+  bool fromBinaryCache; // Model and bounds came from a cache file
+  int slotIndex;        // Result once DONE
+  JobFunction queuedJob; // Worker step to hand over while QUEUED
+  int queuedStage;       // Stage the request takes once handed over
+  int stage;     // Guarded by modelLoadLock
+} ModelLoadRequest;
+
+static HandleTable modelLoadRequests = HANDLE_TABLE_INIT(ModelLoadRequest);
+static JobLock modelLoadLock = JOB_LOCK_INIT;
+
+static int GetModelRequestStage(ModelLoadRequest *request) {
+  JobLockAcquire(&modelLoadLock);
+  int stage = request->stage;
+  JobLockRelease(&modelLoadLock);
+  return stage;
+}
+
+static void SetModelRequestStage(ModelLoadRequest *request, int stage) {
+  JobLockAcquire(&modelLoadLock);
+  request->stage = stage;
+  JobLockRelease(&modelLoadLock);
+}
+
+// Worker: read the model's cache file when it has a valid one, else the
+// files the parser will ask for
+static void ReadModelRequestJob(void *data) {
+  ModelLoadRequest *request = (ModelLoadRequest *)data;
+  char cachePath[300];
+  if (request->useBinaryCache &&
+      GetModelCacheFilePath(request->path, cachePath, sizeof(cachePath)) &&
+      ReadModelCacheFile(cachePath, request->path, &request->cacheLoad)) {
+    if (request->shareByContent) {
+      request->contentHash = HashModelSource(request->path);
+    }
+    request->fromBinaryCache = true;
+    SetModelRequestStage(request, MODEL_REQUEST_UPLOADING);
+    return;
+  }
+
+  PrefetchModelFiles(request->prefetch, request->fileName);
+  const PrefetchedFile *file = &request->prefetch->files[0];
+  if (file->data != NULL &&
+      (request->shareByContent || request->useBinaryCache)) {
+    request->contentHash = HashModelBytes(file->data, file->size);
+  }
+  SetModelRequestStage(request, file->data != NULL ? MODEL_REQUEST_READ
+                                                   : MODEL_REQUEST_FAILED);
+}
+
+// Worker: bounds of the uploaded model (CPU copies of the meshes only)
+static void BoundModelRequestJob(void *data) {
+  ModelLoadRequest *request = (ModelLoadRequest *)data;
+  request->meshBounds =
+      ComputeModelBounds(&request->model, &request->boundingBox);
+  SetModelRequestStage(request, MODEL_REQUEST_BOUNDED);
+}
+
+// Hand a worker step to the pool, entering its stage. When no worker can
+// take it the request waits QUEUED for UpdateModelLoads.
+static void SubmitModelRequest(ModelLoadRequest *request, JobFunction job,
+                               int stage) {
+  SetModelRequestStage(request, stage);
+  if (JobPoolSubmit(job, request)) {
+    return;
+  }
+  request->queuedJob = job;
+  request->queuedStage = stage;
+  SetModelRequestStage(request, MODEL_REQUEST_QUEUED);
+}
+
+// Main thread: finish the request with an already loaded slot of the same
+// model when the model cache has one
+static bool ShareCachedModelRequest(ModelLoadRequest *request) {
+  if (modelCacheMode == MODEL_CACHE_OFF) {
+    return false;
+  }
+  int cached = FindCachedModelSlot(request->path, request->contentHash);
+  if (cached < 0) {
+    return false;
+  }
+  GetModelSlot(cached)->refCount++;
+  request->slotIndex = cached;
+  SetModelRequestStage(request, MODEL_REQUEST_DONE);
+  return true;
+}
+
+// Main thread: next texture or mesh of a model read from its cache file
+static void UploadModelRequestStep(ModelLoadRequest *request) {
+  if (!request->uploadStarted) {
+    if (ShareCachedModelRequest(request)) {
+      UnloadModelCacheLoad(&request->cacheLoad);
+      return;
+    }
+    request->uploadStarted = true;
+  }
+  if (UploadModelCacheStep(&request->cacheLoad)) {
+    FinishModelCacheLoad(&request->cacheLoad, &request->model,
+                         &request->boundingBox, &request->meshBounds);
+    modelBinaryCacheHits++;
+    SetModelRequestStage(request, MODEL_REQUEST_BOUNDED);
+  }
+}
+
+// Main thread: share a cached slot or parse and upload from the prefetch
+static void UploadModelRequest(ModelLoadRequest *request) {
+  if (ShareCachedModelRequest(request)) {
+    UnloadModelPrefetch(request->prefetch);
+    return;
+  }
+  if (request->useBinaryCache) {
+    modelBinaryCacheMisses++;
+  }
+
+  request->model = LoadModelFromPrefetch(request->fileName, request->prefetch);
+  UnloadModelPrefetch(request->prefetch);
+  if (request->model.meshCount == 0) {
+    SetModelRequestStage(request, MODEL_REQUEST_FAILED);
+    return;
+  }
+  SubmitModelRequest(request, BoundModelRequestJob, MODEL_REQUEST_BOUNDING);
+}
+
+// Start loading a model in the background. Returns a request handle for
+// GetModelLoadStatus, or -1 for an invalid file name.
+EXPORT int LoadModelAsync(const char *fileName) {
+  if (fileName == NULL || fileName[0] == '\0' || strlen(fileName) >= 256) {
+    return -1;
+  }
+  ModelPrefetch *prefetch = (ModelPrefetch *)calloc(1, sizeof(ModelPrefetch));
+  int requestIndex =
+      prefetch != NULL ? HandleTableAlloc(&modelLoadRequests) : -1;
+  if (requestIndex == -1) {
+    free(prefetch);
+    return -1;
+  }
+
+  ModelLoadRequest *request = HandleTableGet(&modelLoadRequests, requestIndex);
+  strcpy(request->fileName, fileName);
+  GetCanonicalModelPath(fileName, request->path, sizeof(request->path));
+  request->shareByContent = modelCacheMode == MODEL_CACHE_CONTENT;
+  request->useBinaryCache = modelBinaryCacheEnabled;
+  request->prefetch = prefetch;
+  request->slotIndex = -1;
+  SubmitModelRequest(request, ReadModelRequestJob, MODEL_REQUEST_READING);
+  return requestIndex;
+}
+
+// Advance pending loads; call once per frame. Hands queued steps to the
+// workers, does GL work until budgetMs has passed (at least one step per
+// call) and publishes models whose bounds are done. A model read from its
+// cache file is uploaded one texture or mesh per step and may span several
+// calls; a raylib parse is a single step. Without worker threads queued
+// steps run here too, under the same budget. Returns the number of loads
+// still in flight.
+EXPORT int UpdateModelLoads(float budgetMs) {
+  double start = GetTime();
+  bool worked = false;
+  bool noWorkers = JobPoolThreadCount() == 0;
+  int pending = 0;
+
+  for (int i = 0; i < HandleTableCapacity(&modelLoadRequests); i++) {
+    ModelLoadRequest *request = HandleTableAt(&modelLoadRequests, i);
+    if (request == NULL) {
+      continue;
+    }
+    int stage = GetModelRequestStage(request);
+    if (stage == MODEL_REQUEST_QUEUED && !noWorkers) {
+      SubmitModelRequest(request, request->queuedJob, request->queuedStage);
+      stage = GetModelRequestStage(request);
+    } else if (stage == MODEL_REQUEST_QUEUED &&
+               (!worked || (GetTime() - start) * 1000.0 < budgetMs)) {
+      SetModelRequestStage(request, request->queuedStage);
+      request->queuedJob(request);
+      worked = true;
+      stage = GetModelRequestStage(request);
+    }
+    if (stage == MODEL_REQUEST_READ &&
+        (!worked || (GetTime() - start) * 1000.0 < budgetMs)) {
+      UploadModelRequest(request);
+      worked = true;
+      stage = GetModelRequestStage(request);
+    }
+    while (stage == MODEL_REQUEST_UPLOADING &&
+           (!worked || (GetTime() - start) * 1000.0 < budgetMs)) {
+      UploadModelRequestStep(request);
+      worked = true;
+      stage = GetModelRequestStage(request);
+    }
+    if (stage == MODEL_REQUEST_BOUNDED) {
+      if (!request->fromBinaryCache) {
+        WriteModelBinaryCache(request->path, request->contentHash,
+                              &request->model, request->boundingBox,
+                              request->meshBounds);
+      }
+      request->slotIndex =
+          StoreModelInSlot(request->model, request->path, request->contentHash,
+                           request->boundingBox, request->meshBounds);
+      stage = request->slotIndex >= 0 ? MODEL_REQUEST_DONE
+                                      : MODEL_REQUEST_FAILED;
+      SetModelRequestStage(request, stage);
+    }
+    if (stage != MODEL_REQUEST_DONE && stage != MODEL_REQUEST_FAILED) {
+      pending++;
+    }
+  }
+  return pending;
+}
+
+// MODEL_LOAD_PENDING while in flight. Once finished returns MODEL_LOAD_DONE
+// with outBuffer = [slotIndex, meshCount, materialCount] or MODEL_LOAD_FAILED,
+// and releases the request. Unknown requests report MODEL_LOAD_FAILED.
+EXPORT int GetModelLoadStatus(int requestIndex, int *outBuffer) {
+  outBuffer[0] = -1;
+  outBuffer[1] = 0;
+  outBuffer[2] = 0;
+
+  ModelLoadRequest *request = HandleTableGet(&modelLoadRequests, requestIndex);
+  if (request == NULL) {
+    return MODEL_LOAD_FAILED;
+  }
+  int stage = GetModelRequestStage(request);
+  if (stage != MODEL_REQUEST_DONE && stage != MODEL_REQUEST_FAILED) {
+    return MODEL_LOAD_PENDING;
+  }
+
+  ModelSlot *slot = GetModelSlot(request->slotIndex);
+  if (stage == MODEL_REQUEST_DONE && slot != NULL) {
+    outBuffer[0] = request->slotIndex;
+    outBuffer[1] = slot->model.meshCount;
+    outBuffer[2] = slot->model.materialCount;
+  }
+  UnloadModelPrefetch(request->prefetch);
+  free(request->prefetch);
+  HandleTableFree(&modelLoadRequests, requestIndex);
+  return outBuffer[0] >= 0 ? MODEL_LOAD_DONE : MODEL_LOAD_FAILED;
+}
+
 // Get model properties by slot index
 EXPORT int GetModelMeshCountBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0;
   }
-  return modelSlots[slotIndex].model.meshCount;
+  return slot->model.meshCount;
 }
 
 EXPORT int GetModelMaterialCountBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0;
   }
-  return modelSlots[slotIndex].model.materialCount;
+  return slot->model.materialCount;
 }
 
 // Get bounding box by slot index (returns individual components)
 EXPORT float GetModelBoundingBoxMinXBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0.0f;
   }
-  return modelSlots[slotIndex].boundingBox.min.x;
+  return slot->boundingBox.min.x;
 }
 
 EXPORT float GetModelBoundingBoxMinYBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0.0f;
   }
-  return modelSlots[slotIndex].boundingBox.min.y;
+  return slot->boundingBox.min.y;
 }
 
 EXPORT float GetModelBoundingBoxMinZBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0.0f;
   }
-  return modelSlots[slotIndex].boundingBox.min.z;
+  return slot->boundingBox.min.z;
 }
 
 EXPORT float GetModelBoundingBoxMaxXBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0.0f;
   }
-  return modelSlots[slotIndex].boundingBox.max.x;
+  return slot->boundingBox.max.x;
 }
 
 EXPORT float GetModelBoundingBoxMaxYBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return 0.0f;
+  }
+  return slot->boundingBox.max.y;
+}
+
+EXPORT float GetModelBoundingBoxMaxZBySlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
     return 0.0f;
   }
-  return modelSlots[slotIndex].boundingBox.max.y;
+  return slot->boundingBox.max.z;
+}
+
+// Free everything a retired slot owns (a copy taken at unload; the handle
+// table entry itself is already reused or free)
+static void ReleaseModelSlot(void *resource) {
+  ModelSlot *slot = (ModelSlot *)resource;
+  UnloadModelBVHs(slot);
+  UnloadModelLods(slot);
+  UnloadModelPoseBounds(slot);
+  free(slot->meshBounds);
+  free(slot->skinnedPose);
+  UnloadModel(slot->model);
+}
+
+// Unloaded models wait here for the frame loop to release them
+static DeferredUnloadQueue modelUnloads =
+    DEFERRED_UNLOAD_QUEUE_INIT(ModelSlot, ReleaseModelSlot);
+
+// Release one load of a model; resources are freed with the last one. The
+// handle is stale at once, the meshes and CPU side data go with the next
+// DrainModelUnloads.
+EXPORT void UnloadModelBySlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+  if (--slot->refCount > 0) {
+    return;
+  }
+
+  RemoveModelInstancesOfSlot(slotIndex);
+  DeferredUnloadPush(&modelUnloads, slot);
+  HandleTableFree(&modelSlots, slotIndex);
+}
+
+// Release queued models, then queued meshes, for up to budgetMs (negative:
+// all of them). Models go first since releasing one queues its detail
+// levels. Returns how many were released.
+EXPORT int DrainModelUnloads(float budgetMs) {
+  double start = GetTime();
+  int released = DeferredUnloadDrain(&modelUnloads, budgetMs);
+  float remainingMs = budgetMs;
+  if (budgetMs >= 0.0f) {
+    remainingMs = fmaxf(0.0f, budgetMs - (float)((GetTime() - start) * 1000.0));
+  }
+  return released + DeferredUnloadDrain(&meshUnloads, remainingMs);
+}
+
+// Defer model and mesh releases to DrainModelUnloads (default) or release
+// them on the spot; turning deferral off releases the queues
+EXPORT void SetDeferredModelUnload(bool enabled) {
+  DeferredUnloadSetImmediate(&modelUnloads, !enabled);
+  DeferredUnloadSetImmediate(&meshUnloads, !enabled);
+}
+
+// [queued, peak queued, released by drains] over the model and mesh queues
+// (the peak is the sum of both peaks, an upper bound), counters reset on
+// request
+EXPORT void GetModelUnloadStats(int *outBuffer, bool reset) {
+  int meshStats[3];
+  DeferredUnloadStats(&modelUnloads, outBuffer, reset);
+  DeferredUnloadStats(&meshUnloads, meshStats, reset);
+  for (int i = 0; i < 3; i++) {
+    outBuffer[i] += meshStats[i];
+  }
+}
+
+// ----------------------------------------------------------------------------
+// Animated bounds. The load-time bounds cover the bind pose only, which an
+// animation can leave far behind. For skinned models the per-mesh bounds of
+// the current pose are derived from per-bone bind pose boxes (see
+// mesh-skinning.h), rebuilt only when the bone matrices changed since the
+// last query. Culling and level selection use these; ray queries keep the
+// bind pose bounds since they test bind pose geometry.
+// ----------------------------------------------------------------------------
+
+// First mesh with a bone matrix array (raylib fills that one, then copies)
+static int FindSkinnedMesh(const Model *model) {
+  for (int i = 0; i < model->meshCount; i++) {
+    if (model->meshes[i].boneMatrices != NULL &&
+        model->meshes[i].boneCount > 0) {
+      return i;
+    }
+  }
+  return -1;
+}
+
+// Bone boxes of every skinned mesh, boneCount + 1 per mesh
+static bool BuildModelBoneBounds(ModelSlot *slot, int boneCount) {
+  const Model *model = &slot->model;
+  slot->boneBounds = (BoneBounds *)malloc(
+      sizeof(BoneBounds) * (size_t)(boneCount + 1) * model->meshCount);
+  if (slot->boneBounds == NULL) {
+    return false;
+  }
+  for (int m = 0; m < model->meshCount; m++) {
+    const Mesh *mesh = &model->meshes[m];
+    if (mesh->boneIds != NULL && mesh->boneWeights != NULL) {
+      BuildBoneBounds(mesh, boneCount,
+                      slot->boneBounds + (size_t)m * (boneCount + 1));
+    }
+  }
+  return true;
+}
+
+// Per-mesh bounds of the pose the model is in (model space, model.transform
+// not applied). Load-time bounds for unskinned models, NULL if unknown.
+static const BoundingBox *GetModelPoseMeshBounds(ModelSlot *slot) {
+  int firstSkinned = FindSkinnedMesh(&slot->model);
+  if (firstSkinned < 0 || slot->meshBounds == NULL) {
+    return slot->meshBounds;
+  }
+  const Matrix *bones = slot->model.meshes[firstSkinned].boneMatrices;
+  int boneCount = slot->model.meshes[firstSkinned].boneCount;
+  size_t poseSize = (size_t)boneCount * sizeof(Matrix);
+  if (slot->posedMeshBounds != NULL && slot->boundsPoseBoneCount == boneCount &&
+      memcmp(slot->boundsPose, bones, poseSize) == 0) {
+    return slot->posedMeshBounds;
+  }
+
+  if (slot->boundsPoseBoneCount != boneCount) {
+    UnloadModelPoseBounds(slot);
+    slot->posedMeshBounds = (BoundingBox *)malloc(sizeof(BoundingBox) *
+                                                  slot->model.meshCount);
+    slot->boundsPose = (Matrix *)malloc(poseSize);
+    if (slot->posedMeshBounds == NULL || slot->boundsPose == NULL ||
+        !BuildModelBoneBounds(slot, boneCount)) {
+      UnloadModelPoseBounds(slot);
+      return slot->meshBounds;
+    }
+    slot->boundsPoseBoneCount = boneCount;
+  }
+
+  for (int m = 0; m < slot->model.meshCount; m++) {
+    const Mesh *mesh = &slot->model.meshes[m];
+    slot->posedMeshBounds[m] =
+        mesh->boneIds != NULL && mesh->boneWeights != NULL
+            ? SkinnedMeshBounds(slot->boneBounds + (size_t)m * (boneCount + 1),
+                                boneCount, bones)
+            : slot->meshBounds[m];
+  }
+  memcpy(slot->boundsPose, bones, poseSize);
+  return slot->posedMeshBounds;
+}
+
+// Union of the current pose's mesh bounds (GetModelLocalBounds when posed
+// bounds are not available)
+static BoundingBox GetModelPoseBounds(ModelSlot *slot) {
+  const BoundingBox *meshBounds = GetModelPoseMeshBounds(slot);
+  if (meshBounds == NULL || meshBounds == slot->meshBounds) {
+    return GetModelLocalBounds(slot);
+  }
+  BoundingBox box = BVHEmptyBox();
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    BVHMergeBox(&box, meshBounds[i]);
+  }
+  return box;
+}
+
+static void WriteBoundsBuffer(BoundingBox box, float *outBuffer) {
+  outBuffer[0] = box.min.x;
+  outBuffer[1] = box.min.y;
+  outBuffer[2] = box.min.z;
+  outBuffer[3] = box.max.x;
+  outBuffer[4] = box.max.y;
+  outBuffer[5] = box.max.z;
+}
+
+// Bounds of each mesh in its current pose, 6 floats (min, max) per mesh for
+// up to capacity meshes. Returns the number written, 0 for an invalid slot.
+EXPORT int GetModelMeshBoundsBySlot(int slotIndex, float *outBuffer,
+                                    int capacity) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return 0;
+  }
+  const BoundingBox *meshBounds = GetModelPoseMeshBounds(slot);
+  int count = slot->model.meshCount < capacity ? slot->model.meshCount
+                                                : capacity;
+  for (int i = 0; i < count; i++) {
+    WriteBoundsBuffer(meshBounds != NULL ? meshBounds[i] : slot->boundingBox,
+                      outBuffer + i * 6);
+  }
+  return count;
+}
+
+// Whole-model bounds in the current pose for many slots at once: 6 floats
+// per slot, zeros for invalid ones. Returns the number of valid slots.
+EXPORT int GetModelBoundsBatch(const int *slotIndices, int count,
+                               float *outBuffer) {
+  int valid = 0;
+  for (int i = 0; i < count; i++) {
+    ModelSlot *slot = GetModelSlot(slotIndices[i]);
+    if (!slot) {
+      memset(outBuffer + i * 6, 0, 6 * sizeof(float));
+      continue;
+    }
+    WriteBoundsBuffer(GetModelPoseBounds(slot), outBuffer + i * 6);
+    valid++;
+  }
+  return valid;
+}
+
+// Frustum culling for model draws, on by default. Bounds are tested against
+// the matrices rlgl is about to draw with, so culling never hides anything
+// that would have been visible.
+static bool frustumCullingEnabled = true;
+static FrustumCullStats modelCullStats = {0};
+
+// Test model bounds under the draw transform DrawModelEx would build and
+// count the result. Returns true if the model should be drawn.
+static bool CullModelDraw(ModelSlot *slot, Matrix drawTransform) {
+  if (!frustumCullingEnabled) {
+    return true;
+  }
+
+  Matrix world = MatrixMultiply(slot->model.transform, drawTransform);
+  BoundingBox box = BVHTransformBox(GetModelPoseBounds(slot), world);
+  Frustum frustum = FrustumFromCurrentMatrices();
+  if (!FrustumContainsBox(&frustum, box)) {
+    modelCullStats.culled++;
+    return false;
+  }
+  modelCullStats.drawn++;
+  return true;
+}
+
+// Level selection: a model whose bounding sphere covers less than
+// modelLodScreenSize of the screen height draws level 1, each halving of that
+// size moves one level further. 0 keeps every draw at full detail.
+static float modelLodScreenSize = 0.5f;
+static int modelLodDraws[MODEL_MAX_LODS + 1] = {0}; // Draws per level
+
+// Bounding sphere diameter over screen height under the current rlgl
+// matrices (what BeginMode3D set up for the active camera)
+static float ProjectedModelSize(ModelSlot *slot, Matrix drawTransform) {
+  Matrix world = MatrixMultiply(MatrixMultiply(slot->model.transform,
+                                               drawTransform),
+                                rlGetMatrixTransform());
+  BoundingBox box = BVHTransformBox(GetModelPoseBounds(slot), world);
+  Vector3 center = Vector3Scale(Vector3Add(box.min, box.max), 0.5f);
+  float radius = Vector3Distance(box.min, box.max) * 0.5f;
+  Matrix projection = rlGetMatrixProjection();
+  if (projection.m15 != 0.0f) {
+    return radius * projection.m5; // Orthographic: independent of distance
+  }
+  float depth = -Vector3Transform(center, rlGetMatrixModelview()).z;
+  if (depth <= radius) {
+    return INFINITY; // Camera inside or at the sphere
+  }
+  return radius * projection.m5 / depth;
+}
+
+// Level for a projected size, counted in modelLodDraws
+static int SelectModelLodLevel(const ModelSlot *slot, float size) {
+  int level = 0;
+  float threshold = modelLodScreenSize;
+  while (level < slot->lodCount && size < threshold) {
+    level++;
+    threshold *= 0.5f;
+  }
+  modelLodDraws[level]++;
+  return level;
+}
+
+// The slot's model with the meshes of the level picked for this draw
+static Model SelectModelLod(ModelSlot *slot, Matrix drawTransform) {
+  Model model = slot->model;
+  if (slot->lodCount > 0) {
+    int level =
+        SelectModelLodLevel(slot, ProjectedModelSize(slot, drawTransform));
+    if (level > 0) {
+      model.meshes = slot->lodMeshes[level - 1];
+    }
+  }
+  return model;
+}
+
+EXPORT void SetModelLodScreenSize(float screenSize) {
+  modelLodScreenSize = screenSize > 0.0f ? screenSize : 0.0f;
+}
+
+// Draws per level since the last reset: [full detail, level 1 ... level 4]
+EXPORT void GetModelLodStats(int *outBuffer, bool reset) {
+  memcpy(outBuffer, modelLodDraws, sizeof(modelLodDraws));
+  if (reset) {
+    memset(modelLodDraws, 0, sizeof(modelLodDraws));
+  }
+}
+
+static Matrix ModelDrawTransform(Vector3 position, Vector3 rotationAxis,
+                                 float rotationAngle, Vector3 scale) {
+  Matrix matScale = MatrixScale(scale.x, scale.y, scale.z);
+  Matrix matRotation = MatrixRotate(rotationAxis, rotationAngle * DEG2RAD);
+  Matrix matTranslation = MatrixTranslate(position.x, position.y, position.z);
+  return MatrixMultiply(MatrixMultiply(matScale, matRotation), matTranslation);
+}
+
+EXPORT void SetFrustumCullingEnabled(bool enabled) {
+  frustumCullingEnabled = enabled;
+}
+
+// Culling counters since the last reset: [culled, drawn]
+EXPORT void GetFrustumCullingStats(int *outBuffer, bool reset) {
+  outBuffer[0] = modelCullStats.culled;
+  outBuffer[1] = modelCullStats.drawn;
+  if (reset) {
+    modelCullStats = (FrustumCullStats){0};
+  }
+}
+
+// Draw model by slot index
+EXPORT void DrawModelBySlot(int slotIndex, float posX, float posY, float posZ,
+                            float scale, Color tint) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  Vector3 position = {posX, posY, posZ};
+  Matrix drawTransform =
+      ModelDrawTransform(position, (Vector3){0.0f, 1.0f, 0.0f}, 0.0f,
+                         (Vector3){scale, scale, scale});
+  if (!CullModelDraw(slot, drawTransform)) {
+    return;
+  }
+  DrawModel(SelectModelLod(slot, drawTransform), position, scale, tint);
+}
+
+// Draw model with extended parameters
+EXPORT void DrawModelExBySlot(int slotIndex, float posX, float posY, float posZ,
+                              float rotAxisX, float rotAxisY, float rotAxisZ,
+                              float rotationAngle, float scaleX, float scaleY,
+                              float scaleZ, Color tint) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  Vector3 position = {posX, posY, posZ};
+  Vector3 rotationAxis = {rotAxisX, rotAxisY, rotAxisZ};
+  Vector3 scale = {scaleX, scaleY, scaleZ};
+  Matrix drawTransform =
+      ModelDrawTransform(position, rotationAxis, rotationAngle, scale);
+  if (!CullModelDraw(slot, drawTransform)) {
+    return;
+  }
+  DrawModelEx(SelectModelLod(slot, drawTransform), position, rotationAxis,
+              rotationAngle, scale, tint);
+}
+
+// Draw model wires by slot index
+EXPORT void DrawModelWiresBySlot(int slotIndex, float posX, float posY,
+                                 float posZ, float scale, Color tint) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  Vector3 position = {posX, posY, posZ};
+  Matrix drawTransform =
+      ModelDrawTransform(position, (Vector3){0.0f, 1.0f, 0.0f}, 0.0f,
+                         (Vector3){scale, scale, scale});
+  if (!CullModelDraw(slot, drawTransform)) {
+    return;
+  }
+  DrawModelWires(SelectModelLod(slot, drawTransform), position, scale, tint);
+}
+
+static Matrix *instanceTransforms = NULL; // Scratch, grown on demand
+static int instanceTransformCapacity = 0;
+
+// Draw count copies of the model in one instanced draw call per mesh.
+// transforms holds one Matrix (16 floats, raylib memory order) per copy.
+// shader replaces the material shaders for this draw and must read the
+// per-instance "instanceTransform" vertex attribute; it is owned by the
+// shader wrapper, which resolves that location at load, and is only read
+// here. Copies outside the view frustum are dropped first. All copies share
+// the level of detail picked for the largest one on screen. Returns the
+// number of copies drawn.
+EXPORT int DrawModelInstancedBySlot(int slotIndex, float *transforms, int count,
+                                    const Shader *shader) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot || transforms == NULL || count <= 0 ||
+      shader == NULL || shader->id == 0 || shader->locs == NULL) {
+    return 0;
+  }
+
+  if (count > instanceTransformCapacity) {
+    Matrix *grown = (Matrix *)realloc(instanceTransforms,
+                                      (size_t)count * sizeof(Matrix));
+    if (grown == NULL) {
+      return 0;
+    }
+    instanceTransforms = grown;
+    instanceTransformCapacity = count;
+  }
+
+  // Same world transform and culling test DrawModelEx gets per copy
+  const Matrix *input = (const Matrix *)transforms;
+  BoundingBox localBounds = GetModelPoseBounds(slot);
+  Frustum frustum = FrustumFromCurrentMatrices();
+  int visible = 0;
+  float largestSize = 0.0f;
+  for (int i = 0; i < count; i++) {
+    Matrix world = MatrixMultiply(slot->model.transform, input[i]);
+    if (frustumCullingEnabled) {
+      if (!FrustumContainsBox(&frustum, BVHTransformBox(localBounds, world))) {
+        modelCullStats.culled++;
+        continue;
+      }
+      modelCullStats.drawn++;
+    }
+    if (slot->lodCount > 0) {
+      largestSize = fmaxf(largestSize, ProjectedModelSize(slot, input[i]));
+    }
+    instanceTransforms[visible++] = world;
+  }
+  if (visible == 0) {
+    return 0;
+  }
+  Mesh *meshes = slot->model.meshes;
+  if (slot->lodCount > 0) {
+    int level = SelectModelLodLevel(slot, largestSize);
+    if (level > 0) {
+      meshes = slot->lodMeshes[level - 1];
+    }
+  }
+
+  Model *model = &slot->model;
+  for (int m = 0; m < model->meshCount; m++) {
+    Material material = model->materials[model->meshMaterial[m]];
+    material.shader = *shader;
+    DrawMeshInstanced(meshes[m], material, instanceTransforms, visible);
+  }
+  return visible;
+}
+
+// Get number of loaded models
+EXPORT int GetLoadedModelCount() {
+  return HandleTableCount(&modelSlots);
+}
+
+// Unload all models
+EXPORT void UnloadAllModels() {
+  for (int i = 0; i < HandleTableCapacity(&modelSlots); i++) {
+    ModelSlot *slot = HandleTableAt(&modelSlots, i);
+    if (slot) {
+      slot->refCount = 1; // Drop every shared load at once
+      UnloadModelBySlot(HandleTableHandleAt(&modelSlots, i));
+    }
+  }
+}
+
+// Check if model slot is valid and loaded
+EXPORT bool IsModelSlotValid(int slotIndex) {
+  return GetModelSlot(slotIndex) != NULL;
+}
+
+// Get pointer to Model from slot (for animation system)
+EXPORT Model *GetModelPointerFromSlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return NULL;
+  }
+  return &slot->model;
+}
+
+// Optimized: Get model data in one call (slotIndex, meshCount, materialCount)
+EXPORT void GetModelDataBySlot(int slotIndex, int *outBuffer) {
+  // Initialize output buffer
+  outBuffer[0] = -1; // slotIndex (invalid by default)
+  outBuffer[1] = 0;  // meshCount
+  outBuffer[2] = 0;  // materialCount
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  outBuffer[0] = slotIndex;
+  outBuffer[1] = slot->model.meshCount;
+  outBuffer[2] = slot->model.materialCount;
+}
+
+// Optimized: Get bounding box in one call (min.x, min.y, min.z, max.x, max.y,
+// max.z)
+EXPORT void GetModelBoundingBoxBySlot(int slotIndex, float *outBuffer) {
+  // Initialize output buffer
+  outBuffer[0] = 0.0f; // min.x
+  outBuffer[1] = 0.0f; // min.y
+  outBuffer[2] = 0.0f; // min.z
+  outBuffer[3] = 0.0f; // max.x
+  outBuffer[4] = 0.0f; // max.y
+  outBuffer[5] = 0.0f; // max.z
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  BoundingBox bbox = slot->boundingBox;
+  outBuffer[0] = bbox.min.x;
+  outBuffer[1] = bbox.min.y;
+  outBuffer[2] = bbox.min.z;
+  outBuffer[3] = bbox.max.x;
+  outBuffer[4] = bbox.max.y;
+  outBuffer[5] = bbox.max.z;
+}
+
+// Get ray collision with model mesh
+EXPORT void GetRayCollisionModelMesh(Ray *ray, int slotIndex, int meshIndex,
+                                     Matrix *transform, float *outBuffer) {
+  // Initialize output buffer as no hit
+  outBuffer[0] = 0.0f; // hit
+  outBuffer[1] = 0.0f; // distance
+  outBuffer[2] = 0.0f; // point.x
+  outBuffer[3] = 0.0f; // point.y
+  outBuffer[4] = 0.0f; // point.z
+  outBuffer[5] = 0.0f; // normal.x
+  outBuffer[6] = 0.0f; // normal.y
+  outBuffer[7] = 0.0f; // normal.z
+
+  // Validate slot and mesh index
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return;
+  }
+
+  Model *model = &slot->model;
+  if (meshIndex < 0 || meshIndex >= model->meshCount) {
+    return;
+  }
+
+  MeshBVH *bvh = GetModelMeshBVH(slot, meshIndex);
+  if (bvh == NULL) {
+    return;
+  }
+
+  // Query the cached BVH in mesh space instead of testing every triangle
+  Matrix finalTransform = transform ? *transform : MatrixIdentity();
+  Matrix invTransform = transform ? MatrixInvert(*transform) : finalTransform;
+  RayCollision collision = {0};
+  MeshBVHRaycast(bvh, *ray, finalTransform, invTransform, FLT_MAX, &collision);
+
+  // Write collision data to output buffer
+  outBuffer[0] = collision.hit ? 1.0f : 0.0f;
+  outBuffer[1] = collision.distance;
+  outBuffer[2] = collision.point.x;
+  outBuffer[3] = collision.point.y;
+  outBuffer[4] = collision.point.z;
+  outBuffer[5] = collision.normal.x;
+  outBuffer[6] = collision.normal.y;
+  outBuffer[7] = collision.normal.z;
+}
+
+// Closest hit over all meshes of a slot, returns hit mesh index or -1.
+// Mesh bounds are in model space, so they are tested against the local ray.
+static int RaycastModelSlot(ModelSlot *slot, Ray ray, Matrix transform,
+                            Matrix invTransform, float maxDistance,
+                            RayCollision *outCollision, int *outTriangle) {
+  Vector3 localOrigin = Vector3Transform(ray.position, invTransform);
+  Vector3 localDir = BVHTransformDirection(ray.direction, invTransform);
+  Vector3 invDir = {1.0f / localDir.x, 1.0f / localDir.y, 1.0f / localDir.z};
+
+  RayCollision closest = {0};
+  closest.distance = maxDistance;
+  int hitMesh = -1;
+  int hitTriangle = -1;
+
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    if (slot->meshBounds != NULL &&
+        BVHIntersectBox(localOrigin, invDir, slot->meshBounds[i].min,
+                        slot->meshBounds[i].max,
+                        closest.distance) == FLT_MAX) {
+      continue; // Mesh box missed or farther than current closest hit
+    }
+
+    MeshBVH *bvh = GetModelMeshBVH(slot, i);
+    if (bvh == NULL) {
+      continue;
+    }
+
+    RayCollision collision = {0};
+    int tri = MeshBVHRaycast(bvh, ray, transform, invTransform,
+                             closest.distance, &collision);
+    if (tri >= 0) {
+      closest = collision;
+      hitMesh = i;
+      hitTriangle = tri;
+    }
+  }
+
+  if (hitMesh >= 0) {
+    *outCollision = closest;
+  }
+  if (outTriangle != NULL) {
+    *outTriangle = hitTriangle;
+  }
+  return hitMesh;
+}
+
+// Write collision in the 8-float layout used by all ray query functions
+static void WriteCollisionBuffer(RayCollision collision, float *outBuffer) {
+  outBuffer[0] = collision.hit ? 1.0f : 0.0f;
+  outBuffer[1] = collision.distance;
+  outBuffer[2] = collision.point.x;
+  outBuffer[3] = collision.point.y;
+  outBuffer[4] = collision.point.z;
+  outBuffer[5] = collision.normal.x;
+  outBuffer[6] = collision.normal.y;
+  outBuffer[7] = collision.normal.z;
+}
+
+// Get ray collision with every mesh of a model, returns index of the closest
+// hit mesh (-1 on miss). Output buffer uses the GetRayCollisionModelMesh layout.
+EXPORT int GetRayCollisionModel(Ray *ray, int slotIndex, Matrix *transform,
+                                float *outBuffer) {
+  RayCollision collision = {0};
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    WriteCollisionBuffer(collision, outBuffer);
+    return -1;
+  }
+
+  Matrix finalTransform = transform ? *transform : MatrixIdentity();
+  Matrix invTransform = transform ? MatrixInvert(*transform) : finalTransform;
+  int hitMesh = RaycastModelSlot(slot, *ray, finalTransform,
+                                 invTransform, FLT_MAX, &collision, NULL);
+
+  WriteCollisionBuffer(collision, outBuffer);
+  return hitMesh;
+}
+
+// Cast many rays against one model slot. Rays are packed as 6 floats
+// (origin, direction). Each result takes RAYCAST_BATCH_STRIDE floats: the
+// 8-float collision layout followed by mesh index and triangle index (-1 on
+// miss). Returns number of rays that hit.
+#define RAYCAST_BATCH_STRIDE 10
+
+EXPORT int RaycastBatch(float *rays, int count, int slotIndex,
+                        Matrix *transform, float *outBuffer) {
+  if (rays == NULL || outBuffer == NULL || count <= 0) {
+    return 0;
+  }
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  bool validSlot = slot != NULL;
+  // Inverse is shared by the whole batch
+  Matrix finalTransform = transform ? *transform : MatrixIdentity();
+  Matrix invTransform = transform ? MatrixInvert(*transform) : finalTransform;
+
+  int hitCount = 0;
+  for (int i = 0; i < count; i++) {
+    float *out = &outBuffer[i * RAYCAST_BATCH_STRIDE];
+    RayCollision collision = {0};
+    int hitMesh = -1;
+    int hitTriangle = -1;
+
+    if (validSlot) {
+      Ray ray = {{rays[i * 6 + 0], rays[i * 6 + 1], rays[i * 6 + 2]},
+                 {rays[i * 6 + 3], rays[i * 6 + 4], rays[i * 6 + 5]}};
+      hitMesh = RaycastModelSlot(slot, ray, finalTransform,
+                                 invTransform, FLT_MAX, &collision,
+                                 &hitTriangle);
+    }
+
+    WriteCollisionBuffer(collision, out);
+    out[8] = (float)hitMesh;
+    out[9] = (float)hitTriangle;
+    if (hitMesh >= 0) {
+      hitCount++;
+    }
+  }
+  return hitCount;
+}
+
+// Build ray query BVHs for every mesh of a model up front (otherwise they are
+// built on first query). Returns total node count, or -1 for invalid slot.
+EXPORT int BuildModelBVHBySlot(int slotIndex) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return -1;
+  }
+
+  int nodeCount = 0;
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    MeshBVH *bvh = GetModelMeshBVH(slot, i);
+    if (bvh != NULL) {
+      nodeCount += bvh->nodeCount;
+    }
+  }
+  return nodeCount;
+}
+
+// ============================================================================
+// SHAPE QUERIES (sphere-cast, capsule-cast, closest point)
+// ============================================================================
+
+// Result layout: 8-float collision layout, mesh index, triangle index and
+// penetration depth. Distance is the cast parameter (or the point distance).
+#define SHAPE_QUERY_STRIDE 11
+
+static void WriteContactBuffer(bool hit, ShapeContact contact, int meshIndex,
+                               float *outBuffer) {
+  RayCollision collision = {0};
+  if (hit) {
+    collision.hit = true;
+    collision.distance = contact.distance;
+    collision.point = contact.point;
+    collision.normal = contact.normal;
+  }
+  WriteCollisionBuffer(collision, outBuffer);
+  outBuffer[8] = hit ? (float)meshIndex : -1.0f;
+  outBuffer[9] = hit ? (float)contact.triangle : -1.0f;
+  outBuffer[10] = hit ? contact.depth : 0.0f;
+}
+
+// Capsule cast over all meshes of a slot, returns hit mesh index or -1
+static int CapsuleCastModelSlot(ModelSlot *slot, Matrix transform, Vector3 a,
+                                Vector3 b, float radius, Vector3 motion,
+                                float maxDistance, ShapeContact *outContact) {
+  Vector3 center = Vector3Scale(Vector3Add(a, b), 0.5f);
+  Vector3 halfSeg = Vector3Scale(Vector3Subtract(b, a), 0.5f);
+  Vector3 extent = {fabsf(halfSeg.x) + radius, fabsf(halfSeg.y) + radius,
+                    fabsf(halfSeg.z) + radius};
+  Vector3 invDir = {1.0f / motion.x, 1.0f / motion.y, 1.0f / motion.z};
+
+  float closest = maxDistance;
+  int hitMesh = -1;
+
+  for (int i = 0; i < slot->model.meshCount; i++) {
+    if (slot->meshBounds != NULL) {
+      BoundingBox box = BVHTransformBox(slot->meshBounds[i], transform);
+      box.min = Vector3Subtract(box.min, extent);
+      box.max = Vector3Add(box.max, extent);
+      bool inside = ShapePointBoxDistanceSqr(center, box.min, box.max) == 0.0f;
+      if (!inside &&
+          BVHIntersectBox(center, invDir, box.min, box.max, closest) == FLT_MAX) {
+        continue;
+      }
+    }
+
+    MeshBVH *bvh = GetModelMeshBVH(slot, i);
+    if (bvh == NULL) {
+      continue;
+    }
+
+    ShapeContact contact;
+    if (MeshBVHCapsuleCast(bvh, transform, a, b, radius, motion, closest,
+                           &contact) &&
+        (hitMesh < 0 || contact.distance < closest ||
+         (contact.distance == 0.0f && contact.depth > outContact->depth))) {
+      closest = contact.distance;
+      *outContact = contact;
+      hitMesh = i;
+    }
+  }
+  return hitMesh;
+}
+
+// Sweep a sphere along a ray. maxDistance <= 0 means unlimited.
+// Writes SHAPE_QUERY_STRIDE floats, returns hit mesh index or -1.
+EXPORT int SphereCastModel(Ray *ray, float radius, float maxDistance,
+                           int slotIndex, Matrix *transform, float *outBuffer) {
+  ShapeContact contact = {0};
+  int hitMesh = -1;
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (ray != NULL && radius >= 0.0f && slot != NULL) {
+    hitMesh = CapsuleCastModelSlot(
+        slot, transform ? *transform : MatrixIdentity(),
+        ray->position, ray->position, radius, ray->direction,
+        maxDistance > 0.0f ? maxDistance : FLT_MAX, &contact);
+  }
+
+  WriteContactBuffer(hitMesh >= 0, contact, hitMesh, outBuffer);
+  return hitMesh;
+}
+
+// Sweep a capsule (capsule: [ax, ay, az, bx, by, bz, radius]) along motion
+// (dx, dy, dz). maxDistance is in units of motion, <= 0 means unlimited.
+// Writes SHAPE_QUERY_STRIDE floats, returns hit mesh index or -1.
+EXPORT int CapsuleCastModel(float *capsule, float *motion, float maxDistance,
+                            int slotIndex, Matrix *transform,
+                            float *outBuffer) {
+  ShapeContact contact = {0};
+  int hitMesh = -1;
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (capsule != NULL && motion != NULL && capsule[6] >= 0.0f &&
+      slot != NULL) {
+    Vector3 a = {capsule[0], capsule[1], capsule[2]};
+    Vector3 b = {capsule[3], capsule[4], capsule[5]};
+    Vector3 dir = {motion[0], motion[1], motion[2]};
+    hitMesh = CapsuleCastModelSlot(
+        slot, transform ? *transform : MatrixIdentity(), a, b,
+        capsule[6], dir, maxDistance > 0.0f ? maxDistance : FLT_MAX, &contact);
+  }
+
+  WriteContactBuffer(hitMesh >= 0, contact, hitMesh, outBuffer);
+  return hitMesh;
+}
+
+// Closest point on the model surface within radius of (x, y, z); radius <= 0
+// searches without limit. Depth is radius - distance, so a sphere overlap test
+// reports its penetration. Writes SHAPE_QUERY_STRIDE floats, returns hit mesh
+// index or -1.
+EXPORT int ClosestPointOnModel(float x, float y, float z, float radius,
+                               int slotIndex, Matrix *transform,
+                               float *outBuffer) {
+  ShapeContact contact = {0};
+  int hitMesh = -1;
+
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (slot != NULL) {
+    Matrix finalTransform = transform ? *transform : MatrixIdentity();
+    Vector3 p = {x, y, z};
+    float closest = radius > 0.0f ? radius : FLT_MAX;
+
+    for (int i = 0; i < slot->model.meshCount; i++) {
+      if (slot->meshBounds != NULL) {
+        BoundingBox box = BVHTransformBox(slot->meshBounds[i], finalTransform);
+        float d = ShapePointBoxDistanceSqr(p, box.min, box.max);
+        if (closest < sqrtf(FLT_MAX) && d > closest * closest) {
+          continue;
+        }
+      }
+
+      MeshBVH *bvh = GetModelMeshBVH(slot, i);
+      ShapeContact meshContact;
+      if (bvh != NULL &&
+          MeshBVHClosestPoint(bvh, finalTransform, p, closest, &meshContact)) {
+        closest = meshContact.distance;
+        contact = meshContact;
+        hitMesh = i;
+      }
+    }
+    if (hitMesh >= 0 && radius > 0.0f) {
+      contact.depth = radius - contact.distance;
+    }
+  }
+
+  WriteContactBuffer(hitMesh >= 0, contact, hitMesh, outBuffer);
+  return hitMesh;
+}
+
+// ============================================================================
+// INSTANCE FUNCTIONS (scene-level ray queries)
+// ============================================================================
+
+static void SetInstanceTransform(ModelInstance *instance, Matrix transform) {
+  instance->transform = transform;
+  instance->invTransform = MatrixInvert(transform);
+  instance->worldBounds = BVHTransformBox(
+      GetModelLocalBounds(GetModelSlot(instance->modelSlot)), transform);
+  sceneBVHDirty = true;
+}
+
+static void RebuildSceneBVH(void) {
+  int count = HandleTableCount(&modelInstances);
+  UnloadBoxBVH(&sceneBVH);
+  sceneBVHDirty = false;
+  if (count == 0) {
+    return;
+  }
+
+  if (count > sceneInstanceCapacity) {
+    int *indices = realloc(sceneInstanceIndices, count * sizeof(int));
+    if (!indices) {
+      return; // Empty scene until the next change retries
+    }
+    sceneInstanceIndices = indices;
+    sceneInstanceCapacity = count;
+  }
+  BoundingBox *bounds = malloc(count * sizeof(BoundingBox));
+  if (!bounds) {
+    return;
+  }
+
+  int primitive = 0;
+  for (int i = 0; i < HandleTableCapacity(&modelInstances); i++) {
+    ModelInstance *instance = HandleTableAt(&modelInstances, i);
+    if (instance) {
+      bounds[primitive] = instance->worldBounds;
+      sceneInstanceIndices[primitive] = i;
+      primitive++;
+    }
+  }
+  BuildBoxBVH(&sceneBVH, bounds, count);
+  free(bounds);
+}
+
+// Place a model in the scene, returns instance id or -1
+EXPORT int CreateModelInstance(int slotIndex, Matrix *transform) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot) {
+    return -1;
+  }
+
+  int instanceId = HandleTableAlloc(&modelInstances);
+  if (instanceId == -1) {
+    return -1; // Out of memory or instance ids
+  }
+
+  ModelInstance *instance = GetModelInstance(instanceId);
+  instance->modelSlot = slotIndex;
+  instance->prevInSlot = -1;
+  instance->nextInSlot = slot->firstInstance;
+  if (slot->firstInstance >= 0) {
+    GetModelInstance(slot->firstInstance)->prevInSlot = instanceId;
+  }
+  slot->firstInstance = instanceId;
+  SetInstanceTransform(instance, transform ? *transform : MatrixIdentity());
+  return instanceId;
+}
+
+EXPORT bool SetModelInstanceTransform(int instanceId, Matrix *transform) {
+  ModelInstance *instance = GetModelInstance(instanceId);
+  if (!instance || transform == NULL) {
+    return false;
+  }
+  SetInstanceTransform(instance, *transform);
+  return true;
+}
+
+EXPORT void RemoveModelInstance(int instanceId) {
+  FreeModelInstance(instanceId);
+}
+
+EXPORT void ClearModelInstances() {
+  for (int i = 0; i < HandleTableCapacity(&modelInstances); i++) {
+    FreeModelInstance(HandleTableHandleAt(&modelInstances, i));
+  }
+}
+
+EXPORT int GetModelInstanceCount() {
+  return HandleTableCount(&modelInstances);
+}
+
+// Closest hit over all instances. Traverses the top-level BVH front-to-back
+// and only descends into an instance's meshes when its world box is nearer
+// than the current closest hit. Returns instance id or -1.
+static int RaycastSceneInstances(Ray ray, float maxDistance,
+                                 RayCollision *outCollision, int *outMesh,
+                                 int *outTriangle) {
+  if (sceneBVHDirty) {
+    RebuildSceneBVH();
+  }
+  if (sceneBVH.nodeCount == 0) {
+    return -1;
+  }
+
+  Vector3 invDir = {1.0f / ray.direction.x, 1.0f / ray.direction.y,
+                    1.0f / ray.direction.z};
+  float closest = maxDistance;
+  int hitInstance = -1;
+
+  int stack[BVH_STACK_SIZE];
+  int stackSize = 0;
+  stack[stackSize++] = 0;
+
+  while (stackSize > 0) {
+    const BVHNode *node = &sceneBVH.nodes[stack[--stackSize]];
+    if (BVHIntersectBox(ray.position, invDir, node->min, node->max, closest) ==
+        FLT_MAX) {
+      continue; // Node was pushed before a nearer hit was found
+    }
+
+    if (node->count > 0) {
+      for (int i = 0; i < node->count; i++) {
+        int index =
+            sceneInstanceIndices[sceneBVH.primitives[node->leftFirst + i]];
+        ModelInstance *instance = HandleTableAt(&modelInstances, index);
+        if (BVHIntersectBox(ray.position, invDir, instance->worldBounds.min,
+                            instance->worldBounds.max, closest) == FLT_MAX) {
+          continue;
+        }
+
+        RayCollision collision = {0};
+        int triangle = -1;
+        int mesh = RaycastModelSlot(GetModelSlot(instance->modelSlot), ray,
+                                    instance->transform, instance->invTransform,
+                                    closest, &collision, &triangle);
+        if (mesh >= 0) {
+          closest = collision.distance;
+          hitInstance = HandleTableHandleAt(&modelInstances, index);
+          *outCollision = collision;
+          *outMesh = mesh;
+          *outTriangle = triangle;
+        }
+      }
+      continue;
+    }
+
+    int near = node->leftFirst, far = node->leftFirst + 1;
+    float dNear = BVHIntersectBox(ray.position, invDir, sceneBVH.nodes[near].min,
+                                  sceneBVH.nodes[near].max, closest);
+    float dFar = BVHIntersectBox(ray.position, invDir, sceneBVH.nodes[far].min,
+                                 sceneBVH.nodes[far].max, closest);
+    if (dFar < dNear) {
+      int ti = near;
+      near = far;
+      far = ti;
+      float td = dNear;
+      dNear = dFar;
+      dFar = td;
+    }
+    if (dFar != FLT_MAX && stackSize < BVH_STACK_SIZE) {
+      stack[stackSize++] = far;
+    }
+    if (dNear != FLT_MAX && stackSize < BVH_STACK_SIZE) {
+      stack[stackSize++] = near;
+    }
+  }
+  return hitInstance;
+}
+
+// First hit in the scene. Output uses the RaycastBatch layout (8-float
+// collision, mesh index, triangle index). Returns instance id or -1.
+EXPORT int RaycastScene(Ray *ray, float maxDistance, float *outBuffer) {
+  RayCollision collision = {0};
+  int hitMesh = -1;
+  int hitTriangle = -1;
+  int hitInstance = -1;
+
+  if (ray != NULL) {
+    hitInstance = RaycastSceneInstances(
+        *ray, maxDistance > 0.0f ? maxDistance : FLT_MAX, &collision, &hitMesh,
+        &hitTriangle);
+  }
+
+  WriteCollisionBuffer(collision, outBuffer);
+  outBuffer[8] = (float)hitMesh;
+  outBuffer[9] = (float)hitTriangle;
+  return hitInstance;
+}
+
+// ============================================================================
+// CAMERA FUNCTIONS (persistent cameras for mouse picking)
+// ============================================================================
+
+typedef struct {
+  Camera3D camera;
+} CameraSlot;
+
+static HandleTable cameraSlots = HANDLE_TABLE_INIT(CameraSlot);
+
+// Live camera for a handle, NULL when invalid or unloaded
+static CameraSlot *GetCameraSlot(int cameraSlot) {
+  return HandleTableGet(&cameraSlots, cameraSlot);
+}
+
+// Create a camera that lives on the native side, same parameters as
+// BeginMode3DWrapper. Returns camera slot or -1.
+EXPORT int CreateCamera3DSlot(float posX, float posY, float posZ,
+                              float targetX, float targetY, float targetZ,
+                              float upX, float upY, float upZ, float fovy,
+                              int projection) {
+  int cameraSlot = HandleTableAlloc(&cameraSlots);
+  if (cameraSlot == -1) {
+    return -1; // Out of memory
+  }
+  GetCameraSlot(cameraSlot)->camera = (Camera3D){{posX, posY, posZ},
+                                                 {targetX, targetY, targetZ},
+                                                 {upX, upY, upZ},
+                                                 fovy,
+                                                 projection};
+  return cameraSlot;
+}
+
+EXPORT bool SetCamera3DBySlot(int cameraSlot, float posX, float posY,
+                              float posZ, float targetX, float targetY,
+                              float targetZ, float upX, float upY, float upZ,
+                              float fovy, int projection) {
+  CameraSlot *camera = GetCameraSlot(cameraSlot);
+  if (!camera) {
+    return false;
+  }
+  camera->camera = (Camera3D){{posX, posY, posZ},
+                              {targetX, targetY, targetZ},
+                              {upX, upY, upZ},
+                              fovy,
+                              projection};
+  return true;
+}
+
+EXPORT void UnloadCamera3DSlot(int cameraSlot) {
+  HandleTableFree(&cameraSlots, cameraSlot);
+}
+
+EXPORT void BeginMode3DBySlot(int cameraSlot) {
+  CameraSlot *camera = GetCameraSlot(cameraSlot);
+  if (!camera) {
+    return;
+  }
+  BeginMode3D(camera->camera);
+}
+
+// World-space ray through a screen position, written as
+// [posX, posY, posZ, dirX, dirY, dirZ]. Returns false for invalid camera.
+EXPORT bool GetScreenToWorldRayBySlot(int cameraSlot, float screenX,
+                                      float screenY, float *outBuffer) {
+  CameraSlot *camera = GetCameraSlot(cameraSlot);
+  if (!camera) {
+    return false;
+  }
+  Ray ray = GetScreenToWorldRay((Vector2){screenX, screenY}, camera->camera);
+  outBuffer[0] = ray.position.x;
+  outBuffer[1] = ray.position.y;
+  outBuffer[2] = ray.position.z;
+  outBuffer[3] = ray.direction.x;
+  outBuffer[4] = ray.direction.y;
+  outBuffer[5] = ray.direction.z;
+  return true;
+}
+
+// Pick the closest scene instance under a screen position: ray construction
+// and scene query in one call. Output uses the RaycastScene layout.
+// Returns instance id or -1.
+EXPORT int PickSceneInstanceBySlot(int cameraSlot, float screenX,
+                                   float screenY, float *outBuffer) {
+  RayCollision collision = {0};
+  int hitMesh = -1;
+  int hitTriangle = -1;
+  int hitInstance = -1;
+
+  CameraSlot *camera = GetCameraSlot(cameraSlot);
+  if (camera != NULL) {
+    Ray ray = GetScreenToWorldRay((Vector2){screenX, screenY},
+                                  camera->camera);
+    hitInstance = RaycastSceneInstances(ray, FLT_MAX, &collision, &hitMesh,
+                                        &hitTriangle);
+  }
+
+  WriteCollisionBuffer(collision, outBuffer);
+  outBuffer[8] = (float)hitMesh;
+  outBuffer[9] = (float)hitTriangle;
+  return hitInstance;
+}
+
+// Same as PickSceneInstanceBySlot at the current mouse position
+EXPORT int PickSceneInstanceAtMouse(int cameraSlot, float *outBuffer) {
+  Vector2 mouse = GetMousePosition();
+  return PickSceneInstanceBySlot(cameraSlot, mouse.x, mouse.y, outBuffer);
+}
+
+// ============================================================================
+// ANIMATION FUNCTIONS (integrated into model wrapper)
+// ============================================================================
+
+// Animation storage with metadata
+typedef struct {
+  ModelAnimation *animations; // Array of animations from file
+  int animCount;              // Number of animations loaded
+  CompressedAnimation **compressed; // Per animation, NULL while stored raw
+} AnimationSlot;
+
+static HandleTable animationSlots = HANDLE_TABLE_INIT(AnimationSlot);
+
+// Live animation slot for a handle, NULL when invalid or unloaded
+static AnimationSlot *GetAnimationSlot(int animSlot) {
+  return HandleTableGet(&animationSlots, animSlot);
+}
+
+// Clips stored with the model's binary cache file, NULL if there are none
+static ModelAnimation *LoadModelAnimationsFromBinaryCache(
+    const char *fileName, unsigned int *outCount) {
+  char path[256];
+  char cachePath[300];
+  GetCanonicalModelPath(fileName, path, sizeof(path));
+  if (!modelBinaryCacheEnabled ||
+      !GetModelCacheFilePath(path, cachePath, sizeof(cachePath))) {
+    return NULL;
+  }
+  int count = 0;
+  ModelAnimation *animations = LoadModelCacheAnimations(cachePath, path, &count);
+  *outCount = (unsigned int)count;
+  return animations;
+}
+
+// Load model animations and return slot index
+EXPORT int LoadModelAnimationsToSlot(const char *fileName, int *outAnimCount) {
+  unsigned int animCount = 0;
+  ModelAnimation *animations = LoadModelAnimationsFromBinaryCache(
+      fileName, &animCount);
+  if (animations == NULL) {
+    animations = LoadModelAnimations(fileName, &animCount);
+  }
+
+  // Check if animations loaded successfully
+  if (animations == NULL || animCount == 0) {
+    *outAnimCount = 0;
+    return -1; // Failed to load
+  }
+
+  int slotIndex = HandleTableAlloc(&animationSlots);
+  if (slotIndex == -1) {
+    UnloadModelAnimations(animations, animCount);
+    *outAnimCount = 0;
+    return -1; // Out of memory
+  }
+
+  AnimationSlot *anims = GetAnimationSlot(slotIndex);
+  anims->animations = animations;
+  anims->animCount = (int)animCount;
+
+  *outAnimCount = (int)animCount;
+  return slotIndex;
+}
+
+// Animation from slot and index, NULL if either is invalid
+static ModelAnimation *GetAnimationFromSlot(int animSlot, int animIndex) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  if (!anims) {
+    return NULL;
+  }
+  if (animIndex < 0 || animIndex >= anims->animCount) {
+    return NULL;
+  }
+  return &anims->animations[animIndex];
+}
+
+static int ClampAnimationFrame(const ModelAnimation *anim, int frame) {
+  if (frame >= anim->frameCount)
+    frame = anim->frameCount - 1;
+  if (frame < 0)
+    frame = 0;
+  return frame;
+}
+
+static Transform *animationFramePose = NULL; // Scratch for compressed clips
+static int animationFramePoseCapacity = 0;
+
+// Animation raylib's bone functions can read for one frame: the animation
+// itself when stored raw, otherwise a one-frame view decompressed into
+// scratch. *frame is set to the frame to pass along with the view.
+static ModelAnimation GetAnimationFrameView(int animSlot, int animIndex,
+                                            int *frame) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  ModelAnimation view = anims->animations[animIndex];
+  CompressedAnimation *compressed =
+      anims->compressed != NULL ? anims->compressed[animIndex] : NULL;
+  if (compressed == NULL) {
+    return view;
+  }
+
+  if (view.boneCount > animationFramePoseCapacity) {
+    Transform *pose = (Transform *)realloc(
+        animationFramePose, (size_t)view.boneCount * sizeof(Transform));
+    if (pose == NULL) {
+      view.frameCount = 0; // raylib skips animations without frames
+      return view;
+    }
+    animationFramePose = pose;
+    animationFramePoseCapacity = view.boneCount;
+  }
+  SampleCompressedAnimation(compressed, (float)*frame, animationFramePose);
+  view.frameCount = 1;
+  view.framePoses = &animationFramePose;
+  *frame = 0;
+  return view;
+}
+
+// Set the model's bone matrices to an animation frame
+static void EvaluateAnimationBones(Model model, int animSlot, int animIndex,
+                                   int frame) {
+  ModelAnimation view = GetAnimationFrameView(animSlot, animIndex, &frame);
+  UpdateModelAnimationBones(model, view, frame);
+}
+
+// ----------------------------------------------------------------------------
+// Native CPU skinning: bone palette built once per update, vertices skinned
+// with the SSE kernel across the job pool, buffers re-uploaded only when the
+// pose actually changed.
+// ----------------------------------------------------------------------------
+
+#define SKIN_VERTICES_PER_JOB 1024
+
+static bool nativeSkinningEnabled = true;
+static SkinPalette skinPalette = {0}; // Scratch, reused by every model
+
+// True if the slot's buffers already hold this pose
+static bool IsSkinnedPoseCurrent(const ModelSlot *slot, const Matrix *bones,
+                                 int boneCount) {
+  return slot->skinnedPose != NULL && slot->skinnedBoneCount == boneCount &&
+         memcmp(slot->skinnedPose, bones, (size_t)boneCount * sizeof(Matrix)) ==
+             0;
+}
+
+// Remember the pose so an unchanged frame costs one memcmp
+static void StoreSkinnedPose(ModelSlot *slot, const Matrix *bones,
+                             int boneCount) {
+  size_t poseSize = (size_t)boneCount * sizeof(Matrix);
+  if (slot->skinnedBoneCount != boneCount) {
+    Matrix *pose = (Matrix *)realloc(slot->skinnedPose, poseSize);
+    if (pose == NULL) {
+      free(slot->skinnedPose);
+      slot->skinnedPose = NULL;
+      slot->skinnedBoneCount = 0;
+      return;
+    }
+    slot->skinnedPose = pose;
+    slot->skinnedBoneCount = boneCount;
+  }
+  memcpy(slot->skinnedPose, bones, poseSize);
 }
 
-EXPORT float GetModelBoundingBoxMaxZBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
-    return 0.0f;
+// Skin and upload every mesh with bone data
+static void SkinModelMeshes(ModelSlot *slot, const SkinPalette *palette) {
+  Model *model = &slot->model;
+  for (int m = 0; m < model->meshCount; m++) {
+    Mesh *mesh = &model->meshes[m];
+    if (mesh->boneIds == NULL || mesh->boneWeights == NULL ||
+        mesh->animVertices == NULL) {
+      continue;
+    }
+
+    bool skinNormals = mesh->normals != NULL && mesh->animNormals != NULL;
+    SkinJob job = {palette,
+                   mesh->vertices,
+                   skinNormals ? mesh->normals : NULL,
+                   mesh->boneIds,
+                   mesh->boneWeights,
+                   mesh->animVertices,
+                   skinNormals ? mesh->animNormals : NULL};
+    JobPoolParallelFor(SkinVerticesRange, &job, mesh->vertexCount,
+                       SKIN_VERTICES_PER_JOB);
+
+    int bufferSize = mesh->vertexCount * 3 * (int)sizeof(float);
+    rlUpdateVertexBuffer(mesh->vboId[0], mesh->animVertices, bufferSize, 0);
+    if (skinNormals) {
+      rlUpdateVertexBuffer(mesh->vboId[2], mesh->animNormals, bufferSize, 0);
+    }
   }
-  return modelSlots[slotIndex].boundingBox.max.z;
 }
 
-// Unload model by slot index
-EXPORT void UnloadModelBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+// Skin every mesh of the slot from the bone matrices set by
+// UpdateModelAnimationBones. Unless forced, nothing is recomputed or uploaded
+// when the pose equals the one skinned last time.
+static void SkinModelSlot(ModelSlot *slot, bool force) {
+  int firstSkinned = FindSkinnedMesh(&slot->model);
+  if (firstSkinned < 0) {
     return;
   }
 
-  UnloadModel(modelSlots[slotIndex].model);
-  modelSlots[slotIndex].isLoaded = false;
-  modelSlots[slotIndex].model = (Model){0};
-  modelSlots[slotIndex].boundingBox = (BoundingBox){0};
-  memset(modelSlots[slotIndex].fileName, 0, 256);
-}
-
-// Draw model by slot index
-EXPORT void DrawModelBySlot(int slotIndex, float posX, float posY, float posZ,
-                            float scale, Color tint) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  const Matrix *bones = slot->model.meshes[firstSkinned].boneMatrices;
+  int boneCount = slot->model.meshes[firstSkinned].boneCount;
+  if (!force && IsSkinnedPoseCurrent(slot, bones, boneCount)) {
     return;
   }
-
-  Vector3 position = {posX, posY, posZ};
-  DrawModel(modelSlots[slotIndex].model, position, scale, tint);
-}
-
-// Draw model with extended parameters
-EXPORT void DrawModelExBySlot(int slotIndex, float posX, float posY, float posZ,
-                              float rotAxisX, float rotAxisY, float rotAxisZ,
-                              float rotationAngle, float scaleX, float scaleY,
-                              float scaleZ, Color tint) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  if (!BuildSkinPalette(&skinPalette, bones, boneCount)) {
     return;
   }
-
-  Vector3 position = {posX, posY, posZ};
-  Vector3 rotationAxis = {rotAxisX, rotAxisY, rotAxisZ};
-  Vector3 scale = {scaleX, scaleY, scaleZ};
-  DrawModelEx(modelSlots[slotIndex].model, position, rotationAxis,
-              rotationAngle, scale, tint);
+  SkinModelMeshes(slot, &skinPalette);
+  StoreSkinnedPose(slot, bones, boneCount);
 }
 
-// Draw model wires by slot index
-EXPORT void DrawModelWiresBySlot(int slotIndex, float posX, float posY,
-                                 float posZ, float scale, Color tint) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
-    return;
+// Copy a pose into every mesh bone matrix array of the model
+static void CopyBoneMatrices(Model *model, const Matrix *bones, int boneCount) {
+  for (int i = 0; i < model->meshCount; i++) {
+    Mesh *mesh = &model->meshes[i];
+    if (mesh->boneMatrices != NULL) {
+      int count = mesh->boneCount < boneCount ? mesh->boneCount : boneCount;
+      memcpy(mesh->boneMatrices, bones, (size_t)count * sizeof(Matrix));
+    }
   }
-
-  Vector3 position = {posX, posY, posZ};
-  DrawModelWires(modelSlots[slotIndex].model, position, scale, tint);
 }
 
-// Get number of loaded models
-EXPORT int GetLoadedModelCount() {
-  int count = 0;
-  for (int i = 0; i < MAX_MODELS; i++) {
-    if (modelSlots[i].isLoaded) {
-      count++;
+// ----------------------------------------------------------------------------
+// Pose cache: bone matrices for one (animation slot, index, frame) and bind
+// pose, plus the skinning palette built from them. Models loaded from the
+// same file share a bind pose, so a flock playing the same clip frame
+// evaluates bones and builds the palette once.
+// ----------------------------------------------------------------------------
+
+#define POSE_CACHE_SIZE 256
+#define POSE_CACHE_PROBE 8 // Buckets searched before evicting the oldest
+
+typedef struct {
+  bool isValid;
+  int animSlot;
+  int animIndex;
+  int frame;
+  uint64_t bindPoseHash;
+  Matrix *bones;
+  int boneCount;
+  int boneCapacity;
+  SkinPalette palette; // Built on first CPU skin of this pose
+  bool paletteReady;
+  unsigned int lastUsed;
+} PoseCacheEntry;
+
+static PoseCacheEntry poseCache[POSE_CACHE_SIZE] = {0};
+static bool poseCacheEnabled = true;
+static unsigned int poseCacheClock = 0;
+static int poseCacheHits = 0;
+static int poseCacheMisses = 0;
+
+// FNV-1a over the bind pose transforms
+static uint64_t GetBindPoseHash(ModelSlot *slot) {
+  if (slot->bindPoseHash == 0) {
+    uint64_t hash = 14695981039346656037ULL;
+    const unsigned char *bytes = (const unsigned char *)slot->model.bindPose;
+    size_t size = bytes != NULL
+                      ? (size_t)slot->model.boneCount * sizeof(Transform)
+                      : 0;
+    for (size_t i = 0; i < size; i++) {
+      hash = (hash ^ bytes[i]) * 1099511628211ULL;
     }
+    hash = (hash ^ (uint64_t)slot->model.boneCount) * 1099511628211ULL;
+    slot->bindPoseHash = hash != 0 ? hash : 1;
   }
-  return count;
+  return slot->bindPoseHash;
 }
 
-// Unload all models
-EXPORT void UnloadAllModels() {
-  for (int i = 0; i < MAX_MODELS; i++) {
-    if (modelSlots[i].isLoaded) {
-      UnloadModelBySlot(i);
+// Set the model's bone matrices to an animation frame. The model must have a
+// skinned mesh. Returns the cache entry holding the pose, or NULL when the
+// cache is disabled or out of memory (the bones are set either way).
+static PoseCacheEntry *PoseModel(ModelSlot *slot, int animSlot, int animIndex,
+                                 int frame) {
+  if (!poseCacheEnabled) {
+    EvaluateAnimationBones(slot->model, animSlot, animIndex, frame);
+    return NULL;
+  }
+
+  uint64_t bindPoseHash = GetBindPoseHash(slot);
+  uint64_t key = bindPoseHash ^ ((uint64_t)animSlot * 73856093u) ^
+                 ((uint64_t)animIndex * 19349663u) ^
+                 ((uint64_t)frame * 83492791u);
+  int start = (int)(key % POSE_CACHE_SIZE);
+
+  PoseCacheEntry *victim = NULL;
+  for (int i = 0; i < POSE_CACHE_PROBE; i++) {
+    PoseCacheEntry *entry = &poseCache[(start + i) % POSE_CACHE_SIZE];
+    if (entry->isValid && entry->animSlot == animSlot &&
+        entry->animIndex == animIndex && entry->frame == frame &&
+        entry->bindPoseHash == bindPoseHash) {
+      poseCacheHits++;
+      entry->lastUsed = ++poseCacheClock;
+      CopyBoneMatrices(&slot->model, entry->bones, entry->boneCount);
+      return entry;
+    }
+    // Prefer a free bucket, then the least recently used one
+    if (victim == NULL || (victim->isValid && !entry->isValid) ||
+        (victim->isValid && entry->lastUsed < victim->lastUsed)) {
+      victim = entry;
     }
   }
-}
 
-// Check if model slot is valid and loaded
-EXPORT bool IsModelSlotValid(int slotIndex) {
-  return (slotIndex >= 0 && slotIndex < MAX_MODELS &&
-          modelSlots[slotIndex].isLoaded);
-}
+  poseCacheMisses++;
+  EvaluateAnimationBones(slot->model, animSlot, animIndex, frame);
+  const Mesh *skinned = &slot->model.meshes[FindSkinnedMesh(&slot->model)];
 
-// Get pointer to Model from slot (for animation system)
-EXPORT Model *GetModelPointerFromSlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
-    return NULL;
+  if (skinned->boneCount > victim->boneCapacity) {
+    Matrix *bones = (Matrix *)realloc(
+        victim->bones, (size_t)skinned->boneCount * sizeof(Matrix));
+    if (bones == NULL) {
+      victim->isValid = false;
+      return NULL;
+    }
+    victim->bones = bones;
+    victim->boneCapacity = skinned->boneCount;
   }
-  return &modelSlots[slotIndex].model;
+  memcpy(victim->bones, skinned->boneMatrices,
+         (size_t)skinned->boneCount * sizeof(Matrix));
+  victim->boneCount = skinned->boneCount;
+  victim->animSlot = animSlot;
+  victim->animIndex = animIndex;
+  victim->frame = frame;
+  victim->bindPoseHash = bindPoseHash;
+  victim->paletteReady = false;
+  victim->lastUsed = ++poseCacheClock;
+  victim->isValid = true;
+  return victim;
 }
 
-// Optimized: Get model data in one call (slotIndex, meshCount, materialCount)
-EXPORT void GetModelDataBySlot(int slotIndex, int *outBuffer) {
-  // Initialize output buffer
-  outBuffer[0] = -1; // slotIndex (invalid by default)
-  outBuffer[1] = 0;  // meshCount
-  outBuffer[2] = 0;  // materialCount
+// Skin a model posed by PoseModel, sharing the palette of its cache entry
+static void SkinPosedModel(ModelSlot *slot, PoseCacheEntry *entry) {
+  const Mesh *skinned = &slot->model.meshes[FindSkinnedMesh(&slot->model)];
+  if (IsSkinnedPoseCurrent(slot, skinned->boneMatrices, skinned->boneCount)) {
+    return;
+  }
 
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+  const SkinPalette *palette = &skinPalette;
+  if (entry != NULL) {
+    if (!entry->paletteReady) {
+      if (!BuildSkinPalette(&entry->palette, entry->bones, entry->boneCount)) {
+        return;
+      }
+      entry->paletteReady = true;
+    }
+    palette = &entry->palette;
+  } else if (!BuildSkinPalette(&skinPalette, skinned->boneMatrices,
+                               skinned->boneCount)) {
     return;
   }
 
-  outBuffer[0] = slotIndex;
-  outBuffer[1] = modelSlots[slotIndex].model.meshCount;
-  outBuffer[2] = modelSlots[slotIndex].model.materialCount;
+  SkinModelMeshes(slot, palette);
+  StoreSkinnedPose(slot, skinned->boneMatrices, skinned->boneCount);
 }
 
-// Optimized: Get bounding box in one call (min.x, min.y, min.z, max.x, max.y,
-// max.z)
-EXPORT void GetModelBoundingBoxBySlot(int slotIndex, float *outBuffer) {
-  // Initialize output buffer
-  outBuffer[0] = 0.0f; // min.x
-  outBuffer[1] = 0.0f; // min.y
-  outBuffer[2] = 0.0f; // min.z
-  outBuffer[3] = 0.0f; // max.x
-  outBuffer[4] = 0.0f; // max.y
-  outBuffer[5] = 0.0f; // max.z
+// Drop cached poses of an animation slot (on unload)
+static void InvalidatePoseCache(int animSlot) {
+  for (int i = 0; i < POSE_CACHE_SIZE; i++) {
+    if (poseCache[i].animSlot == animSlot) {
+      poseCache[i].isValid = false;
+    }
+  }
+}
 
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
-    return;
+EXPORT void SetPoseCacheEnabled(bool enabled) { poseCacheEnabled = enabled; }
+
+// Free every cached pose
+EXPORT void ClearPoseCache() {
+  for (int i = 0; i < POSE_CACHE_SIZE; i++) {
+    free(poseCache[i].bones);
+    UnloadSkinPalette(&poseCache[i].palette);
+    poseCache[i] = (PoseCacheEntry){0};
   }
+}
 
-  BoundingBox bbox = modelSlots[slotIndex].boundingBox;
-  outBuffer[0] = bbox.min.x;
-  outBuffer[1] = bbox.min.y;
-  outBuffer[2] = bbox.min.z;
-  outBuffer[3] = bbox.max.x;
-  outBuffer[4] = bbox.max.y;
-  outBuffer[5] = bbox.max.z;
+// Pose cache counters since the last reset: [hits, misses, cached poses]
+EXPORT void GetPoseCacheStats(int *outBuffer, bool reset) {
+  int entries = 0;
+  for (int i = 0; i < POSE_CACHE_SIZE; i++) {
+    if (poseCache[i].isValid) {
+      entries++;
+    }
+  }
+  outBuffer[0] = poseCacheHits;
+  outBuffer[1] = poseCacheMisses;
+  outBuffer[2] = entries;
+  if (reset) {
+    poseCacheHits = 0;
+    poseCacheMisses = 0;
+  }
 }
 
-// Get ray collision with model mesh
-EXPORT void GetRayCollisionModelMesh(Ray *ray, int slotIndex, int meshIndex,
-                                     Matrix *transform, float *outBuffer) {
-  // Initialize output buffer as no hit
-  outBuffer[0] = 0.0f; // hit
-  outBuffer[1] = 0.0f; // distance
-  outBuffer[2] = 0.0f; // point.x
-  outBuffer[3] = 0.0f; // point.y
-  outBuffer[4] = 0.0f; // point.z
-  outBuffer[5] = 0.0f; // normal.x
-  outBuffer[6] = 0.0f; // normal.y
-  outBuffer[7] = 0.0f; // normal.z
+// Switch between native skinning (default) and raylib's UpdateModelAnimation
+EXPORT void SetNativeSkinningEnabled(bool enabled) {
+  nativeSkinningEnabled = enabled;
+}
 
-  // Validate slot and mesh index
-  if (slotIndex < 0 || slotIndex >= MAX_MODELS ||
-      !modelSlots[slotIndex].isLoaded) {
+// Worker threads used for skinning, in addition to the calling thread
+EXPORT int GetSkinningThreadCount() { return JobPoolThreadCount(); }
+
+// Update model animation (CPU skinning)
+EXPORT void UpdateModelAnimationBySlot(int modelSlotIndex, int animSlot,
+                                       int animIndex, int frame) {
+  // Get model pointer
+  Model *model = GetModelPointerFromSlot(modelSlotIndex);
+  if (model == NULL) {
     return;
   }
 
-  Model *model = &modelSlots[slotIndex].model;
-  if (meshIndex < 0 || meshIndex >= model->meshCount) {
+  ModelAnimation *anim = GetAnimationFromSlot(animSlot, animIndex);
+  if (anim == NULL) {
+    return;
+  }
+  int clampedFrame = ClampAnimationFrame(anim, frame);
+
+  ModelSlot *slot = GetModelSlot(modelSlotIndex);
+  if (!nativeSkinningEnabled) {
+    ModelAnimation view =
+        GetAnimationFrameView(animSlot, animIndex, &clampedFrame);
+    UpdateModelAnimation(*model, view, clampedFrame);
+    slot->skinnedBoneCount = 0; // Buffers no longer match the cached pose
+    free(slot->skinnedPose);
+    slot->skinnedPose = NULL;
     return;
   }
 
-  // Get the mesh
-  Mesh mesh = model->meshes[meshIndex];
-
-  // Use Raylib's built-in function
-  Matrix finalTransform = transform ? *transform : MatrixIdentity();
-  RayCollision collision = GetRayCollisionMesh(*ray, mesh, finalTransform);
-
-  // Write collision data to output buffer
-  outBuffer[0] = collision.hit ? 1.0f : 0.0f;
-  outBuffer[1] = collision.distance;
-  outBuffer[2] = collision.point.x;
-  outBuffer[3] = collision.point.y;
-  outBuffer[4] = collision.point.z;
-  outBuffer[5] = collision.normal.x;
-  outBuffer[6] = collision.normal.y;
-  outBuffer[7] = collision.normal.z;
+  if (FindSkinnedMesh(model) < 0) {
+    return; // Nothing to skin, raylib would index meshes[-1]
+  }
+  PoseCacheEntry *pose = PoseModel(slot, animSlot, animIndex, clampedFrame);
+  SkinPosedModel(slot, pose);
 }
 
-// ============================================================================
-// ANIMATION FUNCTIONS (integrated into model wrapper)
-// ============================================================================
+// ----------------------------------------------------------------------------
+// Batched animation updates
+// ----------------------------------------------------------------------------
 
-#define MAX_ANIMATIONS 32
+// Floats per entry passed to UpdateAnimationsBatch:
+// model slot, animation slot, animation index, frame
+#define ANIMATION_BATCH_STRIDE 4
 
-// Animation storage with metadata
 typedef struct {
-  ModelAnimation *animations; // Array of animations from file
-  int animCount;              // Number of animations loaded
-  bool isValid;               // Slot validity flag
-} AnimationSlot;
+  int modelSlot;
+  int animSlot;
+  int animIndex;
+  int frame;
+} AnimationBatchEntry;
+
+static AnimationBatchEntry *animationBatch = NULL; // Scratch, grown on demand
+static int animationBatchCapacity = 0;
+static int *batchLastEntry = NULL; // Scratch, one entry per model slot index
+static int batchLastEntryCapacity = 0;
+
+// Order by animation and frame so identical poses end up next to each other
+static int CompareAnimationBatchEntries(const void *a, const void *b) {
+  const AnimationBatchEntry *x = (const AnimationBatchEntry *)a;
+  const AnimationBatchEntry *y = (const AnimationBatchEntry *)b;
+  if (x->animSlot != y->animSlot) {
+    return x->animSlot - y->animSlot;
+  }
+  if (x->animIndex != y->animIndex) {
+    return x->animIndex - y->animIndex;
+  }
+  if (x->frame != y->frame) {
+    return x->frame - y->frame;
+  }
+  return x->modelSlot - y->modelSlot;
+}
 
-static AnimationSlot animationSlots[MAX_ANIMATIONS] = {0};
+// Update many animated models in one call. Entries with the same animation
+// and frame share one bone evaluation and one skinning palette through the
+// pose cache; models whose pose did not change are not re-skinned. If a model slot appears more than
+// once the last entry wins. Returns the number of entries applied.
+EXPORT int UpdateAnimationsBatch(float *entries, int count) {
+  if (entries == NULL || count <= 0) {
+    return 0;
+  }
+  if (count > animationBatchCapacity) {
+    AnimationBatchEntry *grown = (AnimationBatchEntry *)realloc(
+        animationBatch, (size_t)count * sizeof(AnimationBatchEntry));
+    if (grown == NULL) {
+      return 0;
+    }
+    animationBatch = grown;
+    animationBatchCapacity = count;
+  }
 
-// Find free slot for new animation
-int FindFreeAnimationSlot() {
-  for (int i = 0; i < MAX_ANIMATIONS; i++) {
-    if (!animationSlots[i].isValid) {
-      return i;
+  // Last entry per model, indexed by slot table index
+  int slotCapacity = HandleTableCapacity(&modelSlots);
+  if (slotCapacity > batchLastEntryCapacity) {
+    int *grown = (int *)realloc(batchLastEntry, slotCapacity * sizeof(int));
+    if (grown == NULL) {
+      return 0;
+    }
+    batchLastEntry = grown;
+    batchLastEntryCapacity = slotCapacity;
+  }
+  for (int i = 0; i < slotCapacity; i++) {
+    batchLastEntry[i] = -1;
+  }
+  for (int i = 0; i < count; i++) {
+    int modelSlot = (int)entries[i * ANIMATION_BATCH_STRIDE];
+    if (GetModelSlot(modelSlot) != NULL) {
+      batchLastEntry[HandleTableIndex(modelSlot)] = i;
+    }
+  }
+
+  int applied = 0;
+  int batchCount = 0;
+  for (int i = 0; i < count; i++) {
+    const float *e = &entries[i * ANIMATION_BATCH_STRIDE];
+    int modelSlot = (int)e[0];
+    ModelSlot *slot = GetModelSlot(modelSlot);
+    if (slot == NULL || batchLastEntry[HandleTableIndex(modelSlot)] != i) {
+      continue;
     }
+    ModelAnimation *anim = GetAnimationFromSlot((int)e[1], (int)e[2]);
+    if (anim == NULL) {
+      continue;
+    }
+    if (!nativeSkinningEnabled) {
+      UpdateModelAnimationBySlot(modelSlot, (int)e[1], (int)e[2],
+                                 (int)floorf(e[3]));
+      applied++;
+      continue;
+    }
+    if (FindSkinnedMesh(&slot->model) < 0) {
+      continue;
+    }
+    animationBatch[batchCount++] = (AnimationBatchEntry){
+        modelSlot, (int)e[1], (int)e[2],
+        ClampAnimationFrame(anim, (int)floorf(e[3]))};
+  }
+
+  qsort(animationBatch, batchCount, sizeof(AnimationBatchEntry),
+        CompareAnimationBatchEntries);
+
+  // Sorted entries hit the pose cache back to back
+  for (int i = 0; i < batchCount; i++) {
+    const AnimationBatchEntry *entry = &animationBatch[i];
+    ModelSlot *slot = GetModelSlot(entry->modelSlot);
+    PoseCacheEntry *pose =
+        PoseModel(slot, entry->animSlot, entry->animIndex, entry->frame);
+    SkinPosedModel(slot, pose);
+    applied++;
   }
-  return -1; // No free slots
+
+  return applied;
 }
 
-// Load model animations and return slot index
-EXPORT int LoadModelAnimationsToSlot(const char *fileName, int *outAnimCount) {
-  int slotIndex = FindFreeAnimationSlot();
-  if (slotIndex == -1) {
-    *outAnimCount = 0;
-    return -1; // No free slots
+// Time raylib's UpdateModelAnimation against native skinning on the same frame
+// and compare the skinned positions. outResults: [raylibMs, nativeMs,
+// maxError, workerThreads]. Leaves the model in the skinned pose.
+EXPORT bool BenchmarkModelSkinning(int modelSlotIndex, int animSlot,
+                                   int animIndex, int frame,
+                                   float *outResults) {
+  outResults[0] = 0.0f;
+  outResults[1] = 0.0f;
+  outResults[2] = 0.0f;
+  outResults[3] = 0.0f;
+
+  Model *model = GetModelPointerFromSlot(modelSlotIndex);
+  ModelAnimation *anim = GetAnimationFromSlot(animSlot, animIndex);
+  if (model == NULL || anim == NULL || FindSkinnedMesh(model) < 0) {
+    return false;
   }
+  int clampedFrame = ClampAnimationFrame(anim, frame);
 
-  unsigned int animCount = 0;
-  ModelAnimation *animations = LoadModelAnimations(fileName, &animCount);
+  int totalFloats = 0;
+  for (int m = 0; m < model->meshCount; m++) {
+    if (model->meshes[m].animVertices != NULL) {
+      totalFloats += model->meshes[m].vertexCount * 3;
+    }
+  }
+  float *reference = (float *)malloc((size_t)totalFloats * sizeof(float));
+  if (reference == NULL) {
+    return false;
+  }
 
-  // Check if animations loaded successfully
-  if (animations == NULL || animCount == 0) {
-    *outAnimCount = 0;
-    return -1; // Failed to load
+  int viewFrame = clampedFrame;
+  ModelAnimation view = GetAnimationFrameView(animSlot, animIndex, &viewFrame);
+  double start = GetTime();
+  UpdateModelAnimation(*model, view, viewFrame);
+  double raylibMs = (GetTime() - start) * 1000.0;
+
+  int offset = 0;
+  for (int m = 0; m < model->meshCount; m++) {
+    Mesh *mesh = &model->meshes[m];
+    if (mesh->animVertices != NULL) {
+      memcpy(reference + offset, mesh->animVertices,
+             (size_t)mesh->vertexCount * 3 * sizeof(float));
+      offset += mesh->vertexCount * 3;
+    }
   }
 
-  animationSlots[slotIndex].animations = animations;
-  animationSlots[slotIndex].animCount = (int)animCount;
-  animationSlots[slotIndex].isValid = true;
+  start = GetTime();
+  UpdateModelAnimationBones(*model, view, viewFrame);
+  SkinModelSlot(GetModelSlot(modelSlotIndex), true);
+  double nativeMs = (GetTime() - start) * 1000.0;
+
+  float maxError = 0.0f;
+  offset = 0;
+  for (int m = 0; m < model->meshCount; m++) {
+    Mesh *mesh = &model->meshes[m];
+    if (mesh->animVertices == NULL) {
+      continue;
+    }
+    for (int i = 0; i < mesh->vertexCount * 3; i++) {
+      float error = fabsf(mesh->animVertices[i] - reference[offset + i]);
+      if (error > maxError) {
+        maxError = error;
+      }
+    }
+    offset += mesh->vertexCount * 3;
+  }
+  free(reference);
 
-  *outAnimCount = (int)animCount;
-  return slotIndex;
+  outResults[0] = (float)raylibMs;
+  outResults[1] = (float)nativeMs;
+  outResults[2] = maxError;
+  outResults[3] = (float)JobPoolThreadCount();
+  return true;
 }
 
-// Update model animation (CPU skinning)
-EXPORT void UpdateModelAnimationBySlot(int modelSlotIndex, int animSlot,
-                                       int animIndex, int frame) {
+// Update model animation bones (GPU skinning)
+EXPORT void UpdateModelAnimationBonesBySlot(int modelSlotIndex, int animSlot,
+                                            int animIndex, int frame) {
   // Get model pointer
   Model *model = GetModelPointerFromSlot(modelSlotIndex);
   if (model == NULL) {
@@ -368,17 +2741,17 @@ EXPORT void UpdateModelAnimationBySlot(int modelSlotIndex, int animSlot,
   }
 
   // Validate animation slot
-  if (animSlot < 0 || animSlot >= MAX_ANIMATIONS ||
-      !animationSlots[animSlot].isValid) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  if (!anims) {
     return;
   }
 
   // Validate animation index
-  if (animIndex < 0 || animIndex >= animationSlots[animSlot].animCount) {
+  if (animIndex < 0 || animIndex >= anims->animCount) {
     return;
   }
 
-  ModelAnimation *anim = &animationSlots[animSlot].animations[animIndex];
+  ModelAnimation *anim = &anims->animations[animIndex];
 
   // Clamp frame to valid range
   int clampedFrame = frame;
@@ -387,41 +2760,288 @@ EXPORT void UpdateModelAnimationBySlot(int modelSlotIndex, int animSlot,
   if (clampedFrame >= anim->frameCount)
     clampedFrame = anim->frameCount - 1;
 
-  // Update the model animation
-  UpdateModelAnimation(*model, *anim, clampedFrame);
+  // Update the model animation bones, shared with other instances on the
+  // same frame through the pose cache
+  if (FindSkinnedMesh(model) < 0) {
+    return;
+  }
+  PoseModel(GetModelSlot(modelSlotIndex), animSlot, animIndex, clampedFrame);
+}
+
+// ----------------------------------------------------------------------------
+// Bone palette export: the whole current pose in one call, for attaching
+// weapons, emitters or cameras to bones or for custom skinning shaders.
+// ----------------------------------------------------------------------------
+
+#define BONE_PALETTE_MODEL 0    // Bone transforms, model.transform applied
+#define BONE_PALETTE_SKINNING 1 // Skinning matrices (bind pose removed)
+
+// Bind pose transform of a bone as a matrix, composed like raylib does
+static Matrix BindPoseMatrix(Transform bind) {
+  return MatrixMultiply(MatrixMultiply(MatrixScale(bind.scale.x, bind.scale.y,
+                                                   bind.scale.z),
+                                       QuaternionToMatrix(bind.rotation)),
+                        MatrixTranslate(bind.translation.x,
+                                        bind.translation.y,
+                                        bind.translation.z));
 }
 
-// Update model animation bones (GPU skinning)
-EXPORT void UpdateModelAnimationBonesBySlot(int modelSlotIndex, int animSlot,
-                                            int animIndex, int frame) {
-  // Get model pointer
+// Write the pose set by the last animation update (the bind pose before
+// any) as 16 floats per bone, column-major with the translation in 12-14,
+// for up to capacity bones. BONE_PALETTE_MODEL gives each bone's transform
+// in the space DrawModelEx's position, rotation and scale apply to.
+// Returns the model's bone count (0 for an invalid slot or a model without
+// a skeleton), so a call with capacity 0 sizes the buffer.
+EXPORT int GetModelBonePaletteBySlot(int slotIndex, int space,
+                                     float *outBuffer, int capacity) {
+  ModelSlot *slot = GetModelSlot(slotIndex);
+  if (!slot || slot->model.boneCount <= 0 ||
+      (space != BONE_PALETTE_MODEL && space != BONE_PALETTE_SKINNING)) {
+    return 0;
+  }
+  const Model *model = &slot->model;
+  int firstSkinned = FindSkinnedMesh(model);
+  const Matrix *bones =
+      firstSkinned >= 0 ? model->meshes[firstSkinned].boneMatrices : NULL;
+  int poseBones = firstSkinned >= 0 ? model->meshes[firstSkinned].boneCount : 0;
+
+  int count = model->boneCount < capacity ? model->boneCount : capacity;
+  for (int b = 0; b < count; b++) {
+    Matrix m = b < poseBones ? bones[b] : MatrixIdentity();
+    if (space == BONE_PALETTE_MODEL) {
+      Matrix bind = model->bindPose != NULL ? BindPoseMatrix(model->bindPose[b])
+                                            : MatrixIdentity();
+      m = MatrixMultiply(MatrixMultiply(bind, m), model->transform);
+    }
+    float *out = outBuffer + b * 16;
+    out[0] = m.m0;
+    out[1] = m.m1;
+    out[2] = m.m2;
+    out[3] = m.m3;
+    out[4] = m.m4;
+    out[5] = m.m5;
+    out[6] = m.m6;
+    out[7] = m.m7;
+    out[8] = m.m8;
+    out[9] = m.m9;
+    out[10] = m.m10;
+    out[11] = m.m11;
+    out[12] = m.m12;
+    out[13] = m.m13;
+    out[14] = m.m14;
+    out[15] = m.m15;
+  }
+  return model->boneCount;
+}
+
+// ----------------------------------------------------------------------------
+// Fractional frames and blending: each layer samples its clip between the two
+// neighbouring frames (wrapping to frame 0 when looping), layers are mixed by
+// weight (nlerp for rotations) and bones are evaluated once from the blended
+// local pose. Clips stored at 15-30 Hz stay smooth at any render rate.
+// ----------------------------------------------------------------------------
+
+// Floats per layer passed to UpdateModelAnimationBlendBySlot:
+// animation slot, animation index, frame, weight, loop (0 or 1)
+#define ANIMATION_LAYER_STRIDE 5
+
+static Transform *blendPose = NULL;   // Weighted sum of the layer poses
+static Transform *blendSample = NULL; // One decompressed frame
+static int blendCapacity = 0;
+
+// Frames either side of a fractional frame and the blend factor between them
+static void GetAnimationSegment(const ModelAnimation *anim, float frame,
+                                bool loop, int *outFrame0, int *outFrame1,
+                                float *outT) {
+  int last = anim->frameCount - 1;
+  if (loop) {
+    frame = fmodf(frame, (float)anim->frameCount);
+    if (frame < 0.0f)
+      frame += (float)anim->frameCount;
+  } else {
+    if (frame < 0.0f)
+      frame = 0.0f;
+    if (frame > (float)last)
+      frame = (float)last;
+  }
+
+  int frame0 = (int)floorf(frame);
+  if (frame0 > last)
+    frame0 = last; // fmodf rounding
+  int frame1 = frame0 + 1;
+  if (frame1 > last)
+    frame1 = loop ? 0 : last;
+  *outFrame0 = frame0;
+  *outFrame1 = frame1;
+  *outT = frame1 != frame0 ? frame - (float)frame0 : 0.0f;
+}
+
+// Local pose of one whole frame, decompressed into blendSample when needed
+static const Transform *GetAnimationFramePose(int animSlot, int animIndex,
+                                              int frame) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  CompressedAnimation *compressed =
+      anims->compressed != NULL ? anims->compressed[animIndex] : NULL;
+  if (compressed == NULL) {
+    return anims->animations[animIndex].framePoses[frame];
+  }
+  SampleCompressedAnimation(compressed, (float)frame, blendSample);
+  return blendSample;
+}
+
+// Add a weighted pose to blendPose, rotations on the hemisphere of the sum
+static void AccumulatePose(const Transform *pose, int boneCount,
+                           float weight) {
+  for (int b = 0; b < boneCount; b++) {
+    Transform *sum = &blendPose[b];
+    Quaternion q = pose[b].rotation;
+    float dot = sum->rotation.x * q.x + sum->rotation.y * q.y +
+                sum->rotation.z * q.z + sum->rotation.w * q.w;
+    float rotationWeight = dot < 0.0f ? -weight : weight;
+    sum->translation = Vector3Add(sum->translation,
+                                  Vector3Scale(pose[b].translation, weight));
+    sum->rotation.x += q.x * rotationWeight;
+    sum->rotation.y += q.y * rotationWeight;
+    sum->rotation.z += q.z * rotationWeight;
+    sum->rotation.w += q.w * rotationWeight;
+    sum->scale = Vector3Add(sum->scale, Vector3Scale(pose[b].scale, weight));
+  }
+}
+
+// Mix the layers into blendPose and return a one-frame animation over it.
+// Layers with an invalid animation, no weight or a bone count different
+// from the first usable layer are skipped. False if none is usable.
+static bool BlendAnimationLayers(const float *layers, int layerCount,
+                                 ModelAnimation *outView) {
+  const ModelAnimation *first = NULL;
+  float totalWeight = 0.0f;
+
+  for (int i = 0; i < layerCount; i++) {
+    const float *layer = &layers[i * ANIMATION_LAYER_STRIDE];
+    int animSlot = (int)layer[0];
+    int animIndex = (int)layer[1];
+    float weight = layer[3];
+    const ModelAnimation *anim = GetAnimationFromSlot(animSlot, animIndex);
+    if (anim == NULL || !(weight > 0.0f) || !isfinite(layer[2]) ||
+        (first != NULL && anim->boneCount != first->boneCount)) {
+      continue;
+    }
+
+    if (first == NULL) {
+      first = anim;
+      if (anim->boneCount > blendCapacity) {
+        size_t size = (size_t)anim->boneCount * sizeof(Transform);
+        Transform *pose = (Transform *)realloc(blendPose, size);
+        if (pose != NULL)
+          blendPose = pose;
+        Transform *sample = (Transform *)realloc(blendSample, size);
+        if (sample != NULL)
+          blendSample = sample;
+        if (pose == NULL || sample == NULL) {
+          return false;
+        }
+        blendCapacity = anim->boneCount;
+      }
+      memset(blendPose, 0, (size_t)anim->boneCount * sizeof(Transform));
+    }
+
+    int frame0, frame1;
+    float t;
+    GetAnimationSegment(anim, layer[2], layer[4] != 0.0f, &frame0, &frame1,
+                        &t);
+    AccumulatePose(GetAnimationFramePose(animSlot, animIndex, frame0),
+                   anim->boneCount, weight * (1.0f - t));
+    if (t > 0.0f) {
+      AccumulatePose(GetAnimationFramePose(animSlot, animIndex, frame1),
+                     anim->boneCount, weight * t);
+    }
+    totalWeight += weight;
+  }
+
+  if (first == NULL) {
+    return false;
+  }
+
+  float inv = 1.0f / totalWeight;
+  for (int b = 0; b < first->boneCount; b++) {
+    blendPose[b].translation = Vector3Scale(blendPose[b].translation, inv);
+    blendPose[b].rotation = QuaternionNormalize(blendPose[b].rotation);
+    blendPose[b].scale = Vector3Scale(blendPose[b].scale, inv);
+  }
+
+  *outView = *first;
+  outView->frameCount = 1;
+  outView->framePoses = &blendPose;
+  return true;
+}
+
+// Pose (and with skin, CPU skin) a model from animation layers
+static bool UpdateModelAnimationLayers(int modelSlotIndex, float *layers,
+                                       int layerCount, bool skin) {
   Model *model = GetModelPointerFromSlot(modelSlotIndex);
-  if (model == NULL) {
-    return;
+  if (model == NULL || layers == NULL || layerCount <= 0) {
+    return false;
   }
 
-  // Validate animation slot
-  if (animSlot < 0 || animSlot >= MAX_ANIMATIONS ||
-      !animationSlots[animSlot].isValid) {
-    return;
+  // One layer on a whole frame is an ordinary update sharing the pose cache
+  if (layerCount == 1) {
+    const ModelAnimation *anim = GetAnimationFromSlot((int)layers[0],
+                                                      (int)layers[1]);
+    if (anim == NULL || !(layers[3] > 0.0f) || !isfinite(layers[2])) {
+      return false;
+    }
+    int frame0, frame1;
+    float t;
+    GetAnimationSegment(anim, layers[2], layers[4] != 0.0f, &frame0, &frame1,
+                        &t);
+    if (t == 0.0f) {
+      if (skin) {
+        UpdateModelAnimationBySlot(modelSlotIndex, (int)layers[0],
+                                   (int)layers[1], frame0);
+      } else {
+        UpdateModelAnimationBonesBySlot(modelSlotIndex, (int)layers[0],
+                                        (int)layers[1], frame0);
+      }
+      return true;
+    }
   }
 
-  // Validate animation index
-  if (animIndex < 0 || animIndex >= animationSlots[animSlot].animCount) {
-    return;
+  ModelAnimation view;
+  if (!BlendAnimationLayers(layers, layerCount, &view)) {
+    return false;
   }
 
-  ModelAnimation *anim = &animationSlots[animSlot].animations[animIndex];
+  ModelSlot *slot = GetModelSlot(modelSlotIndex);
+  if (skin && !nativeSkinningEnabled) {
+    UpdateModelAnimation(*model, view, 0);
+    slot->skinnedBoneCount = 0; // Buffers no longer match the cached pose
+    free(slot->skinnedPose);
+    slot->skinnedPose = NULL;
+    return true;
+  }
+  if (FindSkinnedMesh(model) < 0) {
+    return false; // Nothing to pose, raylib would index meshes[-1]
+  }
+  UpdateModelAnimationBones(*model, view, 0);
+  if (skin) {
+    SkinPosedModel(slot, NULL);
+  }
+  return true;
+}
 
-  // Clamp frame to valid range
-  int clampedFrame = frame;
-  if (clampedFrame < 0)
-    clampedFrame = 0;
-  if (clampedFrame >= anim->frameCount)
-    clampedFrame = anim->frameCount - 1;
+// CPU skin a model from ANIMATION_LAYER_STRIDE floats per layer. A single
+// layer with weight 1 samples one clip at a fractional frame; two layers with
+// weights 1-t and t crossfade. Returns false if no layer could be used.
+EXPORT bool UpdateModelAnimationBlendBySlot(int modelSlotIndex, float *layers,
+                                            int layerCount) {
+  return UpdateModelAnimationLayers(modelSlotIndex, layers, layerCount, true);
+}
 
-  // Update the model animation bones
-  UpdateModelAnimationBones(*model, *anim, clampedFrame);
+// Same as UpdateModelAnimationBlendBySlot, bone matrices only (GPU skinning)
+EXPORT bool UpdateModelAnimationBonesBlendBySlot(int modelSlotIndex,
+                                                 float *layers,
+                                                 int layerCount) {
+  return UpdateModelAnimationLayers(modelSlotIndex, layers, layerCount, false);
 }
 
 // Validate animation compatibility with model
@@ -434,17 +3054,17 @@ EXPORT bool IsModelAnimationValidBySlot(int modelSlotIndex, int animSlot,
   }
 
   // Validate animation slot
-  if (animSlot < 0 || animSlot >= MAX_ANIMATIONS ||
-      !animationSlots[animSlot].isValid) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  if (!anims) {
     return false;
   }
 
   // Validate animation index
-  if (animIndex < 0 || animIndex >= animationSlots[animSlot].animCount) {
+  if (animIndex < 0 || animIndex >= anims->animCount) {
     return false;
   }
 
-  ModelAnimation *anim = &animationSlots[animSlot].animations[animIndex];
+  ModelAnimation *anim = &anims->animations[animIndex];
 
   // Check if animation is valid for the model
   return IsModelAnimationValid(*model, *anim);
@@ -452,66 +3072,124 @@ EXPORT bool IsModelAnimationValidBySlot(int modelSlotIndex, int animSlot,
 
 // Unload animation by slot index
 EXPORT void UnloadModelAnimationBySlot(int animSlot) {
-  if (animSlot < 0 || animSlot >= MAX_ANIMATIONS ||
-      !animationSlots[animSlot].isValid) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  if (!anims) {
     return;
   }
 
+  // Compressed animations no longer own raylib frame poses: free the tracks
+  // and stop raylib from walking the released frames
+  if (anims->compressed != NULL) {
+    for (int i = 0; i < anims->animCount; i++) {
+      if (anims->compressed[i] != NULL) {
+        UnloadCompressedAnimation(anims->compressed[i]);
+        anims->animations[i].frameCount = 0;
+      }
+    }
+    free(anims->compressed);
+    anims->compressed = NULL;
+  }
+
   // Unload all animations in the array
-  if (animationSlots[animSlot].animations != NULL) {
-    UnloadModelAnimations(animationSlots[animSlot].animations,
-                          animationSlots[animSlot].animCount);
-    animationSlots[animSlot].animations = NULL;
+  if (anims->animations != NULL) {
+    UnloadModelAnimations(anims->animations, anims->animCount);
   }
 
-  animationSlots[animSlot].animCount = 0;
-  animationSlots[animSlot].isValid = false;
+  HandleTableFree(&animationSlots, animSlot);
+  InvalidatePoseCache(animSlot);
 }
 
 // Unload all animations
 EXPORT void UnloadAllAnimations() {
-  for (int i = 0; i < MAX_ANIMATIONS; i++) {
-    if (animationSlots[i].isValid) {
-      UnloadModelAnimationBySlot(i);
+  for (int i = 0; i < HandleTableCapacity(&animationSlots); i++) {
+    UnloadModelAnimationBySlot(HandleTableHandleAt(&animationSlots, i));
+  }
+}
+
+// Compress every raw animation of a slot in place (see
+// animation-compression.h). translationTolerance bounds translation and scale
+// error, rotationTolerance rotation error in radians. raylib's frame poses are
+// released for each animation that compressed. Returns the bytes now used by
+// the slot's frame data, -1 if the slot is invalid.
+EXPORT int CompressAnimationSlot(int animSlot, float translationTolerance,
+                                 float rotationTolerance) {
+  AnimationSlot *slot = GetAnimationSlot(animSlot);
+  if (!slot) {
+    return -1;
+  }
+  if (slot->compressed == NULL) {
+    slot->compressed = (CompressedAnimation **)calloc(
+        (size_t)slot->animCount, sizeof(CompressedAnimation *));
+    if (slot->compressed == NULL) {
+      return -1;
     }
   }
+  if (translationTolerance < 0.0f)
+    translationTolerance = 0.0f;
+  if (rotationTolerance < 0.0f)
+    rotationTolerance = 0.0f;
+
+  long long storedBytes = 0;
+  for (int i = 0; i < slot->animCount; i++) {
+    ModelAnimation *anim = &slot->animations[i];
+    if (slot->compressed[i] == NULL) {
+      slot->compressed[i] = CompressAnimation(anim, translationTolerance,
+                                              rotationTolerance);
+      if (slot->compressed[i] != NULL) {
+        for (int f = 0; f < anim->frameCount; f++) {
+          MemFree(anim->framePoses[f]);
+        }
+        MemFree(anim->framePoses);
+        anim->framePoses = NULL;
+      }
+    }
+    storedBytes += slot->compressed[i] != NULL
+                       ? (long long)slot->compressed[i]->storedBytes
+                       : (long long)AnimationRawBytes(anim);
+  }
+
+  // Cached poses stay valid within tolerance but would no longer match what
+  // a fresh evaluation produces
+  InvalidatePoseCache(animSlot);
+  return storedBytes > 0x7FFFFFFF ? 0x7FFFFFFF : (int)storedBytes;
 }
 
-// Get animation data by slot index (frameCount, boneCount)
+// Get animation data by slot index
+// (frameCount, boneCount, rawBytes, storedBytes)
 EXPORT void GetAnimationDataBySlot(int animSlot, int animIndex, int *outData) {
   // Initialize output buffer
   outData[0] = 0; // frameCount
   outData[1] = 0; // boneCount
+  outData[2] = 0; // Bytes of uncompressed frame poses
+  outData[3] = 0; // Bytes actually stored (equal to rawBytes unless compressed)
 
   // Validate animation slot
-  if (animSlot < 0 || animSlot >= MAX_ANIMATIONS ||
-      !animationSlots[animSlot].isValid) {
+  AnimationSlot *anims = GetAnimationSlot(animSlot);
+  if (!anims) {
     return;
   }
 
   // Validate animation index
-  if (animIndex < 0 || animIndex >= animationSlots[animSlot].animCount) {
+  if (animIndex < 0 || animIndex >= anims->animCount) {
     return;
   }
 
-  ModelAnimation *anim = &animationSlots[animSlot].animations[animIndex];
+  ModelAnimation *anim = &anims->animations[animIndex];
   outData[0] = anim->frameCount;
   outData[1] = anim->boneCount;
+  outData[2] = (int)AnimationRawBytes(anim);
+  outData[3] = outData[2];
+  if (anims->compressed != NULL && anims->compressed[animIndex] != NULL) {
+    outData[3] = (int)anims->compressed[animIndex]->storedBytes;
+  }
 }
 
 // Get number of loaded animation slots
 EXPORT int GetLoadedAnimationCount() {
-  int count = 0;
-  for (int i = 0; i < MAX_ANIMATIONS; i++) {
-    if (animationSlots[i].isValid) {
-      count++;
-    }
-  }
-  return count;
+  return HandleTableCount(&animationSlots);
 }
 
 // Check if animation slot is valid
 EXPORT bool IsAnimationSlotValid(int animSlot) {
-  return (animSlot >= 0 && animSlot < MAX_ANIMATIONS &&
-          animationSlots[animSlot].isValid);
+  return GetAnimationSlot(animSlot) != NULL;
 }
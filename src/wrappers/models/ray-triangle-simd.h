@@ -0,0 +1,370 @@
+#ifndef RAY_TRIANGLE_SIMD_H
+#define RAY_TRIANGLE_SIMD_H
+
+// Möller–Trumbore ray/triangle kernel over structure-of-arrays triangle data.
+// Each triangle is stored as v0 plus the two precomputed edges, one array per
+// component, padded with degenerate triangles to a multiple of
+// SOA_TRIANGLE_BLOCK so the SIMD loops never need a scalar tail.
+//
+// Paths: AVX (8 triangles, selected at runtime on GCC/Clang x86), SSE (4
+// triangles, baseline on x86-64), scalar otherwise. The scalar loop reads the
+// same SoA layout, which compilers can auto-vectorize on other targets.
+
+#include "raylib.h"
+#include <float.h>
+#include <stdbool.h>
+#include <stdlib.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define RT_SIMD_SSE 1
+#include <emmintrin.h>
+#endif
+
+#if RT_SIMD_SSE && (defined(__GNUC__) || defined(__clang__)) &&                \
+    (defined(__x86_64__) || defined(__i386__))
+#define RT_SIMD_AVX_DISPATCH 1 // AVX path compiled via target attribute
+#include <immintrin.h>
+#elif defined(__AVX__)
+#define RT_SIMD_AVX_STATIC 1 // AVX enabled for the whole translation unit
+#include <immintrin.h>
+#endif
+
+#define SOA_TRIANGLE_BLOCK 8
+#define RT_EPSILON 0.000001f // Same epsilon as GetRayCollisionTriangle
+
+typedef struct {
+  float *v0x, *v0y, *v0z;
+  float *e1x, *e1y, *e1z;
+  float *e2x, *e2y, *e2z;
+  int triangleCount; // Real triangles
+  int paddedCount;   // Multiple of SOA_TRIANGLE_BLOCK
+  float *storage;    // Single 32-byte aligned allocation for all arrays
+} TriangleSoA;
+
+static inline float *SoAAlignedAlloc(size_t floatCount, float **outBase) {
+  // Over-allocate and align manually, aligned_alloc is not C99
+  float *base = (float *)malloc(floatCount * sizeof(float) + 32);
+  *outBase = base;
+  if (base == NULL) {
+    return NULL;
+  }
+  size_t addr = (size_t)base;
+  return (float *)((addr + 31) & ~(size_t)31);
+}
+
+static void UnloadTriangleSoA(TriangleSoA *soa) {
+  free(soa->storage);
+  memset(soa, 0, sizeof(TriangleSoA));
+}
+
+// Precompute v0/e1/e2 per triangle. Indices may be NULL (non-indexed),
+// 16-bit (indexSize 2) or 32-bit (indexSize 4).
+static bool BuildTriangleSoA(TriangleSoA *soa, const float *vertices,
+                             int vertexCount, const void *indices,
+                             int indexSize, int triangleCount) {
+  memset(soa, 0, sizeof(TriangleSoA));
+  if (vertices == NULL || vertexCount <= 0 || triangleCount <= 0) {
+    return false;
+  }
+
+  int padded = ((triangleCount + SOA_TRIANGLE_BLOCK - 1) / SOA_TRIANGLE_BLOCK) *
+               SOA_TRIANGLE_BLOCK;
+  float *base = NULL;
+  float *data = SoAAlignedAlloc((size_t)padded * 9, &base);
+  if (data == NULL) {
+    return false;
+  }
+  memset(data, 0, sizeof(float) * (size_t)padded * 9);
+
+  soa->storage = base;
+  soa->v0x = data + padded * 0;
+  soa->v0y = data + padded * 1;
+  soa->v0z = data + padded * 2;
+  soa->e1x = data + padded * 3;
+  soa->e1y = data + padded * 4;
+  soa->e1z = data + padded * 5;
+  soa->e2x = data + padded * 6;
+  soa->e2y = data + padded * 7;
+  soa->e2z = data + padded * 8;
+  soa->triangleCount = triangleCount;
+  soa->paddedCount = padded;
+
+  const unsigned short *idx16 = (indexSize == 2) ? indices : NULL;
+  const unsigned int *idx32 = (indexSize == 4) ? indices : NULL;
+
+  for (int i = 0; i < triangleCount; i++) {
+    int i0 = i * 3 + 0, i1 = i * 3 + 1, i2 = i * 3 + 2;
+    if (idx16 != NULL) {
+      i0 = idx16[i0];
+      i1 = idx16[i1];
+      i2 = idx16[i2];
+    } else if (idx32 != NULL) {
+      i0 = (int)idx32[i0];
+      i1 = (int)idx32[i1];
+      i2 = (int)idx32[i2];
+    }
+    // Unsigned compare: 32-bit indices past INT_MAX turn negative as int
+    if ((unsigned int)i0 >= (unsigned int)vertexCount ||
+        (unsigned int)i1 >= (unsigned int)vertexCount ||
+        (unsigned int)i2 >= (unsigned int)vertexCount) {
+      continue; // Out of range index, leave as degenerate triangle
+    }
+
+    const float *a = &vertices[i0 * 3];
+    const float *b = &vertices[i1 * 3];
+    const float *c = &vertices[i2 * 3];
+    soa->v0x[i] = a[0];
+    soa->v0y[i] = a[1];
+    soa->v0z[i] = a[2];
+    soa->e1x[i] = b[0] - a[0];
+    soa->e1y[i] = b[1] - a[1];
+    soa->e1z[i] = b[2] - a[2];
+    soa->e2x[i] = c[0] - a[0];
+    soa->e2y[i] = c[1] - a[1];
+    soa->e2z[i] = c[2] - a[2];
+  }
+  return true;
+}
+
+// Scalar kernel, also used for the tail when SIMD is unavailable
+static int IntersectTriangleSoAScalar(const TriangleSoA *soa, int start,
+                                      int end, Ray ray, float *closest) {
+  int hit = -1;
+  float ox = ray.position.x, oy = ray.position.y, oz = ray.position.z;
+  float dx = ray.direction.x, dy = ray.direction.y, dz = ray.direction.z;
+
+  for (int i = start; i < end; i++) {
+    float e1x = soa->e1x[i], e1y = soa->e1y[i], e1z = soa->e1z[i];
+    float e2x = soa->e2x[i], e2y = soa->e2y[i], e2z = soa->e2z[i];
+    float px = dy * e2z - dz * e2y;
+    float py = dz * e2x - dx * e2z;
+    float pz = dx * e2y - dy * e2x;
+    float det = e1x * px + e1y * py + e1z * pz;
+    if (det > -RT_EPSILON && det < RT_EPSILON) {
+      continue;
+    }
+    float invDet = 1.0f / det;
+    float tx = ox - soa->v0x[i], ty = oy - soa->v0y[i], tz = oz - soa->v0z[i];
+    float u = (tx * px + ty * py + tz * pz) * invDet;
+    if (u < 0.0f || u > 1.0f) {
+      continue;
+    }
+    float qx = ty * e1z - tz * e1y;
+    float qy = tz * e1x - tx * e1z;
+    float qz = tx * e1y - ty * e1x;
+    float v = (dx * qx + dy * qy + dz * qz) * invDet;
+    if (v < 0.0f || u + v > 1.0f) {
+      continue;
+    }
+    float t = (e2x * qx + e2y * qy + e2z * qz) * invDet;
+    if (t > RT_EPSILON && t < *closest) {
+      *closest = t;
+      hit = i;
+    }
+  }
+  return hit;
+}
+
+#if RT_SIMD_SSE
+static int IntersectTriangleSoASSE(const TriangleSoA *soa, int start, int end,
+                                   Ray ray, float *closest) {
+  int hit = -1;
+  const __m128 ox = _mm_set1_ps(ray.position.x);
+  const __m128 oy = _mm_set1_ps(ray.position.y);
+  const __m128 oz = _mm_set1_ps(ray.position.z);
+  const __m128 dx = _mm_set1_ps(ray.direction.x);
+  const __m128 dy = _mm_set1_ps(ray.direction.y);
+  const __m128 dz = _mm_set1_ps(ray.direction.z);
+  const __m128 eps = _mm_set1_ps(RT_EPSILON);
+  const __m128 negEps = _mm_set1_ps(-RT_EPSILON);
+  const __m128 zero = _mm_setzero_ps();
+  const __m128 one = _mm_set1_ps(1.0f);
+  __m128 best = _mm_set1_ps(*closest);
+
+  for (int i = start; i < end; i += 4) {
+    __m128 e1x = _mm_load_ps(&soa->e1x[i]), e1y = _mm_load_ps(&soa->e1y[i]),
+           e1z = _mm_load_ps(&soa->e1z[i]);
+    __m128 e2x = _mm_load_ps(&soa->e2x[i]), e2y = _mm_load_ps(&soa->e2y[i]),
+           e2z = _mm_load_ps(&soa->e2z[i]);
+
+    __m128 px = _mm_sub_ps(_mm_mul_ps(dy, e2z), _mm_mul_ps(dz, e2y));
+    __m128 py = _mm_sub_ps(_mm_mul_ps(dz, e2x), _mm_mul_ps(dx, e2z));
+    __m128 pz = _mm_sub_ps(_mm_mul_ps(dx, e2y), _mm_mul_ps(dy, e2x));
+    __m128 det = _mm_add_ps(_mm_add_ps(_mm_mul_ps(e1x, px), _mm_mul_ps(e1y, py)),
+                            _mm_mul_ps(e1z, pz));
+    __m128 mask = _mm_or_ps(_mm_cmpgt_ps(det, eps), _mm_cmplt_ps(det, negEps));
+    if (_mm_movemask_ps(mask) == 0) {
+      continue;
+    }
+    __m128 invDet = _mm_div_ps(one, det);
+
+    __m128 tx = _mm_sub_ps(ox, _mm_load_ps(&soa->v0x[i]));
+    __m128 ty = _mm_sub_ps(oy, _mm_load_ps(&soa->v0y[i]));
+    __m128 tz = _mm_sub_ps(oz, _mm_load_ps(&soa->v0z[i]));
+    __m128 u = _mm_mul_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(tx, px), _mm_mul_ps(ty, py)),
+                   _mm_mul_ps(tz, pz)),
+        invDet);
+    mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(u, zero), _mm_cmple_ps(u, one)));
+
+    __m128 qx = _mm_sub_ps(_mm_mul_ps(ty, e1z), _mm_mul_ps(tz, e1y));
+    __m128 qy = _mm_sub_ps(_mm_mul_ps(tz, e1x), _mm_mul_ps(tx, e1z));
+    __m128 qz = _mm_sub_ps(_mm_mul_ps(tx, e1y), _mm_mul_ps(ty, e1x));
+    __m128 v = _mm_mul_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(dx, qx), _mm_mul_ps(dy, qy)),
+                   _mm_mul_ps(dz, qz)),
+        invDet);
+    mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpge_ps(v, zero),
+                                       _mm_cmple_ps(_mm_add_ps(u, v), one)));
+
+    __m128 t = _mm_mul_ps(
+        _mm_add_ps(_mm_add_ps(_mm_mul_ps(e2x, qx), _mm_mul_ps(e2y, qy)),
+                   _mm_mul_ps(e2z, qz)),
+        invDet);
+    mask = _mm_and_ps(mask, _mm_and_ps(_mm_cmpgt_ps(t, eps), _mm_cmplt_ps(t, best)));
+
+    int bits = _mm_movemask_ps(mask);
+    if (bits == 0) {
+      continue;
+    }
+    float tl[4];
+    _mm_storeu_ps(tl, t);
+    float bestScalar = *closest;
+    for (int k = 0; k < 4; k++) {
+      if ((bits & (1 << k)) && tl[k] < bestScalar) {
+        bestScalar = tl[k];
+        hit = i + k;
+      }
+    }
+    *closest = bestScalar;
+    best = _mm_set1_ps(bestScalar);
+  }
+  return hit;
+}
+#endif
+
+#if RT_SIMD_AVX_DISPATCH || RT_SIMD_AVX_STATIC
+#if RT_SIMD_AVX_DISPATCH
+__attribute__((target("avx")))
+#endif
+static int IntersectTriangleSoAAVX(const TriangleSoA *soa, int start, int end,
+                                   Ray ray, float *closest) {
+  int hit = -1;
+  const __m256 ox = _mm256_set1_ps(ray.position.x);
+  const __m256 oy = _mm256_set1_ps(ray.position.y);
+  const __m256 oz = _mm256_set1_ps(ray.position.z);
+  const __m256 dx = _mm256_set1_ps(ray.direction.x);
+  const __m256 dy = _mm256_set1_ps(ray.direction.y);
+  const __m256 dz = _mm256_set1_ps(ray.direction.z);
+  const __m256 eps = _mm256_set1_ps(RT_EPSILON);
+  const __m256 negEps = _mm256_set1_ps(-RT_EPSILON);
+  const __m256 zero = _mm256_setzero_ps();
+  const __m256 one = _mm256_set1_ps(1.0f);
+  __m256 best = _mm256_set1_ps(*closest);
+
+  for (int i = start; i < end; i += 8) {
+    __m256 e1x = _mm256_load_ps(&soa->e1x[i]), e1y = _mm256_load_ps(&soa->e1y[i]),
+           e1z = _mm256_load_ps(&soa->e1z[i]);
+    __m256 e2x = _mm256_load_ps(&soa->e2x[i]), e2y = _mm256_load_ps(&soa->e2y[i]),
+           e2z = _mm256_load_ps(&soa->e2z[i]);
+
+    __m256 px = _mm256_sub_ps(_mm256_mul_ps(dy, e2z), _mm256_mul_ps(dz, e2y));
+    __m256 py = _mm256_sub_ps(_mm256_mul_ps(dz, e2x), _mm256_mul_ps(dx, e2z));
+    __m256 pz = _mm256_sub_ps(_mm256_mul_ps(dx, e2y), _mm256_mul_ps(dy, e2x));
+    __m256 det = _mm256_add_ps(
+        _mm256_add_ps(_mm256_mul_ps(e1x, px), _mm256_mul_ps(e1y, py)),
+        _mm256_mul_ps(e1z, pz));
+    __m256 mask = _mm256_or_ps(_mm256_cmp_ps(det, eps, _CMP_GT_OQ),
+                               _mm256_cmp_ps(det, negEps, _CMP_LT_OQ));
+    if (_mm256_movemask_ps(mask) == 0) {
+      continue;
+    }
+    __m256 invDet = _mm256_div_ps(one, det);
+
+    __m256 tx = _mm256_sub_ps(ox, _mm256_load_ps(&soa->v0x[i]));
+    __m256 ty = _mm256_sub_ps(oy, _mm256_load_ps(&soa->v0y[i]));
+    __m256 tz = _mm256_sub_ps(oz, _mm256_load_ps(&soa->v0z[i]));
+    __m256 u = _mm256_mul_ps(
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(tx, px), _mm256_mul_ps(ty, py)),
+                      _mm256_mul_ps(tz, pz)),
+        invDet);
+    mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(u, zero, _CMP_GE_OQ),
+                                             _mm256_cmp_ps(u, one, _CMP_LE_OQ)));
+
+    __m256 qx = _mm256_sub_ps(_mm256_mul_ps(ty, e1z), _mm256_mul_ps(tz, e1y));
+    __m256 qy = _mm256_sub_ps(_mm256_mul_ps(tz, e1x), _mm256_mul_ps(tx, e1z));
+    __m256 qz = _mm256_sub_ps(_mm256_mul_ps(tx, e1y), _mm256_mul_ps(ty, e1x));
+    __m256 v = _mm256_mul_ps(
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(dx, qx), _mm256_mul_ps(dy, qy)),
+                      _mm256_mul_ps(dz, qz)),
+        invDet);
+    mask = _mm256_and_ps(
+        mask, _mm256_and_ps(_mm256_cmp_ps(v, zero, _CMP_GE_OQ),
+                            _mm256_cmp_ps(_mm256_add_ps(u, v), one, _CMP_LE_OQ)));
+
+    __m256 t = _mm256_mul_ps(
+        _mm256_add_ps(_mm256_add_ps(_mm256_mul_ps(e2x, qx), _mm256_mul_ps(e2y, qy)),
+                      _mm256_mul_ps(e2z, qz)),
+        invDet);
+    mask = _mm256_and_ps(mask, _mm256_and_ps(_mm256_cmp_ps(t, eps, _CMP_GT_OQ),
+                                             _mm256_cmp_ps(t, best, _CMP_LT_OQ)));
+
+    int bits = _mm256_movemask_ps(mask);
+    if (bits == 0) {
+      continue;
+    }
+    float tl[8];
+    _mm256_storeu_ps(tl, t);
+    float bestScalar = *closest;
+    for (int k = 0; k < 8; k++) {
+      if ((bits & (1 << k)) && tl[k] < bestScalar) {
+        bestScalar = tl[k];
+        hit = i + k;
+      }
+    }
+    *closest = bestScalar;
+    best = _mm256_set1_ps(bestScalar);
+  }
+  return hit;
+}
+#endif
+
+// Number of triangles tested per iteration by the selected kernel
+static int TriangleSoAKernelWidth(void) {
+#if RT_SIMD_AVX_STATIC
+  return 8;
+#elif RT_SIMD_AVX_DISPATCH
+  static int width = 0;
+  if (width == 0) {
+    width = __builtin_cpu_supports("avx") ? 8 : 4;
+  }
+  return width;
+#elif RT_SIMD_SSE
+  return 4;
+#else
+  return 1;
+#endif
+}
+
+// Closest hit against all triangles, returns triangle index or -1.
+// Distance is the ray parameter t (direction is not normalized).
+static int IntersectTriangleSoA(const TriangleSoA *soa, Ray ray,
+                                float *inOutDistance) {
+  int width = TriangleSoAKernelWidth();
+#if RT_SIMD_AVX_DISPATCH || RT_SIMD_AVX_STATIC
+  if (width == 8) {
+    return IntersectTriangleSoAAVX(soa, 0, soa->paddedCount, ray, inOutDistance);
+  }
+#endif
+#if RT_SIMD_SSE
+  if (width == 4) {
+    return IntersectTriangleSoASSE(soa, 0, soa->paddedCount, ray, inOutDistance);
+  }
+#endif
+  (void)width;
+  return IntersectTriangleSoAScalar(soa, 0, soa->triangleCount, ray,
+                                    inOutDistance);
+}
+
+#endif // RAY_TRIANGLE_SIMD_H
@@ -1,4 +1,5 @@
 #include "raylib.h"
+#include "common/frustum.h"
 
 // Export macro for Windows DLL
 #ifdef _WIN32
@@ -233,11 +234,48 @@ EXPORT void DrawTriangle3DWrapper(float v1X, float v1Y, float v1Z, float v2X,
   DrawTriangle3D(vert1, vert2, vert3, c);
 }
 
+// Frustum culling for solid 3D primitives, on by default
+static bool primitiveCullingEnabled = true;
+static FrustumCullStats primitiveCullStats = {0};
+
+// Returns true if a primitive with these bounds should be drawn
+static bool CullPrimitiveDraw(BoundingBox box) {
+  if (!primitiveCullingEnabled) {
+    return true;
+  }
+  Frustum frustum = FrustumFromCurrentMatrices();
+  if (!FrustumContainsBox(&frustum, box)) {
+    primitiveCullStats.culled++;
+    return false;
+  }
+  primitiveCullStats.drawn++;
+  return true;
+}
+
+EXPORT void SetPrimitiveCullingEnabled(bool enabled) {
+  primitiveCullingEnabled = enabled;
+}
+
+// Culling counters since the last reset: [culled, drawn]
+EXPORT void GetPrimitiveCullingStats(int *outBuffer, bool reset) {
+  outBuffer[0] = primitiveCullStats.culled;
+  outBuffer[1] = primitiveCullStats.drawn;
+  if (reset) {
+    primitiveCullStats = (FrustumCullStats){0};
+  }
+}
+
 // Additional 3D shapes
 EXPORT void DrawCubeWrapper(float posX, float posY, float posZ, float width,
                             float height, float length, unsigned int color) {
   Color c = ColorFromU32(color);
   Vector3 pos = {posX, posY, posZ};
+  Vector3 half = {fabsf(width) * 0.5f, fabsf(height) * 0.5f,
+                  fabsf(length) * 0.5f};
+  if (!CullPrimitiveDraw(
+          (BoundingBox){Vector3Subtract(pos, half), Vector3Add(pos, half)})) {
+    return;
+  }
   DrawCube(pos, width, height, length, c);
 }
 
@@ -246,6 +284,12 @@ EXPORT void DrawCubeVWrapper(float posX, float posY, float posZ, float sizeX,
   Color c = ColorFromU32(color);
   Vector3 pos = {posX, posY, posZ};
   Vector3 sizeVec = {sizeX, sizeY, sizeZ};
+  Vector3 half = {fabsf(sizeX) * 0.5f, fabsf(sizeY) * 0.5f,
+                  fabsf(sizeZ) * 0.5f};
+  if (!CullPrimitiveDraw(
+          (BoundingBox){Vector3Subtract(pos, half), Vector3Add(pos, half)})) {
+    return;
+  }
   DrawCubeV(pos, sizeVec, c);
 }
 
@@ -253,6 +297,11 @@ EXPORT void DrawSphereWrapper(float centerX, float centerY, float centerZ,
                               float radius, unsigned int color) {
   Color c = ColorFromU32(color);
   Vector3 center = {centerX, centerY, centerZ};
+  Vector3 r = {fabsf(radius), fabsf(radius), fabsf(radius)};
+  if (!CullPrimitiveDraw(
+          (BoundingBox){Vector3Subtract(center, r), Vector3Add(center, r)})) {
+    return;
+  }
   DrawSphere(center, radius, c);
 }
 
@@ -261,6 +310,13 @@ EXPORT void DrawCylinderWrapper(float posX, float posY, float posZ,
                                 float height, int slices, unsigned int color) {
   Color c = ColorFromU32(color);
   Vector3 pos = {posX, posY, posZ};
+  // Cylinder stands on pos and extends up by height
+  float r = fmaxf(fabsf(radiusTop), fabsf(radiusBottom));
+  BoundingBox box = {{posX - r, fminf(posY, posY + height), posZ - r},
+                     {posX + r, fmaxf(posY, posY + height), posZ + r}};
+  if (!CullPrimitiveDraw(box)) {
+    return;
+  }
   DrawCylinder(pos, radiusTop, radiusBottom, height, slices, c);
 }
 
@@ -270,6 +326,12 @@ EXPORT void DrawCapsuleWrapper(float startX, float startY, float startZ,
   Color c = ColorFromU32(color);
   Vector3 start = {startX, startY, startZ};
   Vector3 end = {endX, endY, endZ};
+  Vector3 r = {fabsf(radius), fabsf(radius), fabsf(radius)};
+  BoundingBox box = {Vector3Subtract(Vector3Min(start, end), r),
+                     Vector3Add(Vector3Max(start, end), r)};
+  if (!CullPrimitiveDraw(box)) {
+    return;
+  }
   DrawCapsule(start, end, radius, slices, rings, c);
 }
 
@@ -1,4 +1,6 @@
 #include "raylib.h"
+#include "../common/handle-table.h"
+#include "../common/deferred-unload.h"
 #include <stdbool.h>
 #include <stdlib.h>
 #include <string.h>
@@ -10,37 +12,55 @@
 #define EXPORT
 #endif
 
-#define MAX_SHADER_SLOTS 32
 #define MAX_LOCATION_CACHE 32
 
 // Shader storage with metadata and location cache
 typedef struct {
   Shader shader;
-  bool isValid;
   int locationCache[MAX_LOCATION_CACHE];
   char locationNames[MAX_LOCATION_CACHE][64];
   int cacheCount;
 } ShaderSlot;
 
-static ShaderSlot shaderSlots[MAX_SHADER_SLOTS] = {0};
+// Slot handles are generational: stale handles of unloaded shaders fail
+static HandleTable shaderSlots = HANDLE_TABLE_INIT(ShaderSlot);
 
-// Find free slot for new shader
-int FindFreeShaderSlot() {
-  for (int i = 0; i < MAX_SHADER_SLOTS; i++) {
-    if (!shaderSlots[i].isValid) {
-      return i;
-    }
-  }
-  return -1; // No free slots
+static void ReleaseShader(void *resource) { UnloadShader(*(Shader *)resource); }
+
+// Unloaded shaders wait here for the frame loop to release them
+static DeferredUnloadQueue shaderUnloads =
+    DEFERRED_UNLOAD_QUEUE_INIT(Shader, ReleaseShader);
+
+// Live slot for a handle, NULL when invalid or unloaded
+static ShaderSlot *GetShaderSlot(int slotIndex) {
+  return HandleTableGet(&shaderSlots, slotIndex);
 }
 
-// Load shader from files and return slot index
-EXPORT int LoadShaderToSlot(const char *vsFileName, const char *fsFileName) {
-  int slotIndex = FindFreeShaderSlot();
+// Store a loaded shader in a new slot with an empty location cache
+static int StoreShaderInSlot(Shader shader) {
+  int slotIndex = HandleTableAlloc(&shaderSlots);
   if (slotIndex == -1) {
-    return -1; // No free slots
+    UnloadShader(shader);
+    return -1; // Out of memory
+  }
+
+  // Resolved here so instanced draws in other wrappers never have to write
+  // into this slot's location table
+  if (shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] < 0) {
+    shader.locs[SHADER_LOC_VERTEX_INSTANCE_TX] =
+        GetShaderLocationAttrib(shader, "instanceTransform");
   }
 
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  slot->shader = shader;
+  slot->cacheCount = 0;
+  memset(slot->locationCache, -1, sizeof(slot->locationCache));
+
+  return slotIndex;
+}
+
+// Load shader from files and return slot index
+EXPORT int LoadShaderToSlot(const char *vsFileName, const char *fsFileName) {
   // Load shader from files (NULL means use default shader for that stage)
   Shader shader = LoadShader(vsFileName, fsFileName);
 
@@ -50,26 +70,11 @@ EXPORT int LoadShaderToSlot(const char *vsFileName, const char *fsFileName) {
     return -1; // Failed to load
   }
 
-  shaderSlots[slotIndex].shader = shader;
-  shaderSlots[slotIndex].isValid = true;
-  shaderSlots[slotIndex].cacheCount = 0;
-
-  // Clear location cache
-  memset(shaderSlots[slotIndex].locationCache, -1,
-         sizeof(shaderSlots[slotIndex].locationCache));
-  memset(shaderSlots[slotIndex].locationNames, 0,
-         sizeof(shaderSlots[slotIndex].locationNames));
-
-  return slotIndex;
+  return StoreShaderInSlot(shader);
 }
 
 // Load shader from memory (code strings) and return slot index
 EXPORT int LoadShaderFromMemoryToSlot(const char *vsCode, const char *fsCode) {
-  int slotIndex = FindFreeShaderSlot();
-  if (slotIndex == -1) {
-    return -1; // No free slots
-  }
-
   // Load shader from memory (NULL means use default shader for that stage)
   Shader shader = LoadShaderFromMemory(vsCode, fsCode);
 
@@ -78,72 +83,73 @@ EXPORT int LoadShaderFromMemoryToSlot(const char *vsCode, const char *fsCode) {
     return -1; // Failed to load
   }
 
-  shaderSlots[slotIndex].shader = shader;
-  shaderSlots[slotIndex].isValid = true;
-  shaderSlots[slotIndex].cacheCount = 0;
-
-  // Clear location cache
-  memset(shaderSlots[slotIndex].locationCache, -1,
-         sizeof(shaderSlots[slotIndex].locationCache));
-  memset(shaderSlots[slotIndex].locationNames, 0,
-         sizeof(shaderSlots[slotIndex].locationNames));
-
-  return slotIndex;
+  return StoreShaderInSlot(shader);
 }
 
-// Unload shader by slot index
+// Unload shader by slot index (the handle is stale at once, the program is
+// released by the next DrainShaderUnloads)
 EXPORT void UnloadShaderBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot) {
     return;
   }
 
-  UnloadShader(shaderSlots[slotIndex].shader);
-  shaderSlots[slotIndex].isValid = false;
-  shaderSlots[slotIndex].shader = (Shader){0};
-  shaderSlots[slotIndex].cacheCount = 0;
-
-  // Clear location cache
-  memset(shaderSlots[slotIndex].locationCache, -1,
-         sizeof(shaderSlots[slotIndex].locationCache));
-  memset(shaderSlots[slotIndex].locationNames, 0,
-         sizeof(shaderSlots[slotIndex].locationNames));
+  DeferredUnloadPush(&shaderUnloads, &slot->shader);
+  HandleTableFree(&shaderSlots, slotIndex);
 }
 
 // Unload all shaders
 EXPORT void UnloadAllShaders() {
-  for (int i = 0; i < MAX_SHADER_SLOTS; i++) {
-    if (shaderSlots[i].isValid) {
-      UnloadShaderBySlot(i);
-    }
+  for (int i = 0; i < HandleTableCapacity(&shaderSlots); i++) {
+    UnloadShaderBySlot(HandleTableHandleAt(&shaderSlots, i));
   }
 }
 
 // Check if shader slot is valid
 EXPORT bool IsShaderSlotValid(int slotIndex) {
-  return (slotIndex >= 0 && slotIndex < MAX_SHADER_SLOTS &&
-          shaderSlots[slotIndex].isValid);
+  return GetShaderSlot(slotIndex) != NULL;
+}
+
+// Release queued shaders for up to budgetMs (negative: all of them), returns
+// how many were released
+EXPORT int DrainShaderUnloads(float budgetMs) {
+  return DeferredUnloadDrain(&shaderUnloads, budgetMs);
+}
+
+// Defer shader releases to DrainShaderUnloads (default) or release them inside
+// UnloadShaderBySlot; turning deferral off releases the queue
+EXPORT void SetDeferredShaderUnload(bool enabled) {
+  DeferredUnloadSetImmediate(&shaderUnloads, !enabled);
+}
+
+// [queued, peak queued, released by drains], counters reset on request
+EXPORT void GetShaderUnloadStats(int *outBuffer, bool reset) {
+  DeferredUnloadStats(&shaderUnloads, outBuffer, reset);
+}
+
+// Get shader pointer for other wrappers (e.g. instanced model drawing).
+// Read only: the slot, its location table included, belongs to this wrapper.
+EXPORT Shader *GetShaderPointerFromSlot(int slotIndex) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot) {
+    return NULL;
+  }
+  return &slot->shader;
 }
 
 // Get number of loaded shaders
 EXPORT int GetLoadedShaderCount() {
-  int count = 0;
-  for (int i = 0; i < MAX_SHADER_SLOTS; i++) {
-    if (shaderSlots[i].isValid) {
-      count++;
-    }
-  }
-  return count;
+  return HandleTableCount(&shaderSlots);
 }
 
 // Begin shader mode - activate shader for subsequent drawing
 EXPORT void BeginShaderModeBySlot(int slotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot) {
     return; // Invalid slot, do nothing
   }
 
-  BeginShaderMode(shaderSlots[slotIndex].shader);
+  BeginShaderMode(slot->shader);
 }
 
 // End shader mode - deactivate custom shader
@@ -151,13 +157,11 @@ EXPORT void EndShaderModeWrapper() { EndShaderMode(); }
 
 // Get shader uniform location with caching
 EXPORT int GetShaderLocationBySlot(int slotIndex, const char *uniformName) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || uniformName == NULL) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || uniformName == NULL) {
     return -1; // Invalid parameters
   }
 
-  ShaderSlot *slot = &shaderSlots[slotIndex];
-
   // Check if location is already cached
   for (int i = 0; i < slot->cacheCount; i++) {
     if (strcmp(slot->locationNames[i], uniformName) == 0) {
@@ -182,75 +186,70 @@ EXPORT int GetShaderLocationBySlot(int slotIndex, const char *uniformName) {
 // Set float uniform value
 EXPORT void SetShaderValueFloatBySlot(int slotIndex, int locIndex,
                                       float value) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0) {
     return; // Invalid parameters
   }
 
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, &value,
-                 SHADER_UNIFORM_FLOAT);
+  SetShaderValue(slot->shader, locIndex, &value, SHADER_UNIFORM_FLOAT);
 }
 
 // Set integer uniform value
 EXPORT void SetShaderValueIntBySlot(int slotIndex, int locIndex, int value) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0) {
     return; // Invalid parameters
   }
 
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, &value,
-                 SHADER_UNIFORM_INT);
+  SetShaderValue(slot->shader, locIndex, &value, SHADER_UNIFORM_INT);
 }
 
 // Set vec2 uniform value
 EXPORT void SetShaderValueVec2BySlot(int slotIndex, int locIndex, float x,
                                      float y) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0) {
     return; // Invalid parameters
   }
 
   float vec2[2] = {x, y};
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, vec2,
-                 SHADER_UNIFORM_VEC2);
+  SetShaderValue(slot->shader, locIndex, vec2, SHADER_UNIFORM_VEC2);
 }
 
 // Set vec3 uniform value
 EXPORT void SetShaderValueVec3BySlot(int slotIndex, int locIndex, float x,
                                      float y, float z) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0) {
     return; // Invalid parameters
   }
 
   float vec3[3] = {x, y, z};
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, vec3,
-                 SHADER_UNIFORM_VEC3);
+  SetShaderValue(slot->shader, locIndex, vec3, SHADER_UNIFORM_VEC3);
 }
 
 // Set vec4 uniform value
 EXPORT void SetShaderValueVec4BySlot(int slotIndex, int locIndex, float x,
                                      float y, float z, float w) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0) {
     return; // Invalid parameters
   }
 
   float vec4[4] = {x, y, z, w};
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, vec4,
-                 SHADER_UNIFORM_VEC4);
+  SetShaderValue(slot->shader, locIndex, vec4, SHADER_UNIFORM_VEC4);
 }
 
-// Set texture uniform value (sampler2D)
+// Point a sampler2D uniform at a texture unit. The texture itself is bound
+// to that unit by the texture wrapper (BindTextureToUnitBySlot).
 EXPORT void SetShaderValueTextureBySlot(int slotIndex, int locIndex,
-                                        int textureSlotIndex) {
-  if (slotIndex < 0 || slotIndex >= MAX_SHADER_SLOTS ||
-      !shaderSlots[slotIndex].isValid || locIndex < 0 || textureSlotIndex < 0) {
+                                        int textureUnit) {
+  ShaderSlot *slot = GetShaderSlot(slotIndex);
+  if (!slot || locIndex < 0 || textureUnit < 0) {
     return; // Invalid parameters
   }
 
-  // For texture uniforms, we need to set the texture unit index
-  SetShaderValue(shaderSlots[slotIndex].shader, locIndex, &textureSlotIndex,
+  SetShaderValue(slot->shader, locIndex, &textureUnit,
                  SHADER_UNIFORM_SAMPLER2D);
 }
 
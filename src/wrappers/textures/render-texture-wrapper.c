@@ -1,4 +1,6 @@
 #include "raylib.h"
+#include "../common/handle-table.h"
+#include "../common/deferred-unload.h"
 #include <stdlib.h>
 
 // Export macro for Windows DLL
@@ -8,151 +10,173 @@
     #define EXPORT
 #endif
 
-#define MAX_RENDER_TEXTURES 64
-
 // Render texture storage
 typedef struct {
     RenderTexture2D renderTexture;
-    bool isLoaded;
 } RenderTextureSlot;
 
-static RenderTextureSlot renderTextureSlots[MAX_RENDER_TEXTURES] = {0};
+// Slot handles are generational: stale handles of unloaded targets fail
+static HandleTable renderTextureSlots = HANDLE_TABLE_INIT(RenderTextureSlot);
 
-// Find free slot for new render texture
-int FindFreeRenderTextureSlot() {
-    for (int i = 0; i < MAX_RENDER_TEXTURES; i++) {
-        if (!renderTextureSlots[i].isLoaded) {
-            return i;
-        }
-    }
-    return -1; // No free slots
+static void ReleaseRenderTexture(void *resource) {
+    UnloadRenderTexture(*(RenderTexture2D *)resource);
+}
+
+// Unloaded targets wait here for the frame loop to release them
+static DeferredUnloadQueue renderTextureUnloads = DEFERRED_UNLOAD_QUEUE_INIT(RenderTexture2D, ReleaseRenderTexture);
+
+// Live slot for a handle, NULL when invalid or unloaded
+static RenderTextureSlot *GetRenderTextureSlot(int slotIndex) {
+    return HandleTableGet(&renderTextureSlots, slotIndex);
 }
 
 // Load render texture and return slot index
 EXPORT int LoadRenderTextureToSlot(int width, int height) {
-    int slotIndex = FindFreeRenderTextureSlot();
-    if (slotIndex == -1) {
-        return -1; // No free slots
-    }
-    
     RenderTexture2D renderTexture = LoadRenderTexture(width, height);
     if (renderTexture.id == 0) {
         return -1; // Failed to load
     }
     
-    renderTextureSlots[slotIndex].renderTexture = renderTexture;
-    renderTextureSlots[slotIndex].isLoaded = true;
+    int slotIndex = HandleTableAlloc(&renderTextureSlots);
+    if (slotIndex == -1) {
+        UnloadRenderTexture(renderTexture);
+        return -1; // Out of memory
+    }
+    
+    GetRenderTextureSlot(slotIndex)->renderTexture = renderTexture;
     
     return slotIndex;
 }
 
 // Get render texture properties by slot index
 EXPORT unsigned int GetRenderTextureIdBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.id;
+    return slot->renderTexture.id;
 }
 
 // Get color texture properties
 EXPORT unsigned int GetRenderTextureColorIdBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.texture.id;
+    return slot->renderTexture.texture.id;
 }
 
 EXPORT int GetRenderTextureColorWidthBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.texture.width;
+    return slot->renderTexture.texture.width;
 }
 
 EXPORT int GetRenderTextureColorHeightBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.texture.height;
+    return slot->renderTexture.texture.height;
 }
 
 EXPORT int GetRenderTextureColorMipmapsBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.texture.mipmaps;
+    return slot->renderTexture.texture.mipmaps;
 }
 
 EXPORT int GetRenderTextureColorFormatBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.texture.format;
+    return slot->renderTexture.texture.format;
 }
 
 // Get depth texture properties
 EXPORT unsigned int GetRenderTextureDepthIdBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.depth.id;
+    return slot->renderTexture.depth.id;
 }
 
 EXPORT int GetRenderTextureDepthWidthBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.depth.width;
+    return slot->renderTexture.depth.width;
 }
 
 EXPORT int GetRenderTextureDepthHeightBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.depth.height;
+    return slot->renderTexture.depth.height;
 }
 
 EXPORT int GetRenderTextureDepthMipmapsBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.depth.mipmaps;
+    return slot->renderTexture.depth.mipmaps;
 }
 
 EXPORT int GetRenderTextureDepthFormatBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return renderTextureSlots[slotIndex].renderTexture.depth.format;
+    return slot->renderTexture.depth.format;
 }
 
-// Unload render texture by slot index
+// Unload render texture by slot index (the handle is stale at once, the
+// target is released by the next DrainRenderTextureUnloads)
 EXPORT void UnloadRenderTextureBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_RENDER_TEXTURES || !renderTextureSlots[slotIndex].isLoaded) {
+    RenderTextureSlot *slot = GetRenderTextureSlot(slotIndex);
+    if (!slot) {
         return;
     }
     
-    UnloadRenderTexture(renderTextureSlots[slotIndex].renderTexture);
-    renderTextureSlots[slotIndex].isLoaded = false;
-    renderTextureSlots[slotIndex].renderTexture = (RenderTexture2D){0};
+    DeferredUnloadPush(&renderTextureUnloads, &slot->renderTexture);
+    HandleTableFree(&renderTextureSlots, slotIndex);
 }
 
 // Get number of loaded render textures
 EXPORT int GetLoadedRenderTextureCount() {
-    int count = 0;
-    for (int i = 0; i < MAX_RENDER_TEXTURES; i++) {
-        if (renderTextureSlots[i].isLoaded) {
-            count++;
-        }
-    }
-    return count;
+    return HandleTableCount(&renderTextureSlots);
 }
 
 // Unload all render textures
 EXPORT void UnloadAllRenderTextures() {
-    for (int i = 0; i < MAX_RENDER_TEXTURES; i++) {
-        if (renderTextureSlots[i].isLoaded) {
-            UnloadRenderTextureBySlot(i);
-        }
+    for (int i = 0; i < HandleTableCapacity(&renderTextureSlots); i++) {
+        UnloadRenderTextureBySlot(HandleTableHandleAt(&renderTextureSlots, i));
     }
-}
\ No newline at end of file
+}
+
+// Release queued render textures for up to budgetMs (negative: all of them),
+// returns how many were released
+EXPORT int DrainRenderTextureUnloads(float budgetMs) {
+    return DeferredUnloadDrain(&renderTextureUnloads, budgetMs);
+}
+
+// Defer render texture releases to DrainRenderTextureUnloads (default) or
+// release them inside UnloadRenderTextureBySlot; turning deferral off
+// releases the queue
+EXPORT void SetDeferredRenderTextureUnload(bool enabled) {
+    DeferredUnloadSetImmediate(&renderTextureUnloads, !enabled);
+}
+
+// [queued, peak queued, released by drains], counters reset on request
+EXPORT void GetRenderTextureUnloadStats(int *outBuffer, bool reset) {
+    DeferredUnloadStats(&renderTextureUnloads, outBuffer, reset);
+}
@@ -1,4 +1,9 @@
 #include "raylib.h"
+#include "rlgl.h"
+#include "../common/handle-table.h"
+#include "../common/deferred-unload.h"
+#include "../common/job-pool.h"
+#include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
 
@@ -9,134 +14,553 @@
     #define EXPORT
 #endif
 
-#define MAX_TEXTURES 256
-
 // Texture storage with metadata
 typedef struct {
-    Texture2D texture;
-    bool isLoaded;
+    Texture2D texture;     // id is 0 while evicted, the rest stays valid
     char fileName[256];
+    size_t vramBytes;      // Estimated GPU memory, all mip levels
+    unsigned int lastUsedFrame; // Texture frame of the last draw or id query
+    bool evicted;          // Released to meet the budget, reloads on use
+    bool pinned;           // GL id handed out, kept resident until unpinned
 } TextureSlot;
 
-static TextureSlot textureSlots[MAX_TEXTURES] = {0};
-static int nextSlotIndex = 0;
+// Slot handles are generational: stale handles of unloaded textures fail
+static HandleTable textureSlots = HANDLE_TABLE_INIT(TextureSlot);
+
+static void ReleaseTexture(void *resource) {
+    UnloadTexture(*(Texture2D *)resource);
+}
+
+// Unloaded textures wait here for the frame loop to release them
+static DeferredUnloadQueue textureUnloads = DEFERRED_UNLOAD_QUEUE_INIT(Texture2D, ReleaseTexture);
+
+// Live slot for a handle, NULL when invalid or unloaded
+static TextureSlot *GetTextureSlot(int slotIndex) {
+    return HandleTableGet(&textureSlots, slotIndex);
+}
+
+// ----------------------------------------------------------------------------
+// Memory budget. Every slot knows roughly how much GPU memory it holds and
+// the frame it was last used in. With a budget set, EndTextureFrame evicts
+// the least recently used textures until the resident total fits; an
+// evicted slot keeps its handle and metadata and reloads from its file the
+// next time it is drawn or its id is asked for. Textures used in the
+// current frame are never evicted, and neither are pinned ones: a reload
+// gets a new GL id, so once GetTextureIdBySlot has handed the id out the
+// texture stays resident until UnpinTextureBySlot or unload.
+// ----------------------------------------------------------------------------
 
-// Find free slot for new texture
-int FindFreeTextureSlot() {
-    for (int i = 0; i < MAX_TEXTURES; i++) {
-        if (!textureSlots[i].isLoaded) {
-            return i;
+static unsigned int textureFrame = 1;  // Advanced by EndTextureFrame
+static size_t textureResidentBytes = 0;
+static int textureBudgetKB = 0;        // 0: no budget
+static int textureEvictions = 0;       // Since the last stats reset
+static int textureReloads = 0;
+
+// GPU bytes of a texture: every mip level, compressed formats by block
+static size_t EstimateTextureBytes(Texture2D texture) {
+    size_t bytes = 0;
+    int width = texture.width;
+    int height = texture.height;
+    for (int level = 0; level < (texture.mipmaps > 0 ? texture.mipmaps : 1); level++) {
+        bytes += (size_t)GetPixelDataSize(width, height, texture.format);
+        width = width > 1 ? width / 2 : 1;
+        height = height > 1 ? height / 2 : 1;
+    }
+    return bytes;
+}
+
+// Account a texture that just became resident in a slot
+static void SetSlotTexture(TextureSlot *slot, Texture2D texture) {
+    slot->texture = texture;
+    slot->vramBytes = EstimateTextureBytes(texture);
+    slot->lastUsedFrame = textureFrame;
+    slot->evicted = false;
+    textureResidentBytes += slot->vramBytes;
+}
+
+// Mark a slot used this frame, reloading it first when evicted. False when
+// the texture is not resident (its file could not be loaded again).
+static bool UseTextureSlot(TextureSlot *slot) {
+    if (slot->evicted) {
+        Texture2D texture = LoadTexture(slot->fileName);
+        if (texture.id == 0) {
+            return false;
         }
+        SetSlotTexture(slot, texture);
+        textureReloads++;
     }
-    return -1; // No free slots
+    slot->lastUsedFrame = textureFrame;
+    return true;
 }
 
-// Load texture and return slot index
-EXPORT int LoadTextureToSlot(const char* fileName) {
-    int slotIndex = FindFreeTextureSlot();
+// Release a slot's GPU texture but keep the slot; the release itself goes
+// through the deferred queue like an unload
+static void EvictTextureSlot(TextureSlot *slot) {
+    DeferredUnloadPush(&textureUnloads, &slot->texture);
+    textureResidentBytes -= slot->vramBytes;
+    slot->texture.id = 0;
+    slot->evicted = true;
+    textureEvictions++;
+}
+
+// Put a loaded texture in a new slot, releasing it when none can be had
+static int StoreTextureInSlot(Texture2D texture, const char *fileName) {
+    int slotIndex = HandleTableAlloc(&textureSlots);
     if (slotIndex == -1) {
-        return -1; // No free slots
+        UnloadTexture(texture);
+        return -1; // Out of memory
     }
     
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    SetSlotTexture(slot, texture);
+    strncpy(slot->fileName, fileName, 255);
+    slot->fileName[255] = '\0';
+    
+    return slotIndex;
+}
+
+// Load texture and return slot index
+EXPORT int LoadTextureToSlot(const char* fileName) {
     Texture2D texture = LoadTexture(fileName);
     if (texture.id == 0) {
         return -1; // Failed to load
     }
     
-    textureSlots[slotIndex].texture = texture;
-    textureSlots[slotIndex].isLoaded = true;
-    strncpy(textureSlots[slotIndex].fileName, fileName, 255);
-    textureSlots[slotIndex].fileName[255] = '\0';
+    return StoreTextureInSlot(texture, fileName);
+}
+
+// ----------------------------------------------------------------------------
+// Asynchronous loading. LoadTextureAsync returns a request right away and a
+// pool worker reads and decodes the image. The frame loop calls
+// UpdateTextureLoads, which uploads decoded images within a time budget
+// (GL calls stay on the GL thread), and GetTextureLoadStatus yields the slot.
+// Decoding never happens inside LoadTextureAsync: a request no worker can take
+// yet stays queued and is handed over by the next update (or, with no worker
+// threads at all, decoded there within the budget).
+// Workers read the file themselves and decode from memory: LoadImage goes
+// through raylib's global LoadFileData callback, which the model wrapper
+// swaps while parsing on the main thread.
+// ----------------------------------------------------------------------------
+
+#define TEXTURE_LOAD_FAILED -1
+#define TEXTURE_LOAD_PENDING 0
+#define TEXTURE_LOAD_DONE 1
+
+// Request stages. A worker owns the request while DECODING.
+#define TEXTURE_REQUEST_QUEUED 0 // Waiting for a worker to take it
+#define TEXTURE_REQUEST_DECODING 1
+#define TEXTURE_REQUEST_DECODED 2 // Waiting for UpdateTextureLoads to upload
+#define TEXTURE_REQUEST_DONE 3
+#define TEXTURE_REQUEST_FAILED 4
+
+typedef struct {
+    char fileName[256];
+    Image image;
+    int slotIndex; // Result once DONE
+    int stage;     // Guarded by textureLoadLock
+} TextureLoadRequest;
+
+static HandleTable textureLoadRequests = HANDLE_TABLE_INIT(TextureLoadRequest);
+static JobLock textureLoadLock = JOB_LOCK_INIT;
+
+// Progress of the current batch: loads started since nothing was in flight,
+// guarded by textureLoadLock
+static int textureLoadsStarted = 0;
+static int textureLoadsDecoded = 0;
+static int textureLoadsUploaded = 0;
+static int textureLoadsFailed = 0;
+
+static int GetTextureRequestStage(TextureLoadRequest *request) {
+    JobLockAcquire(&textureLoadLock);
+    int stage = request->stage;
+    JobLockRelease(&textureLoadLock);
+    return stage;
+}
+
+// Move a request on and count it in the batch progress
+static void SetTextureRequestStage(TextureLoadRequest *request, int stage) {
+    JobLockAcquire(&textureLoadLock);
+    request->stage = stage;
+    if (stage == TEXTURE_REQUEST_DECODED) {
+        textureLoadsDecoded++;
+    } else if (stage == TEXTURE_REQUEST_DONE) {
+        textureLoadsUploaded++;
+    } else if (stage == TEXTURE_REQUEST_FAILED) {
+        textureLoadsFailed++;
+    }
+    JobLockRelease(&textureLoadLock);
+}
+
+// Whole file in a malloc'd buffer, NULL when it cannot be read
+static unsigned char *ReadTextureFile(const char *fileName, int *size) {
+    FILE *file = fopen(fileName, "rb");
+    if (file == NULL) {
+        return NULL;
+    }
+    unsigned char *data = NULL;
+    long length = fseek(file, 0, SEEK_END) == 0 ? ftell(file) : -1;
+    if (length > 0 && fseek(file, 0, SEEK_SET) == 0) {
+        data = (unsigned char *)malloc((size_t)length);
+        if (data != NULL && fread(data, 1, (size_t)length, file) != (size_t)length) {
+            free(data);
+            data = NULL;
+        }
+    }
+    fclose(file);
+    *size = (int)length;
+    return data;
+}
+
+// Worker: read and decode the image
+static void DecodeTextureRequestJob(void *data) {
+    TextureLoadRequest *request = (TextureLoadRequest *)data;
+    int size = 0;
+    unsigned char *fileData = ReadTextureFile(request->fileName, &size);
+    if (fileData != NULL) {
+        request->image = LoadImageFromMemory(GetFileExtension(request->fileName), fileData, size);
+        free(fileData);
+    }
+    SetTextureRequestStage(request, request->image.data != NULL ? TEXTURE_REQUEST_DECODED
+                                                                : TEXTURE_REQUEST_FAILED);
+}
+
+// Hand the request to a worker. False (request left QUEUED) when none can
+// take it right now.
+static bool SubmitTextureRequest(TextureLoadRequest *request) {
+    SetTextureRequestStage(request, TEXTURE_REQUEST_DECODING);
+    if (JobPoolSubmit(DecodeTextureRequestJob, request)) {
+        return true;
+    }
+    SetTextureRequestStage(request, TEXTURE_REQUEST_QUEUED);
+    return false;
+}
+
+// Main thread: upload the decoded image into a new slot
+static void UploadTextureRequest(TextureLoadRequest *request) {
+    Texture2D texture = LoadTextureFromImage(request->image);
+    UnloadImage(request->image);
+    request->image.data = NULL;
+    request->slotIndex = texture.id != 0 ? StoreTextureInSlot(texture, request->fileName) : -1;
+    SetTextureRequestStage(request, request->slotIndex >= 0 ? TEXTURE_REQUEST_DONE
+                                                            : TEXTURE_REQUEST_FAILED);
+}
+
+// Start loading a texture in the background. Returns a request handle for
+// GetTextureLoadStatus, or -1 for an invalid file name.
+EXPORT int LoadTextureAsync(const char *fileName) {
+    if (fileName == NULL || fileName[0] == '\0' || strlen(fileName) >= 256) {
+        return -1;
+    }
+    int requestIndex = HandleTableAlloc(&textureLoadRequests);
+    if (requestIndex == -1) {
+        return -1;
+    }
+    
+    JobLockAcquire(&textureLoadLock);
+    if (textureLoadsUploaded + textureLoadsFailed == textureLoadsStarted) {
+        textureLoadsStarted = 0; // Previous batch is over, start a new one
+        textureLoadsDecoded = 0;
+        textureLoadsUploaded = 0;
+        textureLoadsFailed = 0;
+    }
+    textureLoadsStarted++;
+    JobLockRelease(&textureLoadLock);
     
-    return slotIndex;
+    TextureLoadRequest *request = HandleTableGet(&textureLoadRequests, requestIndex);
+    strcpy(request->fileName, fileName);
+    request->slotIndex = -1;
+    request->stage = TEXTURE_REQUEST_QUEUED;
+    SubmitTextureRequest(request);
+    return requestIndex;
+}
+
+// Advance pending loads; call once per frame. Hands queued requests to the
+// workers and uploads decoded images until budgetMs has passed (at least one
+// per call). Without worker threads queued images are decoded here too,
+// under the same budget. Returns the number of loads still in flight.
+EXPORT int UpdateTextureLoads(float budgetMs) {
+    double start = GetTime();
+    bool worked = false;
+    bool noWorkers = JobPoolThreadCount() == 0;
+    int pending = 0;
+    
+    for (int i = 0; i < HandleTableCapacity(&textureLoadRequests); i++) {
+        TextureLoadRequest *request = HandleTableAt(&textureLoadRequests, i);
+        if (request == NULL) {
+            continue;
+        }
+        int stage = GetTextureRequestStage(request);
+        if (stage == TEXTURE_REQUEST_QUEUED && !noWorkers) {
+            SubmitTextureRequest(request);
+            stage = GetTextureRequestStage(request);
+        } else if (stage == TEXTURE_REQUEST_QUEUED &&
+                   (!worked || (GetTime() - start) * 1000.0 < budgetMs)) {
+            SetTextureRequestStage(request, TEXTURE_REQUEST_DECODING);
+            DecodeTextureRequestJob(request);
+            worked = true;
+            stage = GetTextureRequestStage(request);
+        }
+        if (stage == TEXTURE_REQUEST_DECODED &&
+            (!worked || (GetTime() - start) * 1000.0 < budgetMs)) {
+            UploadTextureRequest(request);
+            worked = true;
+            stage = GetTextureRequestStage(request);
+        }
+        if (stage != TEXTURE_REQUEST_DONE && stage != TEXTURE_REQUEST_FAILED) {
+            pending++;
+        }
+    }
+    return pending;
+}
+
+// TEXTURE_LOAD_PENDING while in flight. Once finished returns
+// TEXTURE_LOAD_DONE with outBuffer = [slotIndex, width, height] or
+// TEXTURE_LOAD_FAILED, and releases the request. Unknown requests report
+// TEXTURE_LOAD_FAILED.
+EXPORT int GetTextureLoadStatus(int requestIndex, int *outBuffer) {
+    outBuffer[0] = -1;
+    outBuffer[1] = 0;
+    outBuffer[2] = 0;
+    
+    TextureLoadRequest *request = HandleTableGet(&textureLoadRequests, requestIndex);
+    if (request == NULL) {
+        return TEXTURE_LOAD_FAILED;
+    }
+    int stage = GetTextureRequestStage(request);
+    if (stage != TEXTURE_REQUEST_DONE && stage != TEXTURE_REQUEST_FAILED) {
+        return TEXTURE_LOAD_PENDING;
+    }
+    
+    TextureSlot *slot = GetTextureSlot(request->slotIndex);
+    if (stage == TEXTURE_REQUEST_DONE && slot != NULL) {
+        outBuffer[0] = request->slotIndex;
+        outBuffer[1] = slot->texture.width;
+        outBuffer[2] = slot->texture.height;
+    }
+    HandleTableFree(&textureLoadRequests, requestIndex);
+    return outBuffer[0] >= 0 ? TEXTURE_LOAD_DONE : TEXTURE_LOAD_FAILED;
+}
+
+// Progress of the current batch of async loads:
+// [started, decoded, uploaded, failed]. A batch ends once every load in it
+// has been uploaded or has failed; the next LoadTextureAsync starts a new one.
+EXPORT void GetTextureLoadProgress(int *outBuffer) {
+    JobLockAcquire(&textureLoadLock);
+    outBuffer[0] = textureLoadsStarted;
+    outBuffer[1] = textureLoadsDecoded;
+    outBuffer[2] = textureLoadsUploaded;
+    outBuffer[3] = textureLoadsFailed;
+    JobLockRelease(&textureLoadLock);
 }
 
 // Get texture properties by slot index
 EXPORT int GetTextureWidthBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return textureSlots[slotIndex].texture.width;
+    return slot->texture.width;
 }
 
 EXPORT int GetTextureHeightBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return textureSlots[slotIndex].texture.height;
+    return slot->texture.height;
 }
 
 EXPORT int GetTextureMipmapsBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return textureSlots[slotIndex].texture.mipmaps;
+    return slot->texture.mipmaps;
 }
 
 EXPORT int GetTextureFormatBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot) {
         return 0;
     }
-    return textureSlots[slotIndex].texture.format;
+    return slot->texture.format;
 }
 
+// Counts as a use: an evicted texture is reloaded so the id is live. The
+// texture is pinned so the id the caller keeps cannot dangle after an
+// eviction; unpin it once the id is no longer held.
 EXPORT unsigned int GetTextureIdBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot || !UseTextureSlot(slot)) {
         return 0;
     }
-    return textureSlots[slotIndex].texture.id;
+    slot->pinned = true;
+    return slot->texture.id;
 }
 
-// Unload texture by slot index
+// Let the memory budget evict a texture again; ids taken from
+// GetTextureIdBySlot before this call may go stale at the next frame end
+EXPORT void UnpinTextureBySlot(int slotIndex) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (slot) {
+        slot->pinned = false;
+    }
+}
+
+// Units a texture can be bound to for shader samplers. Unit 0 is left to
+// the render batch, which rebinds it for every draw.
+#define TEXTURE_SAMPLER_UNITS 16
+
+// Bind a texture to a unit for a sampler uniform (see
+// SetShaderValueTextureBySlot). Counts as a use, like drawing it.
+EXPORT bool BindTextureToUnitBySlot(int slotIndex, int unit) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot || unit < 1 || unit >= TEXTURE_SAMPLER_UNITS || !UseTextureSlot(slot)) {
+        return false;
+    }
+
+    rlActiveTextureSlot(unit);
+    rlEnableTexture(slot->texture.id);
+    rlActiveTextureSlot(0);
+    return true;
+}
+
+// Unload texture by slot index (the handle is stale at once, the GPU
+// texture is released by the next DrainTextureUnloads)
 EXPORT void UnloadTextureBySlot(int slotIndex) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot) {
         return;
     }
     
-    UnloadTexture(textureSlots[slotIndex].texture);
-    textureSlots[slotIndex].isLoaded = false;
-    textureSlots[slotIndex].texture = (Texture2D){0};
-    memset(textureSlots[slotIndex].fileName, 0, 256);
+    if (!slot->evicted) {
+        DeferredUnloadPush(&textureUnloads, &slot->texture);
+        textureResidentBytes -= slot->vramBytes;
+    }
+    HandleTableFree(&textureSlots, slotIndex);
 }
 
 // Draw texture by slot index
 EXPORT void DrawTextureBySlot(int slotIndex, int posX, int posY, Color tint) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot || !UseTextureSlot(slot)) {
         return;
     }
     
-    DrawTexture(textureSlots[slotIndex].texture, posX, posY, tint);
+    DrawTexture(slot->texture, posX, posY, tint);
 }
 
 // Draw texture with rotation and scale
 EXPORT void DrawTextureProBySlot(int slotIndex, float posX, float posY, float originX, float originY, float rotation, float scale, Color tint) {
-    if (slotIndex < 0 || slotIndex >= MAX_TEXTURES || !textureSlots[slotIndex].isLoaded) {
+    TextureSlot *slot = GetTextureSlot(slotIndex);
+    if (!slot || !UseTextureSlot(slot)) {
         return;
     }
     
-    Rectangle source = { 0, 0, (float)textureSlots[slotIndex].texture.width, (float)textureSlots[slotIndex].texture.height };
-    Rectangle dest = { posX, posY, textureSlots[slotIndex].texture.width * scale, textureSlots[slotIndex].texture.height * scale };
+    Rectangle source = { 0, 0, (float)slot->texture.width, (float)slot->texture.height };
+    Rectangle dest = { posX, posY, slot->texture.width * scale, slot->texture.height * scale };
     Vector2 origin = { originX, originY };
     
-    DrawTexturePro(textureSlots[slotIndex].texture, source, dest, origin, rotation, tint);
+    DrawTexturePro(slot->texture, source, dest, origin, rotation, tint);
 }
 
 // Get number of loaded textures
 EXPORT int GetLoadedTextureCount() {
-    int count = 0;
-    for (int i = 0; i < MAX_TEXTURES; i++) {
-        if (textureSlots[i].isLoaded) {
-            count++;
-        }
-    }
-    return count;
+    return HandleTableCount(&textureSlots);
 }
 
 // Unload all textures
 EXPORT void UnloadAllTextures() {
-    for (int i = 0; i < MAX_TEXTURES; i++) {
-        if (textureSlots[i].isLoaded) {
-            UnloadTextureBySlot(i);
+    for (int i = 0; i < HandleTableCapacity(&textureSlots); i++) {
+        UnloadTextureBySlot(HandleTableHandleAt(&textureSlots, i));
+    }
+}
+
+// Release queued textures for up to budgetMs (negative: all of them),
+// returns how many were released
+EXPORT int DrainTextureUnloads(float budgetMs) {
+    return DeferredUnloadDrain(&textureUnloads, budgetMs);
+}
+
+// Defer texture releases to DrainTextureUnloads (default) or release them
+// inside UnloadTextureBySlot; turning deferral off releases the queue
+EXPORT void SetDeferredTextureUnload(bool enabled) {
+    DeferredUnloadSetImmediate(&textureUnloads, !enabled);
+}
+
+// [queued, peak queued, released by drains], counters reset on request
+EXPORT void GetTextureUnloadStats(int *outBuffer, bool reset) {
+    DeferredUnloadStats(&textureUnloads, outBuffer, reset);
+}
+
+// Resident texture memory to keep within, in KiB (0 or less: no budget).
+// Enforced by EndTextureFrame.
+EXPORT void SetTextureMemoryBudget(int budgetKB) {
+    textureBudgetKB = budgetKB > 0 ? budgetKB : 0;
+}
+
+static int CompareLastUsedFrame(const void *a, const void *b) {
+    unsigned int frameA = (*(TextureSlot *const *)a)->lastUsedFrame;
+    unsigned int frameB = (*(TextureSlot *const *)b)->lastUsedFrame;
+    return frameA < frameB ? -1 : frameA > frameB;
+}
+
+// Close the frame for usage tracking; call once per frame after drawing.
+// Evicts least recently used textures while the resident total is over
+// budget, returns how many were evicted.
+EXPORT int EndTextureFrame() {
+    int evicted = 0;
+    size_t budgetBytes = (size_t)textureBudgetKB * 1024;
+    if (textureBudgetKB > 0 && textureResidentBytes > budgetBytes) {
+        // Candidates: resident, reloadable, unpinned and not used this frame
+        TextureSlot **candidates = (TextureSlot **)malloc(sizeof(TextureSlot *) * HandleTableCount(&textureSlots));
+        int candidateCount = 0;
+        for (int i = 0; candidates != NULL && i < HandleTableCapacity(&textureSlots); i++) {
+            TextureSlot *slot = HandleTableAt(&textureSlots, i);
+            if (slot && !slot->evicted && !slot->pinned && slot->fileName[0] != '\0' &&
+                slot->lastUsedFrame != textureFrame) {
+                candidates[candidateCount++] = slot;
+            }
         }
+        if (candidateCount > 1) {
+            qsort(candidates, candidateCount, sizeof(TextureSlot *), CompareLastUsedFrame);
+        }
+        for (int i = 0; i < candidateCount && textureResidentBytes > budgetBytes; i++) {
+            EvictTextureSlot(candidates[i]);
+            evicted++;
+        }
+        free(candidates);
     }
-}
\ No newline at end of file
+    textureFrame++;
+    return evicted;
+}
+
+// [residentKB, budgetKB, resident textures, evicted textures, evictions,
+// reloads, pinned textures]; the eviction and reload counts reset on request
+EXPORT void GetTextureMemoryStats(int *outBuffer, bool reset) {
+    int resident = 0;
+    int evicted = 0;
+    int pinned = 0;
+    for (int i = 0; i < HandleTableCapacity(&textureSlots); i++) {
+        TextureSlot *slot = HandleTableAt(&textureSlots, i);
+        if (slot && slot->evicted) {
+            evicted++;
+        } else if (slot) {
+            resident++;
+        }
+        if (slot && slot->pinned) {
+            pinned++;
+        }
+    }
+    outBuffer[0] = (int)((textureResidentBytes + 1023) / 1024);
+    outBuffer[1] = textureBudgetKB;
+    outBuffer[2] = resident;
+    outBuffer[3] = evicted;
+    outBuffer[4] = textureEvictions;
+    outBuffer[5] = textureReloads;
+    outBuffer[6] = pinned;
+    if (reset) {
+        textureEvictions = 0;
+        textureReloads = 0;
+    }
+}
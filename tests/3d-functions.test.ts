@@ -54,6 +54,49 @@ describe('3D Functions', () => {
         })
     })
 
+    describe('Persistent Camera', () => {
+        test('should create camera and draw with it', () => {
+            const camera = rl.createCamera3D(new Vector3(10, 10, 10), Vector3.Zero(), Vector3.Up(), 45, 0).unwrap()
+
+            expect(rl.beginMode3DCamera(camera).isOk()).toBe(true)
+            expect(rl.endMode3D().isOk()).toBe(true)
+
+            rl.unloadCamera3D(camera)
+        })
+
+        test('should cast ray from screen center toward target', () => {
+            const camera = rl.createCamera3D(new Vector3(0, 0, 10), Vector3.Zero(), Vector3.Up(), 45, 0).unwrap()
+
+            const ray = rl.getScreenToWorldRay(camera, 400, 300).unwrap()
+            expect(ray.direction.x).toBeCloseTo(0, 2)
+            expect(ray.direction.y).toBeCloseTo(0, 2)
+            expect(ray.direction.z).toBeCloseTo(-1, 2)
+
+            rl.unloadCamera3D(camera)
+        })
+
+        test('should fail for unloaded camera', () => {
+            const camera = rl.createCamera3D(new Vector3(0, 0, 10), Vector3.Zero(), Vector3.Up(), 45, 0).unwrap()
+            rl.unloadCamera3D(camera)
+
+            expect(rl.getScreenToWorldRay(camera, 400, 300).isErr()).toBe(true)
+            expect(rl.setCamera3D(camera, new Vector3(0, 0, 5), Vector3.Zero(), Vector3.Up(), 45, 0).isErr()).toBe(true)
+        })
+
+        test('should miss when picking in empty scene', () => {
+            const camera = rl.createCamera3D(new Vector3(0, 0, 10), Vector3.Zero(), Vector3.Up(), 45, 0).unwrap()
+            rl.clearModelInstances()
+
+            const pick = rl.pickSceneInstance(camera, 400, 300).unwrap()
+            expect(pick.hit).toBe(false)
+            expect(pick.instanceId).toBe(-1)
+
+            expect(rl.pickSceneInstance(camera).isOk()).toBe(true)
+
+            rl.unloadCamera3D(camera)
+        })
+    })
+
     describe('3D Shape Drawing', () => {
         const setupDrawing = () => {
             const beginDrawingResult = rl.beginDrawing()
@@ -147,6 +190,30 @@ describe('3D Functions', () => {
             teardownDrawing()
         })
 
+        test('should cull primitives outside the camera frustum', () => {
+            rl.getCullingStats() // discard earlier counts
+            setupDrawing()
+
+            // One cube at the target, one far behind the camera
+            expect(rl.drawCube(Vector3.Zero(), 1, 1, 1, 0xFF0000FF).isOk()).toBe(true)
+            expect(rl.drawCube(new Vector3(100, 100, 100), 1, 1, 1, 0xFF0000FF).isOk()).toBe(true)
+
+            teardownDrawing()
+
+            const stats = rl.getCullingStats().unwrap()
+            expect(stats.primitivesCulled).toBe(1)
+            expect(stats.culled).toBe(1)
+            expect(stats.drawn).toBe(1)
+
+            // Disabled culling draws everything
+            expect(rl.setFrustumCulling(false).isOk()).toBe(true)
+            setupDrawing()
+            rl.drawCube(new Vector3(100, 100, 100), 1, 1, 1, 0xFF0000FF)
+            teardownDrawing()
+            expect(rl.getCullingStats().unwrap().culled).toBe(0)
+            expect(rl.setFrustumCulling(true).isOk()).toBe(true)
+        })
+
         test('should fail to draw cube with invalid parameters', () => {
             setupDrawing()
 
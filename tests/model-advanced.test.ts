@@ -1,7 +1,10 @@
 import { describe, test, expect, beforeEach, afterEach } from 'bun:test'
 import Raylib from '../src/Raylib'
 import Vector3 from '../src/math/Vector3'
-import { Colors } from '../src/constants'
+import { Colors, ANIMATION_BATCH_STRIDE } from '../src/constants'
+import { cpSync, existsSync, mkdtempSync, rmSync } from 'node:fs'
+import { tmpdir } from 'node:os'
+import { join } from 'node:path'
 
 describe('Advanced Model Functions', () => {
     let rl: Raylib
@@ -84,6 +87,101 @@ describe('Advanced Model Functions', () => {
         })
     })
 
+    describe('Instanced Drawing', () => {
+        const instancingVertexShader = `
+#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+in mat4 instanceTransform;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+void main() {
+    fragTexCoord = vertexTexCoord;
+    gl_Position = mvp * instanceTransform * vec4(vertexPosition, 1.0);
+}
+`
+        const fragmentShader = `
+#version 330
+in vec2 fragTexCoord;
+uniform sampler2D texture0;
+uniform vec4 colDiffuse;
+out vec4 finalColor;
+void main() {
+    finalColor = texture(texture0, fragTexCoord) * colDiffuse;
+}
+`
+
+        test('should draw many copies of a model in one call', () => {
+            const model = rl.loadModel('assets/models/phoenix_bird.glb').unwrap()
+            const shader = rl.loadShaderFromMemory(instancingVertexShader, fragmentShader).unwrap()
+
+            // Two small copies near the origin, one far behind the camera
+            const transforms = new Float32Array(3 * 16)
+            const offsets = [0, 1, 500]
+            offsets.forEach((x, i) => {
+                const s = 0.001
+                transforms.set([s, 0, 0, 0, 0, s, 0, 0, 0, 0, s, 0, x, x, x, 1], i * 16)
+            })
+
+            setup3DMode()
+            expect(rl.drawModelInstanced(model, transforms, shader).unwrap()).toBe(2)
+            expect(rl.drawModelInstanced(model, new Float32Array(0), shader).unwrap()).toBe(0)
+            expect(rl.drawModelInstanced(model, new Float32Array(15), shader).isErr()).toBe(true)
+            expect(rl.drawModelInstanced(model, transforms, { slotIndex: 31 }).isErr()).toBe(true)
+            teardown3DMode()
+
+            rl.unloadShader(shader)
+            rl.unloadModel(model)
+        })
+    })
+
+    describe('Mesh Optimization', () => {
+        test('should optimize meshes on load and report stats', () => {
+            expect(rl.setModelCache('off').isOk()).toBe(true)
+            expect(rl.setModelMeshOptimization(true).isOk()).toBe(true)
+            const model = rl.loadModel('assets/frog_tamagotchi/scene.gltf').unwrap()
+            expect(rl.setModelMeshOptimization(false).isOk()).toBe(true)
+
+            const stats = rl.getModelOptimizeStats(model).unwrap()
+            expect(stats.meshesOptimized).toBeGreaterThan(0)
+            expect(stats.verticesAfter).toBeLessThanOrEqual(stats.verticesBefore)
+            expect(stats.acmrAfter).toBeLessThanOrEqual(stats.acmrBefore)
+            expect(stats.acmrAfter).toBeGreaterThan(0)
+
+            // Still draws after the meshes were replaced
+            setup3DMode()
+            expect(rl.drawModel(model, Vector3.Zero(), 1.0, Colors.WHITE).isOk()).toBe(true)
+            teardown3DMode()
+
+            expect(rl.setModelCache('path').isOk()).toBe(true)
+            rl.unloadModel(model)
+        })
+    })
+
+    describe('Level of Detail', () => {
+        test('should generate simplified levels and draw them at a distance', () => {
+            const model = rl.loadModel('assets/frog_tamagotchi/scene.gltf').unwrap()
+            const info = rl.generateModelLods(model, 2).unwrap()
+            expect(info.levelCount).toBe(2)
+            expect(info.triangleCounts.length).toBe(3)
+            expect(info.triangleCounts[1]!).toBeLessThan(info.triangleCounts[0]!)
+            expect(info.triangleCounts[2]!).toBeLessThanOrEqual(info.triangleCounts[1]!)
+
+            // Far along the view direction the model covers only a few pixels
+            rl.getModelLodStats()
+            setup3DMode()
+            expect(rl.drawModel(model, new Vector3(-300, -300, -300), 1.0, Colors.WHITE).isOk()).toBe(true)
+            teardown3DMode()
+            const draws = rl.getModelLodStats().unwrap()
+            expect(draws[0]).toBe(0)
+            expect(draws.reduce((a, b) => a + b, 0)).toBe(1)
+
+            expect(rl.setModelLodGeneration(5).isErr()).toBe(true)
+            expect(rl.generateModelLods(model, 0).unwrap().levelCount).toBe(0)
+            rl.unloadModel(model)
+        })
+    })
+
     describe('Model Management', () => {
         test('should get loaded model count', () => {
             const result = rl.getLoadedModelCount()
@@ -91,6 +189,97 @@ describe('Advanced Model Functions', () => {
             expect(typeof result.unwrap()).toBe('number')
         })
 
+        test('should share a model loaded twice from the same file', () => {
+            const path = 'assets/frog_tamagotchi/scene.gltf'
+            const first = rl.loadModel(path).unwrap()
+            const second = rl.loadModel('assets/frog_tamagotchi/../frog_tamagotchi/scene.gltf').unwrap()
+            expect(second.slotIndex).toBe(first.slotIndex)
+            expect(rl.getModelRefCount(first).unwrap()).toBe(2)
+
+            // Freed only with the last reference
+            rl.unloadModel(second)
+            expect(rl.isModelSlotValid(first.slotIndex).unwrap()).toBe(true)
+            rl.unloadModel(first)
+            expect(rl.getModelRefCount(first).unwrap()).toBe(0)
+
+            // Content matching shares too, turning the cache off does not
+            expect(rl.setModelCache('content').isOk()).toBe(true)
+            const a = rl.loadModel(path).unwrap()
+            expect(rl.loadModel(path).unwrap().slotIndex).toBe(a.slotIndex)
+            expect(rl.setModelCache('off').isOk()).toBe(true)
+            const b = rl.loadModel(path).unwrap()
+            expect(b.slotIndex).not.toBe(a.slotIndex)
+            expect(rl.setModelCache('path').isOk()).toBe(true)
+            expect(rl.setModelCache('bogus' as any).isErr()).toBe(true)
+
+            rl.unloadModel(a)
+            rl.unloadModel(a)
+            rl.unloadModel(b)
+        })
+
+        test('should reject a stale handle once its slot is reused', () => {
+            expect(rl.setModelCache('off').isOk()).toBe(true)
+            const first = rl.loadModel('assets/frog_tamagotchi/scene.gltf').unwrap()
+            rl.unloadModel(first)
+            const second = rl.loadModel('assets/frog_tamagotchi/scene.gltf').unwrap()
+            expect(second.slotIndex).not.toBe(first.slotIndex)
+            expect(rl.isModelSlotValid(first.slotIndex).unwrap()).toBe(false)
+            expect(rl.isModelSlotValid(second.slotIndex).unwrap()).toBe(true)
+            expect(rl.setModelCache('path').isOk()).toBe(true)
+            rl.unloadModel(second)
+        })
+
+        test('should load a model asynchronously', () => {
+            const request = rl.loadModelAsync('assets/frog_tamagotchi/scene.gltf').unwrap()
+            let model = null
+            for (let i = 0; i < 1000 && model === null; i++) {
+                rl.updateModelLoads(4)
+                model = rl.pollModelLoad(request).unwrap()
+            }
+            expect(model).not.toBeNull()
+            expect(model!.meshCount).toBeGreaterThan(0)
+            expect(rl.isModelSlotValid(model!.slotIndex).unwrap()).toBe(true)
+            expect(rl.pollModelLoad(request).isErr()).toBe(true)
+            rl.unloadModel(model!)
+        })
+
+        test('should report a failed asynchronous load', () => {
+            const request = rl.loadModelAsync('assets/models/missing.glb').unwrap()
+            let result = rl.pollModelLoad(request)
+            for (let i = 0; i < 1000 && result.isOk() && result.unwrap() === null; i++) {
+                rl.updateModelLoads(4)
+                result = rl.pollModelLoad(request)
+            }
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should reload a model from its binary cache file', () => {
+            // Cache files are written next to the model, so work on a copy
+            const dir = mkdtempSync(join(tmpdir(), 'model-cache-'))
+            cpSync('assets/frog_tamagotchi', dir, { recursive: true })
+            const path = join(dir, 'scene.gltf')
+            expect(rl.setModelCache('off').isOk()).toBe(true)
+            expect(rl.setModelBinaryCache(true).isOk()).toBe(true)
+            rl.getModelBinaryCacheStats()
+
+            const parsed = rl.loadModel(path).unwrap()
+            expect(existsSync(`${path}.rlmc`)).toBe(true)
+            const cached = rl.loadModel(path).unwrap()
+            expect(cached.meshCount).toBe(parsed.meshCount)
+            expect(cached.materialCount).toBe(parsed.materialCount)
+            const a = rl.getModelBoundingBox(parsed).unwrap()
+            const b = rl.getModelBoundingBox(cached).unwrap()
+            expect(b.min.x).toBeCloseTo(a.min.x)
+            expect(b.max.y).toBeCloseTo(a.max.y)
+            expect(rl.getModelBinaryCacheStats().unwrap()).toEqual({ hits: 1, misses: 1, writes: 1 })
+
+            expect(rl.setModelBinaryCache(false).isOk()).toBe(true)
+            expect(rl.setModelCache('path').isOk()).toBe(true)
+            rl.unloadModel(parsed)
+            rl.unloadModel(cached)
+            rmSync(dir, { recursive: true, force: true })
+        })
+
         test('should unload all models', () => {
             const result = rl.unloadAllModels()
             expect(result.isOk()).toBe(true)
@@ -99,4 +288,160 @@ describe('Advanced Model Functions', () => {
             expect(count).toBe(0)
         })
     })
+
+    describe('Model Animation', () => {
+        const modelPath = 'assets/models/phoenix_bird.glb'
+
+        test('should skin natively with the same result as raylib', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const animations = rl.loadModelAnimations(modelPath).unwrap()
+            expect(animations.length).toBeGreaterThan(0)
+
+            const frame = Math.floor(animations[0]!.frameCount / 2)
+            const bench = rl.benchmarkModelSkinning(model, animations[0]!, 0, frame).unwrap()
+            expect(bench.maxError).toBeLessThan(0.001)
+            expect(bench.workerThreads).toBe(rl.getSkinningThreadCount().unwrap())
+
+            // Repeated frames are skipped natively, toggling falls back to raylib
+            expect(rl.updateModelAnimation(model, animations[0]!, 0, frame).isOk()).toBe(true)
+            expect(rl.updateModelAnimation(model, animations[0]!, 0, frame).isOk()).toBe(true)
+            expect(rl.setNativeSkinning(false).isOk()).toBe(true)
+            expect(rl.updateModelAnimation(model, animations[0]!, 0, frame + 1).isOk()).toBe(true)
+            expect(rl.setNativeSkinning(true).isOk()).toBe(true)
+
+            rl.unloadAllAnimations()
+            rl.unloadModel(model)
+        })
+
+        test('should follow the animated pose with mesh bounds', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const animations = rl.loadModelAnimations(modelPath).unwrap()
+            const anim = animations[0]!
+
+            const bounds = rl.getModelMeshBounds(model).unwrap()
+            expect(bounds.length).toBe(model.meshCount)
+            for (const box of bounds) {
+                expect(box.max.x).toBeGreaterThanOrEqual(box.min.x)
+            }
+
+            expect(rl.updateModelAnimation(model, anim, 0, Math.floor(anim.frameCount / 2)).isOk()).toBe(true)
+            const posed = rl.getModelBoundsBatch([model, { ...model, slotIndex: -1 }]).unwrap()
+            expect(posed.length).toBe(2)
+            expect(posed[0]!.max.y).toBeGreaterThan(posed[0]!.min.y)
+            expect(posed[1]!).toEqual({ min: { x: 0, y: 0, z: 0 }, max: { x: 0, y: 0, z: 0 } })
+
+            rl.unloadAllAnimations()
+            rl.unloadModel(model)
+        })
+
+        test('should export the bone palette of a posed model', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const animations = rl.loadModelAnimations(modelPath).unwrap()
+            const anim = animations[0]!
+
+            const bind = rl.getModelBonePalette(model).unwrap()
+            expect(bind.length).toBeGreaterThan(0)
+            expect(bind.length % 16).toBe(0)
+            expect(bind[15]).toBeCloseTo(1)
+
+            expect(rl.updateModelAnimationBones(model, anim, 0, Math.floor(anim.frameCount / 2)).isOk()).toBe(true)
+            const palette = new Float32Array(bind.length)
+            expect(rl.getModelBonePalette(model, palette).unwrap()).toBe(palette)
+            expect(palette.some((value, i) => Math.abs(value - bind[i]!) > 1e-4)).toBe(true)
+            expect(rl.getModelBonePalette(model, palette, 'skinning').isOk()).toBe(true)
+
+            expect(rl.getModelBonePalette(model, new Float32Array(16)).isErr()).toBe(true)
+            expect(rl.getModelBonePalette(model, undefined, 'world' as any).isErr()).toBe(true)
+
+            rl.unloadAllAnimations()
+            rl.unloadModel(model)
+        })
+
+        test('should update several models in one batch call', () => {
+            const models = [0, 1, 2].map(() => rl.loadModel(modelPath).unwrap())
+            const animations = rl.loadModelAnimations(modelPath).unwrap()
+            const anim = animations[0]!
+
+            const entries = new Float32Array(models.length * ANIMATION_BATCH_STRIDE)
+            models.forEach((model, i) => {
+                entries.set([model.slotIndex, anim.slotIndex, 0, i % 2], i * ANIMATION_BATCH_STRIDE)
+            })
+            expect(rl.updateAnimationsBatch(entries).unwrap()).toBe(models.length)
+
+            // Invalid entries are skipped, bad lengths are rejected
+            entries[0] = -1
+            expect(rl.updateAnimationsBatch(entries).unwrap()).toBe(models.length - 1)
+            expect(rl.updateAnimationsBatch(new Float32Array(3)).isErr()).toBe(true)
+            expect(rl.updateAnimationsBatch(new Float32Array(0)).unwrap()).toBe(0)
+
+            rl.unloadAllAnimations()
+            models.forEach(model => rl.unloadModel(model))
+        })
+
+        test('should share poses between models on the same frame', () => {
+            const models = [0, 1, 2, 3].map(() => rl.loadModel(modelPath).unwrap())
+            const anim = rl.loadModelAnimations(modelPath).unwrap()[0]!
+            rl.clearPoseCache()
+            rl.getPoseCacheStats() // discard earlier counts
+
+            models.forEach(model => {
+                expect(rl.updateModelAnimationBones(model, anim, 0, 1).isOk()).toBe(true)
+            })
+            const stats = rl.getPoseCacheStats().unwrap()
+            expect(stats.misses).toBe(1)
+            expect(stats.hits).toBe(models.length - 1)
+            expect(stats.entries).toBe(1)
+
+            // Unloading the animation drops its poses
+            rl.unloadAllAnimations()
+            expect(rl.getPoseCacheStats().unwrap().entries).toBe(0)
+            models.forEach(model => rl.unloadModel(model))
+        })
+
+        test('should compress animation keyframes on load', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const raw = rl.loadModelAnimations(modelPath).unwrap()[0]!
+            expect(raw.storedBytes).toBe(raw.rawBytes)
+
+            const compressed = rl.loadModelAnimations(modelPath, { rotationTolerance: 0.002 }).unwrap()[0]!
+            expect(compressed.frameCount).toBe(raw.frameCount)
+            expect(compressed.rawBytes).toBe(raw.rawBytes)
+            expect(compressed.storedBytes!).toBeLessThan(raw.rawBytes!)
+
+            // Compressed clips sample like raw ones, natively and through raylib
+            const frame = Math.floor(compressed.frameCount / 2)
+            expect(rl.benchmarkModelSkinning(model, compressed, 0, frame).unwrap().maxError).toBeLessThan(0.001)
+            expect(rl.updateModelAnimation(model, compressed, 0, frame).isOk()).toBe(true)
+            expect(rl.loadModelAnimations(modelPath, { translationTolerance: -1 }).isErr()).toBe(true)
+
+            rl.unloadAllAnimations()
+            rl.unloadModel(model)
+        })
+
+        test('should sample fractional frames and blend clips', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const anim = rl.loadModelAnimations(modelPath).unwrap()[0]!
+            const layer = { animation: anim, animIndex: 0, frame: 1.5 }
+
+            expect(rl.updateModelAnimationBlend(model, [layer]).isOk()).toBe(true)
+            expect(rl.updateModelAnimationBlend(model, [layer, { ...layer, frame: 3, weight: 0.5 }], true).isOk()).toBe(true)
+            expect(rl.crossfadeModelAnimation(model, layer, { ...layer, frame: 0 }, 0.25).isOk()).toBe(true)
+            expect(rl.updateModelAnimationAtTime(model, anim, 0, 12.34).isOk()).toBe(true)
+
+            expect(rl.updateModelAnimationBlend(model, []).isErr()).toBe(true)
+            expect(rl.crossfadeModelAnimation(model, layer, layer, 2).isErr()).toBe(true)
+            expect(rl.updateModelAnimationAtTime(model, anim, 0, 1, 0).isErr()).toBe(true)
+            expect(rl.updateModelAnimationBlend(model, [{ ...layer, animation: { slotIndex: 31, frameCount: 1, boneCount: 1 } }]).isErr()).toBe(true)
+
+            rl.unloadAllAnimations()
+            rl.unloadModel(model)
+        })
+
+        test('should fail to benchmark skinning with invalid animation', () => {
+            const model = rl.loadModel(modelPath).unwrap()
+            const invalid = { slotIndex: 31, frameCount: 1, boneCount: 1 }
+            expect(rl.benchmarkModelSkinning(model, invalid, 0, 0).isErr()).toBe(true)
+            rl.unloadModel(model)
+        })
+    })
 })
@@ -1,7 +1,8 @@
 import { describe, test, expect, beforeEach, afterEach } from 'bun:test'
 import Raylib from '../src/Raylib'
 import Vector3 from '../src/math/Vector3'
-import { BoundingBox } from '../src/types'
+import { BoundingBox, Model, ModelRayCollision } from '../src/types'
+import { RAYCAST_BATCH_STRIDE } from '../src/constants'
 
 describe('Ray Collision Functions', () => {
     let rl: Raylib
@@ -16,6 +17,50 @@ describe('Ray Collision Functions', () => {
         rl.closeWindow()
     })
 
+    const down = new Vector3(0, -1, 0)
+
+    // Starts of downward rays on a steps x steps grid, 10 units above a box
+    const gridAbove = (box: BoundingBox, steps: number): Vector3[] => {
+        const starts: Vector3[] = []
+        for (let i = 0; i < steps; i++) {
+            for (let j = 0; j < steps; j++) {
+                starts.push(new Vector3(
+                    box.min.x + (box.max.x - box.min.x) * (i + 0.5) / steps,
+                    box.max.y + 10,
+                    box.min.z + (box.max.z - box.min.z) * (j + 0.5) / steps
+                ))
+            }
+        }
+        return starts
+    }
+
+    // Downward rays over the model that hit it, with their model collisions
+    const modelHits = (model: Model, steps: number) => {
+        const bbox = rl.getModelBoundingBox(model).unwrap()
+        const hits: { rayPos: Vector3, collision: ModelRayCollision }[] = []
+        for (const rayPos of gridAbove(bbox, steps)) {
+            const collision = rl.getRayCollisionModel(rayPos, down, model).unwrap()
+            if (collision.hit) {
+                hits.push({ rayPos, collision })
+            }
+        }
+        return hits
+    }
+
+    // Brute force over the meshes: the model hit must be the nearest mesh hit
+    const expectNearestMesh = (rayPos: Vector3, model: Model, collision: ModelRayCollision) => {
+        expect(collision.hit).toBe(true)
+        for (let meshIndex = 0; meshIndex < model.meshCount; meshIndex++) {
+            const meshHit = rl.getRayCollisionMesh(rayPos, down, model, meshIndex).unwrap()
+            if (meshIndex === collision.meshIndex) {
+                expect(meshHit.hit).toBe(true)
+                expect(meshHit.distance).toBeCloseTo(collision.distance, 3)
+            } else if (meshHit.hit) {
+                expect(meshHit.distance).toBeGreaterThanOrEqual(collision.distance - 1e-3)
+            }
+        }
+    }
+
     describe('Ray-Sphere Collision', () => {
         test('should detect ray hitting sphere', () => {
             const rayPos = new Vector3(0, 0, 0)
@@ -170,6 +215,309 @@ describe('Ray Collision Functions', () => {
             const result = rl.getRayCollisionMesh(rayPos, rayDir, model, 0)
             expect(result.isErr()).toBe(true)
         })
+
+        test('should reject building BVH for invalid model', () => {
+            const invalidModel = { slotIndex: -1, meshCount: 0, materialCount: 0 }
+
+            const result = rl.buildModelBVH(invalidModel)
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should build BVH and hit loaded model', () => {
+            const model = rl.loadModel('assets/models/phoenix_bird.glb').unwrap()
+
+            const buildResult = rl.buildModelBVH(model)
+            expect(buildResult.isOk()).toBe(true)
+            expect(buildResult.unwrap()).toBeGreaterThan(0)
+
+            const bbox = rl.getModelBoundingBox(model).unwrap()
+            const eps = 1e-3 * Math.max(bbox.max.x - bbox.min.x, bbox.max.y - bbox.min.y, bbox.max.z - bbox.min.z)
+            const hits = modelHits(model, 16)
+            expect(hits.length).toBeGreaterThan(0)
+
+            for (const { rayPos, collision } of hits) {
+                const hit = rl.getRayCollisionMesh(rayPos, down, model, collision.meshIndex).unwrap()
+                expect(hit.hit).toBe(true)
+                expect(hit.distance).toBeGreaterThan(0)
+                expect(hit.distance).toBeCloseTo(collision.distance, 3)
+                expect(hit.point.y).toBeCloseTo(rayPos.y - hit.distance, 3)
+                expect(hit.point.x).toBeGreaterThanOrEqual(bbox.min.x - eps)
+                expect(hit.point.x).toBeLessThanOrEqual(bbox.max.x + eps)
+                expect(hit.point.y).toBeGreaterThanOrEqual(bbox.min.y - eps)
+                expect(hit.point.y).toBeLessThanOrEqual(bbox.max.y + eps)
+                expect(hit.point.z).toBeGreaterThanOrEqual(bbox.min.z - eps)
+                expect(hit.point.z).toBeLessThanOrEqual(bbox.max.z + eps)
+
+                // The hit point lies on the surface per the closest-point query
+                const surface = rl.closestPointOnModel(new Vector3(hit.point.x, hit.point.y, hit.point.z), model).unwrap()
+                expect(surface.distance).toBeLessThan(eps)
+
+                expectNearestMesh(rayPos, model, collision)
+            }
+
+            rl.unloadModel(model)
+        })
+    })
+
+    describe('Ray-Model Collision', () => {
+        test('should miss invalid model', () => {
+            const invalidModel = { slotIndex: -1, meshCount: 0, materialCount: 0 }
+
+            const result = rl.getRayCollisionModel(
+                new Vector3(0, 10, 0), new Vector3(0, -1, 0), invalidModel
+            )
+            expect(result.isOk()).toBe(true)
+            expect(result.unwrap().hit).toBe(false)
+            expect(result.unwrap().meshIndex).toBe(-1)
+        })
+
+        test('should validate ray position', () => {
+            const model = { slotIndex: 0, meshCount: 1, materialCount: 1 }
+
+            const result = rl.getRayCollisionModel(
+                new Vector3(Infinity, 0, 0), new Vector3(0, -1, 0), model
+            )
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should report hit mesh of multi-mesh model', () => {
+            const model = rl.loadModel('assets/frog_tamagotchi/scene.gltf').unwrap()
+            expect(model.meshCount).toBeGreaterThan(1)
+            const hits = modelHits(model, 12)
+            expect(hits.length).toBeGreaterThan(0)
+
+            // Each hit names the mesh a per-mesh brute force finds nearest
+            for (const { rayPos, collision } of hits) {
+                expect(collision.meshIndex).toBeGreaterThanOrEqual(0)
+                expect(collision.meshIndex).toBeLessThan(model.meshCount)
+                expectNearestMesh(rayPos, model, collision)
+            }
+
+            // A ray past the model reports no mesh
+            const bbox = rl.getModelBoundingBox(model).unwrap()
+            const miss = rl.getRayCollisionModel(new Vector3(bbox.max.x + 10, bbox.max.y + 10, bbox.max.z + 10), down, model).unwrap()
+            expect(miss.hit).toBe(false)
+            expect(miss.meshIndex).toBe(-1)
+
+            rl.unloadModel(model)
+        })
+    })
+
+    describe('Batched Raycasts', () => {
+        test('should reject rays not packed as 6 floats', () => {
+            const model = { slotIndex: 0, meshCount: 1, materialCount: 1 }
+            const out = new Float32Array(RAYCAST_BATCH_STRIDE)
+
+            const result = rl.raycastBatch(new Float32Array(5), model, out)
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should reject undersized output buffer', () => {
+            const model = { slotIndex: 0, meshCount: 1, materialCount: 1 }
+            const out = new Float32Array(RAYCAST_BATCH_STRIDE)
+
+            const result = rl.raycastBatch(new Float32Array(12), model, out)
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should write misses for invalid model', () => {
+            const invalidModel = { slotIndex: -1, meshCount: 0, materialCount: 0 }
+            const rays = new Float32Array([0, 10, 0, 0, -1, 0, 0, 10, 1, 0, -1, 0])
+            const out = new Float32Array(2 * RAYCAST_BATCH_STRIDE).fill(7)
+
+            const result = rl.raycastBatch(rays, invalidModel, out)
+            expect(result.isOk()).toBe(true)
+            expect(result.unwrap()).toBe(0)
+            expect(out[0]).toBe(0)
+            expect(out[8]).toBe(-1)
+            expect(out[RAYCAST_BATCH_STRIDE + 9]).toBe(-1)
+        })
+    })
+
+    describe('Collision Mesh', () => {
+        // Unit quad in the XZ plane, two triangles
+        const quadVertices = new Float32Array([
+            -1, 0, -1,   1, 0, -1,   1, 0, 1,   -1, 0, 1,
+        ])
+
+        test('should reject vertices not packed as xyz', () => {
+            const result = rl.loadCollisionMesh(new Float32Array(4))
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should hit mesh with 16-bit and 32-bit indices', () => {
+            for (const indices of [new Uint16Array([0, 2, 1, 0, 3, 2]), new Uint32Array([0, 2, 1, 0, 3, 2])]) {
+                const mesh = rl.loadCollisionMesh(quadVertices, indices).unwrap()
+                expect(mesh.triangleCount).toBe(2)
+
+                const result = rl.raycastCollisionMesh({ x: 0.25, y: 5, z: 0.5 }, { x: 0, y: -1, z: 0 }, mesh)
+                expect(result.isOk()).toBe(true)
+                const collision = result.unwrap()
+                expect(collision.hit).toBe(true)
+                expect(collision.distance).toBeCloseTo(5, 4)
+                expect(collision.point.y).toBeCloseTo(0, 4)
+
+                rl.unloadCollisionMesh(mesh)
+            }
+        })
+
+        test('should fail for unloaded collision mesh', () => {
+            const mesh = rl.loadCollisionMesh(quadVertices, new Uint16Array([0, 2, 1])).unwrap()
+            rl.unloadCollisionMesh(mesh)
+
+            const result = rl.raycastCollisionMesh({ x: 0, y: 5, z: 0 }, { x: 0, y: -1, z: 0 }, mesh)
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should agree with per-triangle loop in benchmark', () => {
+            const rays = new Float32Array([
+                0.2, 5, 0.1, 0, -1, 0,
+                3, 5, 3, 0, -1, 0,
+            ])
+            const result = rl.benchmarkRayCollisionMesh(quadVertices, new Uint32Array([0, 2, 1, 0, 3, 2]), rays)
+            expect(result.isOk()).toBe(true)
+            expect(result.unwrap().mismatches).toBe(0)
+        })
+    })
+
+    describe('Shape Queries', () => {
+        test('should reject negative radius', () => {
+            const model = { slotIndex: 0, meshCount: 1, materialCount: 1 }
+
+            const result = rl.sphereCastModel(new Vector3(0, 10, 0), new Vector3(0, -1, 0), -1, model)
+            expect(result.isErr()).toBe(true)
+        })
+
+        test('should miss for invalid model', () => {
+            const invalidModel = { slotIndex: -1, meshCount: 0, materialCount: 0 }
+
+            const sphere = rl.sphereCastModel(new Vector3(0, 10, 0), new Vector3(0, -1, 0), 0.5, invalidModel).unwrap()
+            expect(sphere.hit).toBe(false)
+            expect(sphere.meshIndex).toBe(-1)
+
+            const closest = rl.closestPointOnModel(new Vector3(0, 0, 0), invalidModel).unwrap()
+            expect(closest.hit).toBe(false)
+        })
+
+        test('should stop sphere before the surface a ray hits', () => {
+            const model = rl.loadModel('assets/models/phoenix_bird.glb').unwrap()
+            const { rayPos, collision: ray } = modelHits(model, 16)[0]!
+            expect(ray.hit).toBe(true)
+
+            // The sphere centre is 0.1 from the surface at the latest 0.1
+            // before the ray's hit point, so it must stop at least that early
+            const sphere = rl.sphereCastModel(rayPos, down, 0.1, model).unwrap()
+            expect(sphere.hit).toBe(true)
+            expect(sphere.distance).toBeLessThan(ray.distance)
+            expect(sphere.distance).toBeLessThanOrEqual(ray.distance - 0.1 + 1e-3)
+            expect(sphere.depth).toBe(0)
+
+            // A capsule whose lower end is that sphere stops no later
+            const capsule = rl.capsuleCastModel(rayPos, new Vector3(rayPos.x, rayPos.y + 1, rayPos.z), 0.1, down, model).unwrap()
+            expect(capsule.hit).toBe(true)
+            expect(capsule.distance).toBeLessThanOrEqual(sphere.distance + 1e-3)
+
+            // Sphere resting on the hit point overlaps by its radius
+            const closest = rl.closestPointOnModel(new Vector3(ray.point.x, ray.point.y, ray.point.z), model, 0.5).unwrap()
+            expect(closest.hit).toBe(true)
+            expect(closest.distance).toBeCloseTo(0, 3)
+            expect(closest.depth).toBeCloseTo(0.5, 3)
+
+            rl.unloadModel(model)
+        })
+
+        test('should find grazing contacts on a floor', () => {
+            const floor = rl.loadModel('assets/models/plane.obj').unwrap()
+
+            // Sphere 0.5 above the floor moving 10 units a few degrees downward
+            // touches once it has dropped 0.5
+            for (const degrees of [3, 5, 10]) {
+                const angle = degrees * Math.PI / 180
+                const motion = new Vector3(10 * Math.cos(angle), -10 * Math.sin(angle), 0)
+                const expected = 0.5 / (10 * Math.sin(angle))
+
+                const sphere = rl.sphereCastModel(new Vector3(0, 1, 0), motion, 0.5, floor, 1).unwrap()
+                expect(sphere.hit).toBe(true)
+                expect(sphere.distance).toBeCloseTo(expected, 3)
+                expect(sphere.point.y).toBeCloseTo(0, 3)
+                expect(sphere.normal.y).toBeCloseTo(1, 3)
+
+                const capsule = rl.capsuleCastModel(new Vector3(0, 1, -1), new Vector3(0, 1, 1), 0.5, motion, floor, 1).unwrap()
+                expect(capsule.hit).toBe(true)
+                expect(capsule.distance).toBeCloseTo(expected, 3)
+            }
+
+            // At 1 degree the floor is only reached past the end of the motion
+            const angle = Math.PI / 180
+            const shallow = new Vector3(10 * Math.cos(angle), -10 * Math.sin(angle), 0)
+            expect(rl.sphereCastModel(new Vector3(0, 1, 0), shallow, 0.5, floor, 1).unwrap().hit).toBe(false)
+
+            rl.unloadModel(floor)
+        })
+    })
+
+    describe('Scene Raycasts', () => {
+        const translation = (x: number, y: number, z: number) => ({
+            m0: 1, m4: 0, m8: 0, m12: x,
+            m1: 0, m5: 1, m9: 0, m13: y,
+            m2: 0, m6: 0, m10: 1, m14: z,
+            m3: 0, m7: 0, m11: 0, m15: 1,
+        })
+
+        test('should reject instance of invalid model', () => {
+            const invalidModel = { slotIndex: -1, meshCount: 0, materialCount: 0 }
+            expect(rl.createModelInstance(invalidModel).isErr()).toBe(true)
+        })
+
+        test('should miss in empty scene', () => {
+            rl.clearModelInstances()
+            const result = rl.raycastScene(new Vector3(0, 10, 0), new Vector3(0, -1, 0))
+            expect(result.isOk()).toBe(true)
+            expect(result.unwrap().hit).toBe(false)
+            expect(result.unwrap().instanceId).toBe(-1)
+        })
+
+        test('should return hit instance among placed models', () => {
+            const model = rl.loadModel('assets/models/phoenix_bird.glb').unwrap()
+            const bbox = rl.getModelBoundingBox(model).unwrap()
+            const width = bbox.max.x - bbox.min.x + 1
+
+            // A column known to hit the bare model, found before placing it
+            const { rayPos: modelRayPos, collision: modelHit } = modelHits(model, 16)[0]!
+
+            const instances = []
+            for (let i = 0; i < 8; i++) {
+                instances.push(rl.createModelInstance(model, translation(i * width, 0, 0)).unwrap())
+            }
+            expect(rl.getModelInstanceCount().unwrap()).toBe(8)
+
+            // The same column over instance 5 only crosses that instance
+            const target = instances[5]!
+            const rayPos = new Vector3(modelRayPos.x + 5 * width, modelRayPos.y, modelRayPos.z)
+            const collision = rl.raycastScene(rayPos, down).unwrap()
+            expect(collision.hit).toBe(true)
+            expect(collision.instanceId).toBe(target.id)
+            expect(collision.meshIndex).toBe(modelHit.meshIndex)
+            expect(collision.distance).toBeCloseTo(modelHit.distance, 3)
+
+            // Moved instance no longer answers the same ray, and no other does
+            rl.setModelInstanceTransform(target, translation(0, -1000, 0))
+            const moved = rl.raycastScene(rayPos, down).unwrap()
+            expect(moved.hit).toBe(false)
+            expect(moved.instanceId).toBe(-1)
+
+            // A removed instance's id stays invalid after its index is reused
+            const removed = instances[2]!
+            rl.removeModelInstance(removed)
+            const replacement = rl.createModelInstance(model).unwrap()
+            expect(replacement.id).not.toBe(removed.id)
+            expect(rl.setModelInstanceTransform(removed, translation(0, 0, 0)).isErr()).toBe(true)
+            expect(rl.getModelInstanceCount().unwrap()).toBe(8)
+
+            // Unloading the model drops its instances
+            rl.unloadModel(model)
+            expect(rl.getModelInstanceCount().unwrap()).toBe(0)
+        })
     })
 
     describe('Multiple Ray Tests', () => {
@@ -380,6 +380,43 @@ void main() {
         const result = rl.setShaderValueVec4(shader, loc, 1.0, 0.5, 0.2, 1.0)
         expect(result.isOk()).toBe(true)
     })
+
+    test('should bind texture to a sampler unit', () => {
+        const vertexShader = `
+#version 330
+in vec3 vertexPosition;
+in vec2 vertexTexCoord;
+uniform mat4 mvp;
+out vec2 fragTexCoord;
+void main() {
+    fragTexCoord = vertexTexCoord;
+    gl_Position = mvp * vec4(vertexPosition, 1.0);
+}
+`
+        const fragmentShader = `
+#version 330
+in vec2 fragTexCoord;
+uniform sampler2D detail;
+out vec4 finalColor;
+void main() {
+    finalColor = texture(detail, fragTexCoord);
+}
+`
+
+        const shader = rl.loadShaderFromMemory(vertexShader, fragmentShader).unwrap()
+        const loc = rl.getShaderLocation(shader, 'detail').unwrap()
+        const textureSlot = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+
+        expect(rl.setShaderValueTexture(shader, loc, textureSlot).isOk()).toBe(true)
+        expect(rl.setShaderValueTexture(shader, loc, textureSlot, 3).isOk()).toBe(true)
+
+        // Unit 0 belongs to the render batch; texture handles are not units
+        expect(rl.setShaderValueTexture(shader, loc, textureSlot, 0).isErr()).toBe(true)
+        expect(rl.setShaderValueTexture(shader, loc, textureSlot, textureSlot).isErr()).toBe(true)
+
+        rl.unloadTextureFromSlot(textureSlot)
+        expect(rl.setShaderValueTexture(shader, loc, textureSlot).isErr()).toBe(true)
+    })
 })
 
 describe('Blend Modes', () => {
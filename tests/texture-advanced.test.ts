@@ -86,6 +86,124 @@ describe('Advanced Texture Functions', () => {
         })
     })
 
+    describe('Asynchronous Loading', () => {
+        test('should load textures asynchronously', () => {
+            const requests = [0, 1, 2].map(() =>
+                rl.loadTextureAsync('assets/textures/texture.jpg').unwrap())
+            const missing = rl.loadTextureAsync('assets/textures/missing.png').unwrap()
+            expect(rl.getTextureLoadProgress().unwrap().started).toBe(4)
+
+            for (let i = 0; i < 1000 && rl.updateTextureLoads(4).unwrap() > 0; i++) {
+                Bun.sleepSync(1)
+            }
+            const progress = rl.getTextureLoadProgress().unwrap()
+            expect(progress).toEqual({ started: 4, decoded: 3, uploaded: 3, failed: 1, fraction: 1 })
+
+            for (const request of requests) {
+                const slotIndex = rl.pollTextureLoad(request).unwrap()
+                expect(slotIndex).not.toBeNull()
+                expect(rl.getTextureFromSlot(slotIndex!).unwrap().width).toBeGreaterThan(0)
+                expect(rl.pollTextureLoad(request).isErr()).toBe(true)
+                rl.unloadTextureFromSlot(slotIndex!)
+            }
+            expect(rl.pollTextureLoad(missing).isErr()).toBe(true)
+        })
+    })
+
+    describe('Texture Memory Budget', () => {
+        test('should evict unused textures and reload them when drawn', () => {
+            const first = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+            const second = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+            rl.getTextureMemoryStats()
+            expect(rl.setTextureMemoryBudget(0.001).isOk()).toBe(true)
+
+            // Textures used in the current frame stay, the next frame they go
+            rl.beginDrawing()
+            rl.endDrawing()
+            rl.beginDrawing()
+            rl.endDrawing()
+            let stats = rl.getTextureMemoryStats().unwrap()
+            expect(stats.evictions).toBeGreaterThanOrEqual(2)
+            expect(rl.getTextureFromSlot(first).isOk()).toBe(true) // Reloads
+
+            rl.beginDrawing()
+            rl.drawTextureFromSlot(second, 0, 0, Colors.WHITE)
+            rl.endDrawing()
+            stats = rl.getTextureMemoryStats().unwrap()
+            expect(stats.reloads).toBe(2)
+            expect(stats.budgetMB).toBeCloseTo(1 / 1024)
+
+            expect(rl.setTextureMemoryBudget(0).isOk()).toBe(true)
+            rl.unloadTextureFromSlot(first)
+            rl.unloadTextureFromSlot(second)
+        })
+
+        test('should keep textures resident while their id is held', () => {
+            const held = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+            const other = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+            const { id } = rl.getTextureFromSlot(held).unwrap()
+            rl.getTextureMemoryStats()
+            expect(rl.setTextureMemoryBudget(0.001).isOk()).toBe(true)
+
+            // Over budget for two frames: only the unpinned texture goes
+            rl.beginDrawing()
+            rl.endDrawing()
+            rl.beginDrawing()
+            rl.endDrawing()
+            let stats = rl.getTextureMemoryStats().unwrap()
+            expect(stats.pinned).toBeGreaterThanOrEqual(1)
+            expect(rl.getTextureFromSlot(held).unwrap().id).toBe(id)
+            expect(stats.reloads).toBe(0)
+
+            // Once unpinned it is evicted like any other
+            expect(rl.unpinTexture(held).isOk()).toBe(true)
+            rl.beginDrawing()
+            rl.endDrawing()
+            rl.beginDrawing()
+            rl.endDrawing()
+            stats = rl.getTextureMemoryStats().unwrap()
+            expect(stats.evictions).toBeGreaterThanOrEqual(1)
+            expect(stats.evicted).toBeGreaterThanOrEqual(2)
+
+            expect(rl.setTextureMemoryBudget(0).isOk()).toBe(true)
+            rl.unloadTextureFromSlot(held)
+            rl.unloadTextureFromSlot(other)
+        })
+    })
+
+    describe('Deferred Unloads', () => {
+        test('should release unloaded textures after the frame', () => {
+            rl.getUnloadQueueStats()
+            const initialCount = rl.getLoadedTextureCount().unwrap()
+            const texture = rl.loadTexture('assets/textures/texture.jpg').unwrap()
+            const target = rl.loadRenderTexture(64, 64).unwrap()
+
+            rl.unloadTextureFromSlot(texture)
+            rl.unloadRenderTextureFromSlot(target)
+            expect(rl.getLoadedTextureCount().unwrap()).toBe(initialCount)
+
+            let stats = rl.getUnloadQueueStats().unwrap()
+            expect(stats.texture.pending).toBe(1)
+            expect(stats.renderTexture.pending).toBe(1)
+
+            rl.beginDrawing()
+            rl.endDrawing()
+            stats = rl.getUnloadQueueStats().unwrap()
+            expect(stats.texture.pending).toBe(0)
+            expect(stats.texture.released).toBe(1)
+            expect(stats.renderTexture.released).toBe(1)
+        })
+
+        test('should release unloads at once when deferral is off', () => {
+            expect(rl.setUnloadBudget(-1).isErr()).toBe(true)
+            rl.getUnloadQueueStats()
+            rl.setDeferredUnload(false)
+            rl.unloadTextureFromSlot(rl.loadTexture('assets/textures/texture.jpg').unwrap())
+            expect(rl.getUnloadQueueStats().unwrap().texture.pending).toBe(0)
+            rl.setDeferredUnload(true)
+        })
+    })
+
     describe('Render Texture Management', () => {
         test('should unload all render textures', () => {
             rl.loadRenderTexture(100, 100)